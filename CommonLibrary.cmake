@@ -7,6 +7,7 @@ endif()
 export(TARGETS CommonAPI Common FILE SceneriConfig.cmake)
 
 MakeUnitTests(Common Common)
+MakeCpp20UnitTests(Common Common)
 
 if(PLATFORM_APPLE) 
     set_source_files_properties("${CMAKE_CURRENT_LIST_DIR}/include/IO/Library.cpp" PROPERTIES LANGUAGE OBJCXX)
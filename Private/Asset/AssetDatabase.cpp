@@ -1,4 +1,5 @@
 #include "Asset/AssetDatabase.h"
+#include "Asset/AssetDatabaseStamps.h"
 #include "Asset/LocalAssetDatabase.h"
 #include "Asset/Asset.h"
 #include "Asset/Serialization/MetaData.h"
@@ -14,6 +15,7 @@
 #include <Common/IO/Log.h>
 #include <Common/Serialization/Deserialize.h>
 #include <Common/Serialization/Serialize.h>
+#include <Common/Serialization/StreamingReader.h>
 #include <Common/Memory/Containers/Serialization/UnorderedMap.h>
 #include <Common/Memory/Containers/Serialization/UnorderedSet.h>
 #include <Common/Memory/Containers/Serialization/Vector.h>
@@ -22,6 +24,12 @@
 #include <Common/IO/Format/ZeroTerminatedPathView.h>
 #include <Common/Asset/Format/Guid.h>
 #include <Common/System/Query.h>
+#include <Common/Threading/Jobs/ParallelFor.h>
+#include <Common/Threading/AtomicBool.h>
+#include <Common/Threading/Mutexes/ConditionVariable.h>
+#include <Common/Threading/Mutexes/UniqueLock.h>
+#include <Common/Threading/Sleep.h>
+#include <Common/Algorithms/Sort.h>
 #include <Common/Reflection/Registry.h>
 
 namespace ngine::Asset
@@ -189,7 +197,34 @@ namespace ngine::Asset
 
 	bool Database::Load(const IO::ConstZeroTerminatedPathView databaseFile, const IO::PathView databaseRootDirectory)
 	{
-		return Serialization::DeserializeFromDisk(databaseFile, *this, databaseRootDirectory);
+		// Stream the members of the database, so large databases are never held as a full document next to the entries
+		bool serializedAny = false;
+		const bool wasParsed = Serialization::StreamObjectMembers(
+			databaseFile,
+			[this, &databaseRootDirectory, &serializedAny](const ConstStringView name, const Serialization::Reader reader)
+			{
+				if (name == "guid")
+				{
+					reader.SerializeInPlace(m_guid);
+				}
+				else if (name == "imported_assets")
+				{
+					serializedAny |= reader.SerializeInPlace(m_importedAssets);
+				}
+				else
+				{
+					const Guid assetGuid = Guid::TryParse(name);
+					DatabaseEntry entry;
+					if (LIKELY(assetGuid.IsValid()) && entry.Serialize(reader, databaseRootDirectory))
+					{
+						EmplaceEntry(assetGuid, Move(entry));
+						serializedAny = true;
+					}
+				}
+				return true;
+			}
+		);
+		return wasParsed & serializedAny;
 	}
 
 	bool Database::Load(const Serialization::Data& data, const IO::PathView prefix)
@@ -197,39 +232,52 @@ namespace ngine::Asset
 		return Serialization::Deserialize(data, *this, prefix);
 	}
 
-	bool Database::Load(const EngineInfo& engineInfo)
+	[[nodiscard]] static IO::Path GetAssetsDatabasePath(const EngineInfo& engineInfo)
 	{
-		const IO::Path assetsDatabasePath = IO::Path::Combine(
+		return IO::Path::Combine(
 			engineInfo.GetDirectory(),
 			IO::Path::Merge(EngineInfo::EngineAssetsPath, Database::AssetFormat.metadataFileExtension)
 		);
+	}
+
+	[[nodiscard]] static IO::Path GetAssetsDatabasePath(const ProjectInfo& projectInfo)
+	{
+		return IO::Path::Combine(
+			projectInfo.GetDirectory(),
+			IO::Path::Merge(projectInfo.GetRelativeAssetDirectory(), Database::AssetFormat.metadataFileExtension)
+		);
+	}
+
+	[[nodiscard]] static IO::Path GetAssetsDatabasePath(const PluginInfo& plugin)
+	{
+		return IO::Path::Combine(
+			plugin.GetDirectory(),
+			IO::Path::Merge(plugin.GetRelativeAssetDirectory(), Database::AssetFormat.metadataFileExtension)
+		);
+	}
+
+	bool Database::Load(const EngineInfo& engineInfo)
+	{
+		const IO::Path assetsDatabasePath = GetAssetsDatabasePath(engineInfo);
 		if (assetsDatabasePath.Exists())
 		{
-			Serialization::Data data(assetsDatabasePath);
-			if (data.IsValid())
-			{
-				return Load(data, assetsDatabasePath.GetParentPath());
-			}
+			return Load(assetsDatabasePath, assetsDatabasePath.GetParentPath());
 		}
 		return false;
 	}
 
 	bool Database::Load(const ProjectInfo& projectInfo)
 	{
-		const IO::Path assetsDatabasePath = IO::Path::Combine(
-			projectInfo.GetDirectory(),
-			IO::Path::Merge(projectInfo.GetRelativeAssetDirectory(), Database::AssetFormat.metadataFileExtension)
-		);
+		const IO::Path assetsDatabasePath = GetAssetsDatabasePath(projectInfo);
 		if (assetsDatabasePath.Exists())
 		{
-			Serialization::Data data(assetsDatabasePath);
-			if (data.IsValid())
+			if (Load(assetsDatabasePath, assetsDatabasePath.GetParentPath()))
 			{
-				return Load(data, assetsDatabasePath.GetParentPath());
+				return true;
 			}
 			else
 			{
-				LogError("Could not parse database {}. The file most likely contains invalid json.", assetsDatabasePath.GetView());
+				LogError("Could not load database {}. The file most likely contains invalid json.", assetsDatabasePath.GetView());
 			}
 		}
 		else
@@ -241,31 +289,34 @@ namespace ngine::Asset
 
 	bool Database::Load(const PluginInfo& plugin)
 	{
-		const IO::Path assetsDatabasePath = IO::Path::Combine(
-			plugin.GetDirectory(),
-			IO::Path::Merge(plugin.GetRelativeAssetDirectory(), Database::AssetFormat.metadataFileExtension)
-		);
+		const IO::Path assetsDatabasePath = GetAssetsDatabasePath(plugin);
 		if (assetsDatabasePath.Exists())
 		{
-			Serialization::Data data(assetsDatabasePath);
-			if (data.IsValid())
-			{
-				return Load(data, assetsDatabasePath.GetParentPath());
-			}
+			return Load(assetsDatabasePath, assetsDatabasePath.GetParentPath());
 		}
 		return false;
 	}
 
 	bool Database::Generate(const EngineInfo& engineInfo)
+	{
+		return Generate(engineInfo, nullptr);
+	}
+
+	bool Database::Generate(const EngineInfo& engineInfo, const Optional<DatabaseStamps*> pStamps)
 	{
 		const IO::PathView rootFolder = engineInfo.GetDirectory();
 		RegisterAsset(engineInfo.GetGuid(), DatabaseEntry{engineInfo}, rootFolder);
 
 		const IO::Path engineAssetsPath = IO::Path::Combine(engineInfo.GetDirectory(), EngineInfo::EngineAssetsPath);
-		return RegisterAllAssetsInDirectory(engineAssetsPath, rootFolder);
+		return ScanAssetsInDirectory(engineAssetsPath, rootFolder, pStamps);
 	}
 
 	bool Database::Generate(const ProjectInfo& projectInfo)
+	{
+		return Generate(projectInfo, nullptr);
+	}
+
+	bool Database::Generate(const ProjectInfo& projectInfo, const Optional<DatabaseStamps*> pStamps)
 	{
 		const IO::PathView rootFolder = projectInfo.GetDirectory();
 		RegisterAsset(projectInfo.GetGuid(), DatabaseEntry{projectInfo}, rootFolder);
@@ -287,39 +338,86 @@ namespace ngine::Asset
 		}
 
 		const IO::Path projectAssetsFolder = IO::Path::Combine(projectInfo.GetDirectory(), projectInfo.GetRelativeAssetDirectory());
-		return RegisterAllAssetsInDirectory(projectAssetsFolder, rootFolder);
+		return ScanAssetsInDirectory(projectAssetsFolder, rootFolder, pStamps);
 	}
 
 	bool Database::Generate(const PluginInfo& plugin)
+	{
+		return Generate(plugin, nullptr);
+	}
+
+	bool Database::Generate(const PluginInfo& plugin, const Optional<DatabaseStamps*> pStamps)
 	{
 		const IO::PathView rootFolder = plugin.GetDirectory();
 		RegisterAsset(plugin.GetGuid(), DatabaseEntry{plugin}, rootFolder);
 
 		const IO::Path projectAssetsFolder = IO::Path::Combine(plugin.GetDirectory(), plugin.GetRelativeAssetDirectory());
-		return RegisterAllAssetsInDirectory(projectAssetsFolder, rootFolder);
+		return ScanAssetsInDirectory(projectAssetsFolder, rootFolder, pStamps);
+	}
+
+	bool Database::ScanAssetsInDirectory(
+		const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory, const Optional<DatabaseStamps*> pStamps
+	)
+	{
+		if (pStamps.IsValid())
+		{
+			return UpdateAllAssetsInDirectory(directory, databaseRootDirectory, *pStamps);
+		}
+		return RegisterAllAssetsInDirectory(directory, databaseRootDirectory);
 	}
 
 	bool Database::LoadAndGenerate(const EngineInfo& engineInfo)
 	{
 		Load(engineInfo);
-		m_assetMap.Clear();
+		ClearEntries();
 		return Generate(engineInfo);
 	}
 
 	bool Database::LoadAndGenerate(const ProjectInfo& projectInfo)
 	{
 		Load(projectInfo);
-		m_assetMap.Clear();
+		ClearEntries();
 		return Generate(projectInfo);
 	}
 
 	bool Database::LoadAndGenerate(const PluginInfo& plugin)
 	{
 		Load(plugin);
-		m_assetMap.Clear();
+		ClearEntries();
 		return Generate(plugin);
 	}
 
+	bool Database::LoadAndUpdate(const EngineInfo& engineInfo, DatabaseStamps& stamps)
+	{
+		// Stamps are only valid together with the database they were saved with
+		if (!Load(engineInfo) || !stamps.Load(GetAssetsDatabasePath(engineInfo)))
+		{
+			ClearEntries();
+			stamps.Clear();
+		}
+		return Generate(engineInfo, &stamps);
+	}
+
+	bool Database::LoadAndUpdate(const ProjectInfo& projectInfo, DatabaseStamps& stamps)
+	{
+		if (!Load(projectInfo) || !stamps.Load(GetAssetsDatabasePath(projectInfo)))
+		{
+			ClearEntries();
+			stamps.Clear();
+		}
+		return Generate(projectInfo, &stamps);
+	}
+
+	bool Database::LoadAndUpdate(const PluginInfo& plugin, DatabaseStamps& stamps)
+	{
+		if (!Load(plugin) || !stamps.Load(GetAssetsDatabasePath(plugin)))
+		{
+			ClearEntries();
+			stamps.Clear();
+		}
+		return Generate(plugin, &stamps);
+	}
+
 	void Database::Import(const Database& other)
 	{
 		m_assetMap.Reserve(m_assetMap.GetSize() + other.m_assetMap.GetSize());
@@ -327,7 +425,7 @@ namespace ngine::Asset
 
 		for (const auto& entryPair : other.m_assetMap)
 		{
-			m_assetMap.EmplaceOrAssign(Guid(entryPair.first), DatabaseEntry{entryPair.second});
+			EmplaceEntry(entryPair.first, DatabaseEntry{entryPair.second});
 		}
 
 		for (const Guid importedAssetGuid : other.m_importedAssets)
@@ -336,15 +434,20 @@ namespace ngine::Asset
 		}
 	}
 
+	[[nodiscard]] static bool IsAssetMetaDataFile(const IO::PathView filePath)
+	{
+		const IO::PathView fileExtension = filePath.GetRightMostExtension();
+		return fileExtension == Asset::Asset::FileExtension || fileExtension == ProjectAssetFormat.metadataFileExtension ||
+		       fileExtension == PluginAssetFormat.metadataFileExtension || fileExtension == Database::AssetFormat.metadataFileExtension;
+	}
+
 	void Database::FindAssetsInDirectory(const IO::ConstZeroTerminatedPathView directory, AssetDiscoveryCallback&& callback)
 	{
 		IO::FileIterator::TraverseDirectoryRecursive(
 			directory,
 			[&callback](IO::Path&& filePath) -> IO::FileIterator::TraversalResult
 			{
-				const IO::PathView fileExtension = filePath.GetRightMostExtension();
-
-				if ((fileExtension == Asset::Asset::FileExtension || fileExtension == ProjectAssetFormat.metadataFileExtension || fileExtension == PluginAssetFormat.metadataFileExtension || fileExtension == Database::AssetFormat.metadataFileExtension) && filePath.IsFile())
+				if (IsAssetMetaDataFile(filePath) && filePath.IsFile())
 				{
 					callback(Forward<IO::Path>(filePath));
 				}
@@ -354,70 +457,625 @@ namespace ngine::Asset
 		);
 	}
 
-	bool Database::RegisterAllAssetsInDirectory(const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory)
+	//! Queues the batch and blocks until it has finished
+	//! When called from a job runner the runner keeps executing queued jobs while waiting, so the batch can't be starved by the wait
+	//! Other threads sleep until the finished stage of the batch wakes them up
+	static void QueueAndWait(Threading::JobManager& jobManager, Threading::JobBatch& jobBatch, const Threading::JobPriority priority)
 	{
-		// Maintain a set to validate that no duplicate guids are found
-		Internal::AssetSet foundAssets;
-		bool success{true};
+		const Optional<Threading::JobRunnerThread*> pCurrentThread = Threading::JobRunnerThread::GetCurrent();
+		if (pCurrentThread.IsValid())
+		{
+			Threading::Atomic<bool> isFinished{false};
+			jobBatch.QueueAsNewFinishedStage(Threading::CreateCallback(
+				[&isFinished](Threading::JobRunnerThread&)
+				{
+					isFinished = true;
+				},
+				priority
+			));
+			jobManager.Queue(jobBatch, priority);
 
-		FindAssetsInDirectory(
-			directory,
-			[this, databaseRootDirectory, &foundAssets, &success](IO::Path&& filePath) mutable
+			while (!isFinished)
 			{
-				Serialization::Data assetData(filePath);
-				success &= assetData.IsValid();
-				if (assetData.IsValid())
+				if (!pCurrentThread->DoRunNextJob())
 				{
-					Asset asset(assetData, Move(filePath));
-					// success &= asset.IsValid();
-				  // if(asset.IsValid())
+					Threading::Sleep(0);
+				}
+			}
+		}
+		else
+		{
+			Threading::Mutex mutex;
+			Threading::ConditionVariable finishedConditionVariable;
+			bool isFinished{false};
+			jobBatch.QueueAsNewFinishedStage(Threading::CreateCallback(
+				[&mutex, &finishedConditionVariable, &isFinished](Threading::JobRunnerThread&)
+				{
+					// Notify while holding the lock, the waiter destroys the condition variable as soon as it can observe the flag
+					Threading::UniqueLock lock(mutex);
+					isFinished = true;
+					finishedConditionVariable.NotifyAll();
+				},
+				priority
+			));
+			jobManager.Queue(jobBatch, priority);
+
+			Threading::UniqueLock lock(mutex);
+			while (!isFinished)
+			{
+				finishedConditionVariable.Wait(lock);
+			}
+		}
+	}
+
+	//! Directory whose assets are discovered by a single job, including all of its subdirectories
+	struct DirectoryScan
+	{
+		IO::Path m_directory;
+		Vector<IO::Path> m_filePaths;
+	};
+
+	//! Metadata of a discovered asset file, parsed on a job runner and merged into the database in path order
+	struct ParsedAsset
+	{
+		IO::Path m_filePath;
+		//! Modification time of the file before it was parsed, only used when updating stamps
+		Time::Timestamp m_modifiedTime;
+		Guid m_guid;
+		DatabaseEntry m_entry;
+		bool m_isValid{false};
+	};
+
+	//! Finds all asset metadata files in the directory, sorted by path so that the results don't depend on file system or job order
+	[[nodiscard]] static Vector<IO::Path> FindAllAssetsInDirectory(const IO::ConstZeroTerminatedPathView directory)
+	{
+		Vector<IO::Path> filePaths;
+
+		Optional<Threading::JobManager*> pJobManager = System::Find<Threading::JobManager>();
+		if (pJobManager.IsInvalid())
+		{
+			Database::FindAssetsInDirectory(
+				directory,
+				[&filePaths](IO::Path&& filePath)
+				{
+					filePaths.EmplaceBack(Forward<IO::Path>(filePath));
+				}
+			);
+		}
+		else
+		{
+			// Expand the directory tree breadth first until there are enough subdirectories to keep all runners busy
+			// Files found along the way are collected directly, every remaining subdirectory is then scanned recursively by its own job
+			const uint32 desiredDirectoryCount = pJobManager->GetJobThreads().GetSize() * 4u;
+			constexpr uint8 MaximumExpansionDepth = 3;
+
+			Vector<DirectoryScan> directoryScans;
+			directoryScans.EmplaceBack(DirectoryScan{IO::Path(directory), {}});
+			for (uint8 depth = 0; depth < MaximumExpansionDepth && directoryScans.HasElements() &&
+			                      directoryScans.GetSize() < desiredDirectoryCount;
+			     ++depth)
+			{
+				Vector<DirectoryScan> subdirectoryScans;
+				for (const DirectoryScan& directoryScan : directoryScans)
+				{
+					for (IO::FileIterator fileIterator(directoryScan.m_directory); !fileIterator.ReachedEnd(); fileIterator.Next())
 					{
-						const bool foundAsset = foundAssets.Contains(asset.GetGuid());
-						success &= !foundAsset;
-						if (LIKELY(!foundAsset))
+						// Skip internal files
+						if (fileIterator.GetCurrentFileName()[0] == MAKE_NATIVE_LITERAL('.'))
 						{
-							foundAssets.Emplace(Guid(asset.GetGuid()));
+							continue;
 						}
-						else
+
+						switch (fileIterator.GetCurrentFileType())
 						{
-							LogWarning(
-								"Found duplicate asset {} (in {}) in directory {}",
-								asset.GetGuid(),
-								asset.GetMetaDataFilePath(),
-								databaseRootDirectory
-							);
+							case IO::FileType::File:
+							{
+								IO::Path filePath = fileIterator.GetCurrentFilePath();
+								if (IsAssetMetaDataFile(filePath))
+								{
+									filePaths.EmplaceBack(Move(filePath));
+								}
+							}
+							break;
+							case IO::FileType::Directory:
+								subdirectoryScans.EmplaceBack(DirectoryScan{fileIterator.GetCurrentFilePath(), {}});
+								break;
+							case IO::FileType::Unknown:
+								break;
 						}
+					}
+				}
+				directoryScans = Move(subdirectoryScans);
+			}
 
-						if (const Optional<DatabaseEntry*> pAssetEntry = GetAssetEntry(asset.GetGuid()))
+			if (directoryScans.HasElements())
+			{
+				// Each job only writes the buffer of its own directory, so no synchronization is needed until all jobs finished
+				Threading::JobBatch jobBatch = Threading::ParallelFor(
+					directoryScans.GetView(),
+					[](const ArrayView<DirectoryScan> directoryScansChunk)
+					{
+						for (DirectoryScan& directoryScan : directoryScansChunk)
 						{
-							*pAssetEntry = DatabaseEntry{asset};
-							pAssetEntry->m_path.MakeRelativeToParent(databaseRootDirectory);
+							Database::FindAssetsInDirectory(
+								directoryScan.m_directory,
+								[&filePaths = directoryScan.m_filePaths](IO::Path&& filePath)
+								{
+									filePaths.EmplaceBack(Forward<IO::Path>(filePath));
+								}
+							);
 						}
-						else
+					},
+					Threading::JobPriority::LoadProject
+				);
+				QueueAndWait(*pJobManager, jobBatch, Threading::JobPriority::LoadProject);
+
+				uint32 totalFileCount = filePaths.GetSize();
+				for (const DirectoryScan& directoryScan : directoryScans)
+				{
+					totalFileCount += directoryScan.m_filePaths.GetSize();
+				}
+				filePaths.Reserve(totalFileCount);
+				for (DirectoryScan& directoryScan : directoryScans)
+				{
+					for (IO::Path& filePath : directoryScan.m_filePaths)
+					{
+						filePaths.EmplaceBack(Move(filePath));
+					}
+				}
+			}
+		}
+
+		Algorithms::Sort(
+			filePaths.begin().Get(),
+			filePaths.end().Get(),
+			[](const IO::Path& left, const IO::Path& right)
+			{
+				return left.GetView() < right.GetView();
+			}
+		);
+		return filePaths;
+	}
+
+	static void ParseAssets(const ArrayView<ParsedAsset> parsedAssets)
+	{
+		for (ParsedAsset& parsedAsset : parsedAssets)
+		{
+			Serialization::Data assetData(parsedAsset.m_filePath);
+			if (assetData.IsValid())
+			{
+				Asset asset(assetData, IO::Path(parsedAsset.m_filePath));
+				parsedAsset.m_guid = asset.GetGuid();
+				parsedAsset.m_entry = DatabaseEntry{asset};
+				parsedAsset.m_isValid = true;
+			}
+		}
+	}
+
+	//! Parses the metadata of each file into its own slot, in parallel when a job manager is available
+	static void ParseAllAssets(const ArrayView<ParsedAsset> parsedAssets)
+	{
+		constexpr uint32 MinimumParseChunkSize = 16;
+		if (const Optional<Threading::JobManager*> pJobManager = System::Find<Threading::JobManager>();
+		    pJobManager.IsValid() && parsedAssets.GetSize() > MinimumParseChunkSize)
+		{
+			Threading::JobBatch jobBatch = Threading::ParallelFor(
+				parsedAssets,
+				[](const ArrayView<ParsedAsset> parsedAssetsChunk)
+				{
+					ParseAssets(parsedAssetsChunk);
+				},
+				Threading::JobPriority::LoadProject,
+				MinimumParseChunkSize
+			);
+			QueueAndWait(*pJobManager, jobBatch, Threading::JobPriority::LoadProject);
+		}
+		else
+		{
+			ParseAssets(parsedAssets);
+		}
+	}
+
+	bool Database::RegisterAllAssetsInDirectory(const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory)
+	{
+		Vector<IO::Path> filePaths = FindAllAssetsInDirectory(directory);
+
+		Vector<ParsedAsset> parsedAssets(Memory::Reserve, filePaths.GetSize());
+		for (IO::Path& filePath : filePaths)
+		{
+			parsedAssets.EmplaceBack(ParsedAsset{Move(filePath)});
+		}
+
+		// Metadata is parsed in parallel into the slot of each file, and then merged serially in path order
+		ParseAllAssets(parsedAssets.GetView());
+
+		// Maintain a set to validate that no duplicate guids are found
+		Internal::AssetSet foundAssets;
+		foundAssets.Reserve(parsedAssets.GetSize());
+		m_assetMap.Reserve(m_assetMap.GetSize() + parsedAssets.GetSize());
+		bool success{true};
+
+		for (ParsedAsset& parsedAsset : parsedAssets)
+		{
+			success &= parsedAsset.m_isValid;
+			if (parsedAsset.m_isValid)
+			{
+				const bool foundAsset = foundAssets.Contains(parsedAsset.m_guid);
+				success &= !foundAsset;
+				if (LIKELY(!foundAsset))
+				{
+					foundAssets.Emplace(Guid(parsedAsset.m_guid));
+				}
+				else
+				{
+					LogWarning("Found duplicate asset {} (in {}) in directory {}", parsedAsset.m_guid, parsedAsset.m_filePath, databaseRootDirectory);
+				}
+
+				RegisterAsset(parsedAsset.m_guid, Move(parsedAsset.m_entry), databaseRootDirectory);
+			}
+			else
+			{
+				LogWarning("Found invalid JSON in asset {}", parsedAsset.m_filePath);
+			}
+		}
+
+		return success;
+	}
+
+	//! Checks whether the asset is still registered from the specified metadata file, and not by another file declaring the same guid
+	[[nodiscard]] static bool
+	IsAssetOwnedByFile(const Database& database, const Guid assetGuid, const IO::PathView filePath, const IO::PathView databaseRootDirectory)
+	{
+		const Optional<const DatabaseEntry*> pAssetEntry = database.GetAssetEntry(assetGuid);
+		if (pAssetEntry.IsInvalid())
+		{
+			return false;
+		}
+
+		// Registered entries are relative to the root directory, while loaded entries are absolute
+		const IO::PathView entryPath = pAssetEntry->m_path.GetView();
+		return entryPath == filePath || entryPath == filePath.GetRelativeToParent(databaseRootDirectory);
+	}
+
+	static void
+	RemoveStampedFile(Database& database, DatabaseStamps& stamps, const IO::PathView filePath, const IO::PathView databaseRootDirectory)
+	{
+		const DatabaseStamps::FileMap::iterator it = stamps.m_files.Find(IO::Path(filePath));
+		if (it != stamps.m_files.end())
+		{
+			if (it->second.m_assetGuid.IsValid() && IsAssetOwnedByFile(database, it->second.m_assetGuid, filePath, databaseRootDirectory))
+			{
+				database.RemoveAsset(it->second.m_assetGuid);
+			}
+			stamps.m_files.Remove(it);
+		}
+	}
+
+	static void
+	RemoveStampedDirectory(Database& database, DatabaseStamps& stamps, const IO::PathView directory, const IO::PathView databaseRootDirectory)
+	{
+		const DatabaseStamps::DirectoryMap::iterator it = stamps.m_directories.Find(IO::Path(directory));
+		if (it == stamps.m_directories.end())
+		{
+			return;
+		}
+
+		const DatabaseStamps::DirectoryStamp directoryStamp = Move(it->second);
+		stamps.m_directories.Remove(it);
+		for (const IO::Path& fileName : directoryStamp.m_fileNames)
+		{
+			RemoveStampedFile(database, stamps, IO::Path::Combine(directory, fileName), databaseRootDirectory);
+		}
+		for (const IO::Path& subdirectoryName : directoryStamp.m_subdirectoryNames)
+		{
+			RemoveStampedDirectory(database, stamps, IO::Path::Combine(directory, subdirectoryName), databaseRootDirectory);
+		}
+	}
+
+	//! Walks the directory tree using the recorded stamps and collects the files that need to be parsed again
+	//! Directories are only listed again if their modification time changed, otherwise the recorded file and subdirectory names are used.
+	static void UpdateDirectory(
+		Database& database,
+		DatabaseStamps& stamps,
+		const IO::Path& directory,
+		const IO::PathView databaseRootDirectory,
+		const Time::Timestamp previousUpdateTime,
+		Vector<ParsedAsset>& changedAssets
+	)
+	{
+		if (!directory.IsDirectory())
+		{
+			RemoveStampedDirectory(database, stamps, directory, databaseRootDirectory);
+			return;
+		}
+
+		const Time::Timestamp modifiedTime = directory.GetLastModifiedTime();
+		DatabaseStamps::DirectoryMap::iterator it = stamps.m_directories.Find(directory);
+		if (it == stamps.m_directories.end() || !DatabaseStamps::IsUnchanged(it->second.m_modifiedTime, modifiedTime, previousUpdateTime))
+		{
+			DatabaseStamps::DirectoryStamp directoryStamp{modifiedTime};
+			for (IO::FileIterator fileIterator(directory); !fileIterator.ReachedEnd(); fileIterator.Next())
+			{
+				const IO::PathView fileName = fileIterator.GetCurrentFileName();
+				// Skip internal files
+				if (fileName[0] == MAKE_NATIVE_LITERAL('.'))
+				{
+					continue;
+				}
+
+				switch (fileIterator.GetCurrentFileType())
+				{
+					case IO::FileType::File:
+						if (IsAssetMetaDataFile(fileName))
 						{
-							RegisterAsset(asset.GetGuid(), DatabaseEntry{asset}, databaseRootDirectory);
+							directoryStamp.m_fileNames.EmplaceBack(IO::Path(fileName));
 						}
+						break;
+					case IO::FileType::Directory:
+						directoryStamp.m_subdirectoryNames.EmplaceBack(IO::Path(fileName));
+						break;
+					case IO::FileType::Unknown:
+						break;
+				}
+			}
+
+			if (it != stamps.m_directories.end())
+			{
+				// Removing entries invalidates the iterator, so take the previous stamp out first
+				const DatabaseStamps::DirectoryStamp previousDirectoryStamp = Move(it->second);
+				for (const IO::Path& fileName : previousDirectoryStamp.m_fileNames)
+				{
+					if (!directoryStamp.m_fileNames.GetView().Contains(fileName))
+					{
+						RemoveStampedFile(database, stamps, IO::Path::Combine(directory, fileName), databaseRootDirectory);
 					}
-					/*else
-				  {
-				      LogWarning("Encountered invalid asset {}, is it missing 'guid' or 'assetTypeGuid'?", asset.GetMetaDataFilePath());
-				  }*/
 				}
-				else
+				for (const IO::Path& subdirectoryName : previousDirectoryStamp.m_subdirectoryNames)
 				{
-					LogWarning("Found invalid JSON in asset {}", filePath);
+					if (!directoryStamp.m_subdirectoryNames.GetView().Contains(subdirectoryName))
+					{
+						RemoveStampedDirectory(database, stamps, IO::Path::Combine(directory, subdirectoryName), databaseRootDirectory);
+					}
 				}
 			}
-		);
 
+			it = stamps.m_directories.EmplaceOrAssign(IO::Path(directory), Move(directoryStamp));
+		}
+
+		for (const IO::Path& fileName : it->second.m_fileNames)
+		{
+			IO::Path filePath = IO::Path::Combine(directory, fileName);
+			const Time::Timestamp fileModifiedTime = filePath.GetLastModifiedTime();
+			const DatabaseStamps::FileMap::const_iterator fileIt = stamps.m_files.Find(filePath);
+			const bool isUnchanged = fileIt != stamps.m_files.end() &&
+			                         DatabaseStamps::IsUnchanged(fileIt->second.m_modifiedTime, fileModifiedTime, previousUpdateTime) &&
+			                         database.HasAsset(fileIt->second.m_assetGuid);
+			if (!isUnchanged)
+			{
+				changedAssets.EmplaceBack(ParsedAsset{Move(filePath), fileModifiedTime});
+			}
+		}
+
+		// Recursing adds to the directory map, so the names can't be accessed through the iterator
+		const Vector<IO::Path> subdirectoryNames(it->second.m_subdirectoryNames);
+		for (const IO::Path& subdirectoryName : subdirectoryNames)
+		{
+			UpdateDirectory(
+				database,
+				stamps,
+				IO::Path::Combine(directory, subdirectoryName),
+				databaseRootDirectory,
+				previousUpdateTime,
+				changedAssets
+			);
+		}
+	}
+
+	//! Registers parsed assets and records their stamps, replacing the asset previously registered for the same file
+	[[nodiscard]] static bool RegisterChangedAssets(
+		Database& database, DatabaseStamps& stamps, const ArrayView<ParsedAsset> changedAssets, const IO::PathView databaseRootDirectory
+	)
+	{
+		bool success{true};
+		for (ParsedAsset& changedAsset : changedAssets)
+		{
+			const DatabaseStamps::FileMap::iterator fileIt = stamps.m_files.Find(changedAsset.m_filePath);
+			const Guid previousAssetGuid = fileIt != stamps.m_files.end() ? fileIt->second.m_assetGuid : Guid();
+			if (!changedAsset.m_isValid)
+			{
+				LogWarning("Found invalid JSON in asset {}", changedAsset.m_filePath);
+				success = false;
+
+				// Don't record a stamp, so that the file is parsed again on the next update
+				RemoveStampedFile(database, stamps, changedAsset.m_filePath, databaseRootDirectory);
+				continue;
+			}
+
+			// Only remove the previous asset if this file still owns it, another file may have registered the guid since
+			if (previousAssetGuid.IsValid() && previousAssetGuid != changedAsset.m_guid &&
+			    IsAssetOwnedByFile(database, previousAssetGuid, changedAsset.m_filePath, databaseRootDirectory))
+			{
+				database.RemoveAsset(previousAssetGuid);
+			}
+
+			// Files must not take over an asset owned by another file
+			if (database.HasAsset(changedAsset.m_guid) &&
+			    !IsAssetOwnedByFile(database, changedAsset.m_guid, changedAsset.m_filePath, databaseRootDirectory))
+			{
+				LogWarning(
+					"Found duplicate asset {} (in {}) in directory {}",
+					changedAsset.m_guid,
+					changedAsset.m_filePath,
+					databaseRootDirectory
+				);
+				success = false;
+
+				// Record the file without an asset, so that it is parsed again on the next update and deleting it leaves the owner alone
+				stamps.m_files.EmplaceOrAssign(Move(changedAsset.m_filePath), DatabaseStamps::FileStamp{changedAsset.m_modifiedTime, Guid()});
+				continue;
+			}
+
+			database.RegisterAsset(changedAsset.m_guid, Move(changedAsset.m_entry), databaseRootDirectory);
+			stamps.m_files.EmplaceOrAssign(
+				Move(changedAsset.m_filePath),
+				DatabaseStamps::FileStamp{changedAsset.m_modifiedTime, changedAsset.m_guid}
+			);
+		}
 		return success;
 	}
 
+	bool Database::UpdateAllAssetsInDirectory(
+		const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory, DatabaseStamps& stamps
+	)
+	{
+		const Time::Timestamp previousUpdateTime = stamps.StartUpdate();
+
+		Vector<ParsedAsset> changedAssets;
+		UpdateDirectory(*this, stamps, IO::Path(directory), databaseRootDirectory, previousUpdateTime, changedAssets);
+
+		// Sort so that changes are applied in the same order as a full scan would
+		Algorithms::Sort(
+			changedAssets.begin().Get(),
+			changedAssets.end().Get(),
+			[](const ParsedAsset& left, const ParsedAsset& right)
+			{
+				return left.m_filePath.GetView() < right.m_filePath.GetView();
+			}
+		);
+		ParseAllAssets(changedAssets.GetView());
+		return RegisterChangedAssets(*this, stamps, changedAssets.GetView(), databaseRootDirectory);
+	}
+
+	void Database::ApplyFileChange(
+		const IO::ConstZeroTerminatedPathView changedPath, const IO::PathView databaseRootDirectory, DatabaseStamps& stamps
+	)
+	{
+		const IO::Path path(changedPath);
+
+		// The listing of the parent directory is out of date, make sure it is listed again on the next update
+		if (const DatabaseStamps::DirectoryMap::iterator it = stamps.m_directories.Find(IO::Path(path.GetParentPath()));
+		    it != stamps.m_directories.end())
+		{
+			it->second.m_modifiedTime = {};
+		}
+
+		if (path.IsDirectory() || stamps.m_directories.Contains(path))
+		{
+			// A directory was added, removed or renamed, so its whole tree has to be updated
+			Vector<ParsedAsset> changedAssets;
+			UpdateDirectory(*this, stamps, path, databaseRootDirectory, stamps.m_updateTime, changedAssets);
+			ParseAllAssets(changedAssets.GetView());
+			[[maybe_unused]] const bool registeredAll = RegisterChangedAssets(*this, stamps, changedAssets.GetView(), databaseRootDirectory);
+		}
+		else if (IsAssetMetaDataFile(path))
+		{
+			if (path.IsFile())
+			{
+				ParsedAsset changedAsset{IO::Path(path), path.GetLastModifiedTime()};
+				ParseAssets(ArrayView<ParsedAsset>(changedAsset));
+				[[maybe_unused]] const bool registered =
+					RegisterChangedAssets(*this, stamps, ArrayView<ParsedAsset>(changedAsset), databaseRootDirectory);
+			}
+			else
+			{
+				RemoveStampedFile(*this, stamps, path, databaseRootDirectory);
+			}
+		}
+	}
+
 	DatabaseEntry& Database::RegisterAsset(const Guid assetGuid, DatabaseEntry&& entry, const IO::PathView databaseRootDirectory)
 	{
 		Assert(assetGuid.IsValid());
 		entry.m_path.MakeRelativeToParent(databaseRootDirectory);
-		return m_assetMap.EmplaceOrAssign(Guid(assetGuid), Forward<DatabaseEntry>(entry))->second;
+		return EmplaceEntry(assetGuid, Forward<DatabaseEntry>(entry));
+	}
+
+	DatabaseEntry& Database::EmplaceEntry(const Guid assetGuid, DatabaseEntry&& entry)
+	{
+		const decltype(m_assetMap)::iterator it = m_assetMap.Find(assetGuid);
+		if (it != m_assetMap.end())
+		{
+			RemoveFromIndices(assetGuid, it->second);
+			it->second = Forward<DatabaseEntry>(entry);
+			AddToIndices(assetGuid, it->second);
+			return it->second;
+		}
+
+		DatabaseEntry& newEntry = m_assetMap.Emplace(Guid(assetGuid), Forward<DatabaseEntry>(entry))->second;
+		AddToIndices(assetGuid, newEntry);
+		return newEntry;
+	}
+
+	void Database::ClearEntries()
+	{
+		m_assetMap.Clear();
+		m_assetTypeIndex.Clear();
+		m_componentTypeIndex.Clear();
+		m_tagIndex.Clear();
+	}
+
+	void Database::AddToIndices(const Guid assetGuid, const DatabaseEntry& entry)
+	{
+		m_assetTypeIndex.Add(entry.m_assetTypeGuid, assetGuid);
+		m_componentTypeIndex.Add(entry.m_componentTypeGuid, assetGuid);
+		for (const Tag::Guid tagGuid : entry.m_tags)
+		{
+			m_tagIndex.Add(tagGuid, assetGuid);
+		}
+	}
+
+	void Database::RemoveFromIndices(const Guid assetGuid, const DatabaseEntry& entry)
+	{
+		m_assetTypeIndex.Remove(entry.m_assetTypeGuid, assetGuid);
+		m_componentTypeIndex.Remove(entry.m_componentTypeGuid, assetGuid);
+		for (const Tag::Guid tagGuid : entry.m_tags)
+		{
+			m_tagIndex.Remove(tagGuid, assetGuid);
+		}
+	}
+
+	void Database::RebuildIndices()
+	{
+		m_assetTypeIndex.Clear();
+		m_componentTypeIndex.Clear();
+		m_tagIndex.Clear();
+		for (const auto& entryPair : m_assetMap)
+		{
+			AddToIndices(entryPair.first, entryPair.second);
+		}
+	}
+
+	namespace Internal
+	{
+		void AssetIndex::Add(const Guid key, const Guid assetGuid)
+		{
+			if (key.IsValid())
+			{
+				iterator it = Find(key);
+				if (it == end())
+				{
+					it = Emplace(Guid(key), AssetSet{});
+				}
+				it->second.Emplace(Guid(assetGuid));
+			}
+		}
+
+		void AssetIndex::Remove(const Guid key, const Guid assetGuid)
+		{
+			const iterator it = Find(key);
+			if (it != end())
+			{
+				const AssetSet::iterator assetIt = it->second.Find(assetGuid);
+				if (assetIt != it->second.end())
+				{
+					it->second.Remove(assetIt);
+				}
+				if (it->second.IsEmpty())
+				{
+					UnorderedMap::Remove(it);
+				}
+			}
+		}
 	}
 
 	void Database::ImportAsset(const Guid assetGuid)
@@ -441,6 +1099,7 @@ namespace ngine::Asset
 		const decltype(m_assetMap)::iterator it = m_assetMap.Find(assetGuid);
 		if (it != m_assetMap.end())
 		{
+			RemoveFromIndices(assetGuid, it->second);
 			DatabaseEntry entry = Move(it->second);
 			m_assetMap.Remove(it);
 			return entry;
@@ -463,6 +1122,7 @@ namespace ngine::Asset
 		reader.Serialize("guid", m_guid);
 		bool serializedAny = reader.Serialize("imported_assets", m_importedAssets);
 		serializedAny |= reader.SerializeInPlace(m_assetMap, prefix);
+		RebuildIndices();
 		return serializedAny;
 	}
 
@@ -488,6 +1148,7 @@ namespace ngine::Asset
 			if (otherDatabase.HasAsset(assetGuid))
 			{
 				Assert(!m_importedAssets.Contains(assetGuid));
+				RemoveFromIndices(assetGuid, it->second);
 				it = m_assetMap.Remove(it);
 				endIt = m_assetMap.end();
 
@@ -0,0 +1,46 @@
+#include "Asset/AssetDatabaseMonitor.h"
+#include "Asset/AssetDatabase.h"
+#include "Asset/AssetDatabaseStamps.h"
+
+#include <Common/IO/FileChangeListener.h>
+
+namespace ngine::Asset
+{
+	DatabaseMonitor::DatabaseMonitor(Database& database, DatabaseStamps& stamps, const IO::PathView databaseRootDirectory)
+		: m_database(database)
+		, m_stamps(stamps)
+		, m_databaseRootDirectory(databaseRootDirectory)
+	{
+	}
+
+	void DatabaseMonitor::MonitorDirectory(IO::FileChangeListener& fileChangeListener, const IO::Path& directory)
+	{
+		fileChangeListener.MonitorDirectory(
+			directory,
+			IO::FileChangeListeners{
+				[this](const IO::PathView directoryPath, const IO::PathView relativeChangedPath)
+				{
+					OnChanged(directoryPath, relativeChangedPath);
+				},
+				[this](const IO::PathView directoryPath, const IO::PathView relativeChangedPath)
+				{
+					OnChanged(directoryPath, relativeChangedPath);
+				},
+				[this](const IO::PathView directoryPath, const IO::PathView relativeChangedPath)
+				{
+					OnChanged(directoryPath, relativeChangedPath);
+				},
+				[this](const IO::PathView directoryPath, const IO::PathView relativePreviousPath, const IO::PathView relativeNewPath)
+				{
+					OnChanged(directoryPath, relativePreviousPath);
+					OnChanged(directoryPath, relativeNewPath);
+				}
+			}
+		);
+	}
+
+	void DatabaseMonitor::OnChanged(const IO::PathView directoryPath, const IO::PathView relativeChangedPath)
+	{
+		m_database.ApplyFileChange(IO::Path::Combine(directoryPath, relativeChangedPath), m_databaseRootDirectory, m_stamps);
+	}
+}
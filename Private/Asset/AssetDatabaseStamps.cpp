@@ -0,0 +1,148 @@
+#include "Asset/AssetDatabaseStamps.h"
+
+#include <Common/Serialization/Deserialize.h>
+#include <Common/Serialization/Serialize.h>
+#include <Common/Serialization/Guid.h>
+#include <Common/Memory/Containers/Serialization/Vector.h>
+#include <Common/Algorithms/Sort.h>
+
+namespace ngine::Asset
+{
+	//! Serialized form of a single file or directory stamp, maps are stored as arrays sorted by path to keep saved files stable
+	struct SerializedFileStamp
+	{
+		bool Serialize(const Serialization::Reader reader, const IO::PathView prefix)
+		{
+			uint64 modifiedTime{0};
+			if (!reader.Serialize("path", m_path) || !reader.Serialize("modified", modifiedTime))
+			{
+				return false;
+			}
+			m_path = IO::Path::Combine(prefix, m_path);
+			m_stamp.m_modifiedTime = Time::Timestamp::FromSeconds(modifiedTime);
+			reader.Serialize("asset", m_stamp.m_assetGuid);
+			return true;
+		}
+		bool Serialize(Serialization::Writer writer, const IO::PathView rootDirectory) const
+		{
+			writer.Serialize("path", IO::Path(m_path.GetRelativeToParent(rootDirectory)));
+			writer.Serialize("modified", m_stamp.m_modifiedTime.GetSeconds());
+			if (m_stamp.m_assetGuid.IsValid())
+			{
+				writer.Serialize("asset", m_stamp.m_assetGuid);
+			}
+			return true;
+		}
+
+		IO::Path m_path;
+		DatabaseStamps::FileStamp m_stamp;
+	};
+
+	struct SerializedDirectoryStamp
+	{
+		bool Serialize(const Serialization::Reader reader, const IO::PathView prefix)
+		{
+			uint64 modifiedTime{0};
+			if (!reader.Serialize("path", m_path) || !reader.Serialize("modified", modifiedTime))
+			{
+				return false;
+			}
+			m_path = IO::Path::Combine(prefix, m_path);
+			m_stamp.m_modifiedTime = Time::Timestamp::FromSeconds(modifiedTime);
+			reader.Serialize("files", m_stamp.m_fileNames);
+			reader.Serialize("directories", m_stamp.m_subdirectoryNames);
+			return true;
+		}
+		bool Serialize(Serialization::Writer writer, const IO::PathView rootDirectory) const
+		{
+			writer.Serialize("path", IO::Path(m_path.GetRelativeToParent(rootDirectory)));
+			writer.Serialize("modified", m_stamp.m_modifiedTime.GetSeconds());
+			writer.Serialize("files", m_stamp.m_fileNames);
+			writer.Serialize("directories", m_stamp.m_subdirectoryNames);
+			return true;
+		}
+
+		IO::Path m_path;
+		DatabaseStamps::DirectoryStamp m_stamp;
+	};
+
+	template<typename SerializedType, typename MapType>
+	[[nodiscard]] static Vector<SerializedType> GetSortedStamps(const MapType& map)
+	{
+		Vector<SerializedType> stamps(Memory::Reserve, map.GetSize());
+		for (const auto& pair : map)
+		{
+			stamps.EmplaceBack(SerializedType{IO::Path(pair.first), pair.second});
+		}
+
+		Algorithms::Sort(
+			stamps.begin().Get(),
+			stamps.end().Get(),
+			[](const SerializedType& left, const SerializedType& right)
+			{
+				return left.m_path.GetView() < right.m_path.GetView();
+			}
+		);
+		return stamps;
+	}
+
+	bool DatabaseStamps::Load(const IO::PathView databaseFile)
+	{
+		Clear();
+
+		const IO::Path stampsFilePath = GetFilePath(databaseFile);
+		if (!stampsFilePath.Exists())
+		{
+			return false;
+		}
+
+		const IO::PathView prefix = databaseFile.GetParentPath();
+		if (!Serialization::DeserializeFromDisk(stampsFilePath, *this, prefix))
+		{
+			Clear();
+			return false;
+		}
+		return true;
+	}
+
+	bool DatabaseStamps::Save(const IO::PathView databaseFile) const
+	{
+		const IO::PathView rootDirectory = databaseFile.GetParentPath();
+		return Serialization::SerializeToDisk(GetFilePath(databaseFile), *this, Serialization::SavingFlags::Binary, rootDirectory);
+	}
+
+	bool DatabaseStamps::Serialize(const Serialization::Reader reader, const IO::PathView prefix)
+	{
+		uint64 updateTime{0};
+		if (!reader.Serialize("update_time", updateTime))
+		{
+			return false;
+		}
+		m_updateTime = Time::Timestamp::FromSeconds(updateTime);
+
+		Vector<SerializedFileStamp> files;
+		reader.Serialize("files", files, prefix);
+		m_files.Reserve(files.GetSize());
+		for (SerializedFileStamp& file : files)
+		{
+			m_files.EmplaceOrAssign(Move(file.m_path), Move(file.m_stamp));
+		}
+
+		Vector<SerializedDirectoryStamp> directories;
+		reader.Serialize("directories", directories, prefix);
+		m_directories.Reserve(directories.GetSize());
+		for (SerializedDirectoryStamp& directory : directories)
+		{
+			m_directories.EmplaceOrAssign(Move(directory.m_path), Move(directory.m_stamp));
+		}
+		return true;
+	}
+
+	bool DatabaseStamps::Serialize(Serialization::Writer writer, const IO::PathView rootDirectory) const
+	{
+		writer.Serialize("update_time", m_updateTime.GetSeconds());
+		writer.Serialize("files", GetSortedStamps<SerializedFileStamp>(m_files), rootDirectory);
+		writer.Serialize("directories", GetSortedStamps<SerializedDirectoryStamp>(m_directories), rootDirectory);
+		return true;
+	}
+}
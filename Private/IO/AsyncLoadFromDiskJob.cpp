@@ -16,6 +16,21 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <errno.h>
+#elif USE_IO_URING
+#include <Common/Threading/Atomics/Load.h>
+#include <Common/Threading/Atomics/Store.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Threading/Thread.h>
+#include <Common/Threading/Sleep.h>
+#include <linux/io_uring.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <poll.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
 #elif PLATFORM_EMSCRIPTEN
 #include <emscripten.h>
 #include <emscripten/proxying.h>
@@ -50,7 +65,7 @@ namespace ngine::IO
 		Assert(m_path.HasElements());
 	}
 
-#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS
+#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS || USE_IO_URING
 	static Threading::Atomic<uint32> openFileDescriptorCount = 0;
 #endif
 
@@ -66,7 +81,7 @@ namespace ngine::IO
 	static Threading::Mutex queuedAsyncLoadFromDiskJobsMutex;
 	static Vector<ReferenceWrapper<AsyncLoadFromDiskJob>> queuedAsyncLoadFromDiskJobs;
 
-#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS
+#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS || USE_IO_URING
 	[[nodiscard]] bool TryStartAsyncLoading(AsyncLoadFromDiskJob& job)
 	{
 		const uint32 previousRequestCount = openFileDescriptorCount.FetchAdd(1);
@@ -109,7 +124,7 @@ namespace ngine::IO
 
 	void QueueAsyncLoadingRetry(AsyncLoadFromDiskJob& job)
 	{
-#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS
+#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS || USE_IO_URING
 		[[maybe_unused]] const uint32 previousRequestCount = openFileDescriptorCount.FetchSubtract(1);
 		Assert(previousRequestCount > 0);
 #endif
@@ -140,7 +155,7 @@ namespace ngine::IO
 
 	void OnAsyncLoadingFinished()
 	{
-#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS
+#if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS || USE_IO_URING
 		[[maybe_unused]] const uint32 previousRequestCount = openFileDescriptorCount.FetchSubtract(1);
 		Assert(previousRequestCount > 0);
 #endif
@@ -162,6 +177,491 @@ namespace ngine::IO
 		}
 	}
 
+#if USE_IO_URING
+	//! Single submission and completion ring shared by all disk loads
+	//! Loads stage their reads into the submission ring, a dedicated reaper thread submits them in batches and hands completed reads back
+	//! Submitting and waiting for completions happen in the same system call on the reaper, so job runners never block in the kernel
+	//! The reaper keeps a poll on an event descriptor in flight, which is signaled when a read is staged so it is submitted right away
+	struct IoUring
+	{
+		//! One entry for each concurrent load and one for the wake up poll
+		inline static constexpr uint32 EntryCount = AsyncLoadFromDiskJob::MaximumConcurrentRequestCount + 1;
+		//! User data of the wake up poll, reads use the address of their job
+		inline static constexpr uint64 WakeUpUserData = 0;
+
+		IoUring()
+		{
+			io_uring_params parameters;
+			Memory::Set(&parameters, 0, sizeof(parameters));
+			m_ringFileDescriptor = (int)syscall(__NR_io_uring_setup, EntryCount, &parameters);
+			if (m_ringFileDescriptor < 0)
+			{
+				// Kernel is too old or io_uring was disabled, loads fall back to blocking IO
+				return;
+			}
+
+			m_submissionRingSize = parameters.sq_off.array + parameters.sq_entries * sizeof(uint32);
+			m_completionRingSize = parameters.cq_off.cqes + parameters.cq_entries * sizeof(io_uring_cqe);
+			const bool isSingleMapping = (parameters.features & IORING_FEAT_SINGLE_MMAP) != 0;
+			if (isSingleMapping)
+			{
+				m_submissionRingSize = Math::Max(m_submissionRingSize, m_completionRingSize);
+				m_completionRingSize = m_submissionRingSize;
+			}
+
+			m_pSubmissionRing =
+				mmap(nullptr, m_submissionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFileDescriptor, IORING_OFF_SQ_RING);
+			if (isSingleMapping)
+			{
+				m_pCompletionRing = m_pSubmissionRing;
+			}
+			else
+			{
+				m_pCompletionRing =
+					mmap(nullptr, m_completionRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFileDescriptor, IORING_OFF_CQ_RING);
+			}
+			m_submissionEntriesSize = parameters.sq_entries * sizeof(io_uring_sqe);
+			void* pSubmissionEntries = mmap(
+				nullptr,
+				m_submissionEntriesSize,
+				PROT_READ | PROT_WRITE,
+				MAP_SHARED | MAP_POPULATE,
+				m_ringFileDescriptor,
+				IORING_OFF_SQES
+			);
+			m_wakeUpFileDescriptor = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+			const bool mappedRings = m_pSubmissionRing != MAP_FAILED && m_pCompletionRing != MAP_FAILED && pSubmissionEntries != MAP_FAILED;
+			if (UNLIKELY(!mappedRings || m_wakeUpFileDescriptor < 0))
+			{
+				if (pSubmissionEntries != MAP_FAILED)
+				{
+					munmap(pSubmissionEntries, m_submissionEntriesSize);
+				}
+				Release();
+				return;
+			}
+			m_pSubmissionEntries = static_cast<io_uring_sqe*>(pSubmissionEntries);
+
+			ByteType* pSubmissionRing = static_cast<ByteType*>(m_pSubmissionRing);
+			m_pSubmissionTail = reinterpret_cast<uint32*>(pSubmissionRing + parameters.sq_off.tail);
+			m_pSubmissionHead = reinterpret_cast<uint32*>(pSubmissionRing + parameters.sq_off.head);
+			m_submissionMask = *reinterpret_cast<uint32*>(pSubmissionRing + parameters.sq_off.ring_mask);
+			m_pSubmissionArray = reinterpret_cast<uint32*>(pSubmissionRing + parameters.sq_off.array);
+			m_submissionEntryCount = parameters.sq_entries;
+
+			ByteType* pCompletionRing = static_cast<ByteType*>(m_pCompletionRing);
+			m_pCompletionHead = reinterpret_cast<uint32*>(pCompletionRing + parameters.cq_off.head);
+			m_pCompletionTail = reinterpret_cast<uint32*>(pCompletionRing + parameters.cq_off.tail);
+			m_completionMask = *reinterpret_cast<uint32*>(pCompletionRing + parameters.cq_off.ring_mask);
+			m_pCompletionEntries = reinterpret_cast<io_uring_cqe*>(pCompletionRing + parameters.cq_off.cqes);
+
+			m_pReaperThread = UniquePtr<ReaperThread>::Make(*this);
+			m_pReaperThread->Start("io_uring Reaper");
+		}
+		IoUring(const IoUring&) = delete;
+		IoUring& operator=(const IoUring&) = delete;
+		IoUring(IoUring&&) = delete;
+		IoUring& operator=(IoUring&&) = delete;
+		~IoUring()
+		{
+			if (m_pReaperThread.IsValid())
+			{
+				m_isStopping = true;
+				WakeUp();
+				// Joins the reaper before the rings are unmapped
+				m_pReaperThread.DestroyElement();
+			}
+
+			if (m_pSubmissionEntries != nullptr)
+			{
+				munmap(m_pSubmissionEntries, m_submissionEntriesSize);
+			}
+			Release();
+		}
+
+		[[nodiscard]] bool IsValid() const
+		{
+			return m_pSubmissionEntries != nullptr;
+		}
+
+		//! Stages a vectored read into the submission ring and wakes up the reaper to submit it
+		void QueueRead(const int fileDescriptor, const iovec& readVector, const uint64 offset, AsyncLoadFromDiskJob& job)
+		{
+			{
+				Threading::UniqueLock lock(m_submissionMutex);
+				io_uring_sqe& entry = GetNextSubmissionEntry();
+				entry.opcode = IORING_OP_READV;
+				entry.fd = fileDescriptor;
+				entry.addr = reinterpret_cast<uintptr>(&readVector);
+				entry.len = 1;
+				entry.off = offset;
+				entry.user_data = reinterpret_cast<uintptr>(&job);
+				CommitSubmissionEntry();
+			}
+			WakeUp();
+		}
+	protected:
+		struct ReaperThread final : public Threading::ThreadWithRunMember<ReaperThread>
+		{
+			ReaperThread(IoUring& ring)
+				: m_ring(ring)
+			{
+			}
+
+			void Run()
+			{
+				m_ring.Reap();
+			}
+		protected:
+			IoUring& m_ring;
+		};
+
+		//! Submits staged reads and waits for completions until the ring is destroyed, only called by the reaper thread
+		void Reap()
+		{
+			while (!m_isStopping.Load())
+			{
+				if (!m_isWakeUpPollArmed)
+				{
+					ArmWakeUpPoll();
+				}
+
+				// Submit everything staged so far and wait for the next completion in a single system call
+				// The wake up poll is always in flight or staged, so the wait ends once another read is staged
+				const uint32 submissionHead = Threading::Atomics::Load(*m_pSubmissionHead);
+				const uint32 pendingSubmissionCount = Threading::Atomics::Load(*m_pSubmissionTail) - submissionHead;
+				const int submittedCount =
+					(int)syscall(__NR_io_uring_enter, m_ringFileDescriptor, pendingSubmissionCount, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+
+				// Only count what the kernel consumed, each consumed entry produces a completion even when it was rejected
+				// Entries that were not consumed on a short submission stay staged and are submitted by the next iteration
+				m_inFlightCount += Threading::Atomics::Load(*m_pSubmissionHead) - submissionHead;
+
+				if (submittedCount < 0)
+				{
+					const int error = errno;
+					switch (error)
+					{
+						case EINTR:
+							break;
+						case EAGAIN:
+						case EBUSY:
+						{
+							// Kernel is out of resources or completions have to be reaped first, wait for requests in flight to finish
+							if (m_inFlightCount > 0)
+							{
+								syscall(__NR_io_uring_enter, m_ringFileDescriptor, 0, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+							}
+							else
+							{
+								Threading::Sleep(1);
+							}
+						}
+						break;
+						default:
+						{
+							// The ring can't accept submissions, fail staged reads instead of leaving their loads waiting forever
+							FailStagedEntries(-error);
+							WaitForWakeUpSignal();
+						}
+						break;
+					}
+				}
+
+				DrainCompletions();
+			}
+		}
+
+		//! Requires the submission mutex to be held, the entry is only visible to the kernel after CommitSubmissionEntry
+		[[nodiscard]] io_uring_sqe& GetNextSubmissionEntry()
+		{
+			Assert(m_submissionTail - Threading::Atomics::Load(*m_pSubmissionHead) < m_submissionEntryCount, "Submission ring is full");
+
+			const uint32 index = m_submissionTail & m_submissionMask;
+			io_uring_sqe& entry = m_pSubmissionEntries[index];
+			Memory::Set(&entry, 0, sizeof(entry));
+			m_pSubmissionArray[index] = index;
+			return entry;
+		}
+
+		void CommitSubmissionEntry()
+		{
+			m_submissionTail++;
+			Threading::Atomics::Store(*m_pSubmissionTail, m_submissionTail);
+		}
+
+		void ArmWakeUpPoll()
+		{
+			Threading::UniqueLock lock(m_submissionMutex);
+			io_uring_sqe& entry = GetNextSubmissionEntry();
+			entry.opcode = IORING_OP_POLL_ADD;
+			entry.fd = m_wakeUpFileDescriptor;
+			entry.poll_events = POLLIN;
+			entry.user_data = WakeUpUserData;
+			CommitSubmissionEntry();
+			m_isWakeUpPollArmed = true;
+		}
+
+		void WakeUp()
+		{
+			// Only signal once per reaper iteration, everything staged until the reaper handles the signal is submitted in one batch
+			if (!m_isWakeUpRequested.Exchange(true))
+			{
+				const uint64 value = 1;
+				[[maybe_unused]] const ssize_t writtenSize = write(m_wakeUpFileDescriptor, &value, sizeof(value));
+			}
+		}
+
+		void ConsumeWakeUpSignal()
+		{
+			uint64 value;
+			[[maybe_unused]] const ssize_t readSize = read(m_wakeUpFileDescriptor, &value, sizeof(value));
+			// Cleared after the read so a read staged in the meantime signals again
+			m_isWakeUpRequested = false;
+		}
+
+		//! Blocks the reaper until a read is staged, used when the ring itself can't be waited on
+		void WaitForWakeUpSignal()
+		{
+			pollfd wakeUpPoll{m_wakeUpFileDescriptor, POLLIN, 0};
+			while (poll(&wakeUpPoll, 1, -1) < 0 && errno == EINTR)
+			{
+			}
+			ConsumeWakeUpSignal();
+		}
+
+		//! Completes all entries the kernel did not consume with the error and removes them from the submission ring
+		void FailStagedEntries(const int32 error)
+		{
+			Threading::UniqueLock lock(m_submissionMutex);
+			const uint32 submissionHead = Threading::Atomics::Load(*m_pSubmissionHead);
+			for (uint32 position = submissionHead; position != m_submissionTail; ++position)
+			{
+				const io_uring_sqe& entry = m_pSubmissionEntries[m_pSubmissionArray[position & m_submissionMask]];
+				if (entry.user_data == WakeUpUserData)
+				{
+					m_isWakeUpPollArmed = false;
+				}
+				else
+				{
+					reinterpret_cast<AsyncLoadFromDiskJob*>(static_cast<uintptr>(entry.user_data))->OnReadCompleted(error);
+				}
+			}
+			m_submissionTail = submissionHead;
+			Threading::Atomics::Store(*m_pSubmissionTail, m_submissionTail);
+		}
+
+		//! Hands each completed read back to its job, only called by the reaper thread
+		void DrainCompletions()
+		{
+			uint32 head = *m_pCompletionHead;
+			const uint32 tail = Threading::Atomics::Load(*m_pCompletionTail);
+			while (head != tail)
+			{
+				const io_uring_cqe& entry = m_pCompletionEntries[head & m_completionMask];
+				const uint64 userData = entry.user_data;
+				const int32 result = entry.res;
+				head++;
+				m_inFlightCount--;
+
+				if (userData == WakeUpUserData)
+				{
+					m_isWakeUpPollArmed = false;
+					ConsumeWakeUpSignal();
+				}
+				else
+				{
+					reinterpret_cast<AsyncLoadFromDiskJob*>(static_cast<uintptr>(userData))->OnReadCompleted(result);
+				}
+			}
+			Threading::Atomics::Store(*m_pCompletionHead, head);
+		}
+
+		void Release()
+		{
+			if (m_pCompletionRing != nullptr && m_pCompletionRing != MAP_FAILED && m_pCompletionRing != m_pSubmissionRing)
+			{
+				munmap(m_pCompletionRing, m_completionRingSize);
+			}
+			if (m_pSubmissionRing != nullptr && m_pSubmissionRing != MAP_FAILED)
+			{
+				munmap(m_pSubmissionRing, m_submissionRingSize);
+			}
+			m_pSubmissionRing = nullptr;
+			m_pCompletionRing = nullptr;
+			m_pSubmissionEntries = nullptr;
+			if (m_wakeUpFileDescriptor >= 0)
+			{
+				close(m_wakeUpFileDescriptor);
+				m_wakeUpFileDescriptor = -1;
+			}
+			if (m_ringFileDescriptor >= 0)
+			{
+				close(m_ringFileDescriptor);
+				m_ringFileDescriptor = -1;
+			}
+		}
+	protected:
+		int m_ringFileDescriptor{-1};
+		int m_wakeUpFileDescriptor{-1};
+
+		void* m_pSubmissionRing{nullptr};
+		size m_submissionRingSize{0};
+		io_uring_sqe* m_pSubmissionEntries{nullptr};
+		size m_submissionEntriesSize{0};
+		uint32* m_pSubmissionHead{nullptr};
+		uint32* m_pSubmissionTail{nullptr};
+		uint32* m_pSubmissionArray{nullptr};
+		uint32 m_submissionMask{0};
+		uint32 m_submissionEntryCount{0};
+		uint32 m_submissionTail{0};
+		Threading::Mutex m_submissionMutex;
+
+		void* m_pCompletionRing{nullptr};
+		size m_completionRingSize{0};
+		uint32* m_pCompletionHead{nullptr};
+		uint32* m_pCompletionTail{nullptr};
+		io_uring_cqe* m_pCompletionEntries{nullptr};
+		uint32 m_completionMask{0};
+
+		UniquePtr<ReaperThread> m_pReaperThread;
+		Threading::Atomic<bool> m_isStopping{false};
+		Threading::Atomic<bool> m_isWakeUpRequested{false};
+		//! Only accessed by the reaper thread
+		bool m_isWakeUpPollArmed{false};
+		uint32 m_inFlightCount{0};
+	};
+
+	[[nodiscard]] IoUring& GetIoUring()
+	{
+		static IoUring ring;
+		return ring;
+	}
+
+	//! O_DIRECT requires the buffer, offset and size to be aligned to the logical block size
+	inline static constexpr size DirectIOAlignment = 4096;
+	[[nodiscard]] bool CanUseDirectIO(const ConstByteView target, const uint64 offset)
+	{
+		return (reinterpret_cast<uintptr>(target.GetData()) % DirectIOAlignment) == 0 && (offset % DirectIOAlignment) == 0 &&
+		       (target.GetDataSize() % DirectIOAlignment) == 0;
+	}
+
+	//! Keeps recently read files open, as loads commonly issue many small reads into the same packed files
+	//! Descriptors are shared between loads of the same file and only closed once evicted while unused
+	struct FileDescriptorCache
+	{
+		inline static constexpr uint32 MaximumCachedDescriptorCount = 32;
+
+		~FileDescriptorCache()
+		{
+			for (const Entry& entry : m_entries)
+			{
+				close(entry.m_fileDescriptor);
+			}
+		}
+
+		//! Returns an open descriptor for the file described by fileStatus, or -1 with errno set
+		//! Must be released with Release
+		[[nodiscard]] int Acquire(const IO::ZeroTerminatedPathView path, const struct stat& fileStatus, const bool isDirectIO)
+		{
+			{
+				Threading::UniqueLock lock(m_mutex);
+				for (Entry& entry : m_entries)
+				{
+					// Identify by inode so a replaced file isn't served from the stale descriptor
+					if (entry.m_device == fileStatus.st_dev && entry.m_inode == fileStatus.st_ino && entry.m_isDirectIO == isDirectIO)
+					{
+						entry.m_referenceCount++;
+						entry.m_lastUseIndex = ++m_useCounter;
+						return entry.m_fileDescriptor;
+					}
+				}
+			}
+
+			const int fileDescriptor = open(path, O_RDONLY | O_CLOEXEC | (O_DIRECT * isDirectIO), 0);
+			if (fileDescriptor == -1)
+			{
+				return -1;
+			}
+
+			Threading::UniqueLock lock(m_mutex);
+			if (m_entries.GetSize() == MaximumCachedDescriptorCount)
+			{
+				Entry* pLeastRecentlyUsedEntry = nullptr;
+				for (Entry& entry : m_entries)
+				{
+					if (entry.m_referenceCount == 0 &&
+					    (pLeastRecentlyUsedEntry == nullptr || entry.m_lastUseIndex < pLeastRecentlyUsedEntry->m_lastUseIndex))
+					{
+						pLeastRecentlyUsedEntry = &entry;
+					}
+				}
+				if (pLeastRecentlyUsedEntry == nullptr)
+				{
+					// All cached descriptors are in use, this one is closed on release
+					return fileDescriptor;
+				}
+				close(pLeastRecentlyUsedEntry->m_fileDescriptor);
+				m_entries.Remove(pLeastRecentlyUsedEntry);
+			}
+			m_entries.EmplaceBack(Entry{fileDescriptor, fileStatus.st_dev, fileStatus.st_ino, 1, ++m_useCounter, isDirectIO});
+			return fileDescriptor;
+		}
+
+		void Release(const int fileDescriptor)
+		{
+			Threading::UniqueLock lock(m_mutex);
+			for (Entry& entry : m_entries)
+			{
+				if (entry.m_fileDescriptor == fileDescriptor)
+				{
+					Assert(entry.m_referenceCount > 0);
+					entry.m_referenceCount--;
+					return;
+				}
+			}
+			close(fileDescriptor);
+		}
+
+		//! Closes all descriptors that aren't used by a load, called when we ran out of descriptors
+		void ReleaseUnusedDescriptors()
+		{
+			Threading::UniqueLock lock(m_mutex);
+			m_entries.RemoveAllOccurrencesPredicate(
+				[](const Entry& entry)
+				{
+					if (entry.m_referenceCount == 0)
+					{
+						close(entry.m_fileDescriptor);
+						return ErasePredicateResult::Remove;
+					}
+					return ErasePredicateResult::Continue;
+				}
+			);
+		}
+	protected:
+		struct Entry
+		{
+			int m_fileDescriptor;
+			dev_t m_device;
+			ino_t m_inode;
+			uint32 m_referenceCount;
+			uint64 m_lastUseIndex;
+			bool m_isDirectIO;
+		};
+
+		Threading::Mutex m_mutex;
+		Vector<Entry, uint32> m_entries{Memory::Reserve, MaximumCachedDescriptorCount};
+		uint64 m_useCounter{0};
+	};
+
+	[[nodiscard]] FileDescriptorCache& GetFileDescriptorCache()
+	{
+		static FileDescriptorCache cache;
+		return cache;
+	}
+#endif
+
 	AsyncLoadFromDiskJob::~AsyncLoadFromDiskJob()
 	{
 		CloseHandles();
@@ -187,6 +687,12 @@ namespace ngine::IO
 			close(m_fileDescriptor);
 			m_fileDescriptor = -1;
 		}
+#elif USE_IO_URING
+		if (m_fileDescriptor != -1)
+		{
+			GetFileDescriptorCache().Release(m_fileDescriptor);
+			m_fileDescriptor = -1;
+		}
 #endif
 	}
 
@@ -206,6 +712,24 @@ namespace ngine::IO
 
 	Threading::Job::Result AsyncLoadFromDiskJob::OnExecute([[maybe_unused]] Threading::JobRunnerThread& thread)
 	{
+#if USE_IO_URING
+		static const auto reopenWithoutDirectIO = [](AsyncLoadFromDiskJob& job) -> bool
+		{
+			FileDescriptorCache& fileDescriptorCache = GetFileDescriptorCache();
+			fileDescriptorCache.Release(job.m_fileDescriptor);
+			job.m_fileDescriptor = -1;
+			job.m_isDirectIO = false;
+
+			struct stat fileStatus;
+			if (UNLIKELY(stat(job.m_path.GetZeroTerminated(), &fileStatus) != 0))
+			{
+				return false;
+			}
+			job.m_fileDescriptor = fileDescriptorCache.Acquire(job.m_path.GetZeroTerminated(), fileStatus, false);
+			return job.m_fileDescriptor != -1;
+		};
+#endif
+
 		switch (m_status)
 		{
 			case Status::WaitingForInitialRequest:
@@ -655,7 +1179,66 @@ namespace ngine::IO
 					) == 1;
 				Assert(queued);
 				return Result::AwaitExternalFinish;
-#else
+#elif USE_IO_URING
+				if (GetIoUring().IsValid())
+				{
+					if (!TryStartAsyncLoading(*this))
+					{
+						return Result::AwaitExternalFinish;
+					}
+
+					struct stat fileStatus;
+					if (UNLIKELY(stat(m_path.GetZeroTerminated(), &fileStatus) != 0))
+					{
+						OnLoadingFailed();
+						return Result::FinishedAndDelete;
+					}
+					const size fileSize = fileStatus.st_size;
+
+					getTargetBuffer(*this, fileSize);
+
+					m_isDirectIO = CanUseDirectIO(m_target, m_dataRange.GetMinimum());
+					FileDescriptorCache& fileDescriptorCache = GetFileDescriptorCache();
+					m_fileDescriptor = fileDescriptorCache.Acquire(m_path.GetZeroTerminated(), fileStatus, m_isDirectIO);
+					if (m_fileDescriptor == -1 && m_isDirectIO && errno == EINVAL)
+					{
+						// File system doesn't support direct IO
+						m_isDirectIO = false;
+						m_fileDescriptor = fileDescriptorCache.Acquire(m_path.GetZeroTerminated(), fileStatus, false);
+					}
+					if (UNLIKELY(m_fileDescriptor == -1))
+					{
+						const int error = errno;
+						switch (error)
+						{
+							case ENFILE:
+							case EMFILE:
+							{
+								fileDescriptorCache.ReleaseUnusedDescriptors();
+								QueueAsyncLoadingRetry(*this);
+								return Result::AwaitExternalFinish;
+							}
+							default:
+							{
+								OnLoadingFailed();
+								return Result::FinishedAndDelete;
+							}
+						}
+					}
+
+					if (m_target.IsEmpty())
+					{
+						OnLoadingFinished();
+						return Result::FinishedAndDelete;
+					}
+
+					m_currentTargetOffset = 0;
+					m_status = Status::WaitingForAsyncRead;
+					// The read is staged once the runner cleared our executing state, see OnAwaitExternalFinish
+					return Result::AwaitExternalFinish;
+				}
+#endif
+#if USE_IO_URING || !(PLATFORM_WINDOWS || USE_APPLE_ASYNC_IO || USE_POSIX_ASYNC_IO || PLATFORM_EMSCRIPTEN)
 				{
 					// Fall back to blocking IO
 					// If this is hit, look into whether an async API is available on the platform
@@ -762,6 +1345,57 @@ namespace ngine::IO
 						return Result::FinishedAndDelete;
 					}
 				}
+#elif USE_IO_URING
+				const int32 result = m_readResult;
+				if (result > 0)
+				{
+					m_currentTargetOffset += (size)result;
+					if (m_currentTargetOffset == m_target.GetDataSize())
+					{
+						OnLoadingFinished();
+						return Result::FinishedAndDelete;
+					}
+
+					// Short read, stage the remainder
+					const ByteView remainingTarget = m_target.GetSubView(m_currentTargetOffset, m_target.GetDataSize() - m_currentTargetOffset);
+					if (m_isDirectIO && !CanUseDirectIO(remainingTarget, m_dataRange.GetMinimum() + m_currentTargetOffset))
+					{
+						if (UNLIKELY(!reopenWithoutDirectIO(*this)))
+						{
+							OnLoadingFailed();
+							return Result::FinishedAndDelete;
+						}
+					}
+					return Result::AwaitExternalFinish;
+				}
+				else if (result == 0)
+				{
+					// File was truncated since we started loading
+					m_target = m_target.GetSubView((size)0, m_currentTargetOffset);
+					OnLoadingFinished();
+					return Result::FinishedAndDelete;
+				}
+
+				switch (-result)
+				{
+					case EAGAIN:
+					case EINTR:
+						return Result::AwaitExternalFinish;
+					case EINVAL:
+					{
+						if (m_isDirectIO && reopenWithoutDirectIO(*this))
+						{
+							return Result::AwaitExternalFinish;
+						}
+						OnLoadingFailed();
+						return Result::FinishedAndDelete;
+					}
+					default:
+					{
+						OnLoadingFailed();
+						return Result::FinishedAndDelete;
+					}
+				}
 #else
 				ExpectUnreachable();
 #endif
@@ -773,6 +1407,24 @@ namespace ngine::IO
 		ExpectUnreachable();
 	}
 
+#if USE_IO_URING
+	void AsyncLoadFromDiskJob::OnAwaitExternalFinish(Threading::JobRunnerThread&)
+	{
+		if (m_status == Status::WaitingForAsyncRead)
+		{
+			m_readVector.iov_base = m_target.GetData() + m_currentTargetOffset;
+			m_readVector.iov_len = m_target.GetDataSize() - m_currentTargetOffset;
+			GetIoUring().QueueRead(m_fileDescriptor, m_readVector, m_dataRange.GetMinimum() + m_currentTargetOffset, *this);
+		}
+	}
+
+	void AsyncLoadFromDiskJob::OnReadCompleted(const int32 result)
+	{
+		m_readResult = result;
+		Queue(System::Get<Threading::JobManager>());
+	}
+#endif
+
 	Threading::Job* CreateAsyncLoadFromDiskJob(
 		const IO::PathView path,
 		Threading::JobPriority priority,
@@ -0,0 +1,199 @@
+#include "IO/CoalescedLoadScheduler.h"
+
+#include <Common/IO/AsyncLoadFromDiskJob.h>
+#include <Common/Threading/Jobs/JobRunnerThread.h>
+#include <Common/Threading/Jobs/JobManager.h>
+#include <Common/System/Query.h>
+
+#include <algorithm>
+
+namespace ngine::IO
+{
+	CoalescedLoadScheduler::CoalescedLoadScheduler()
+		: Job(Threading::JobPriority::FirstUserVisibleBackground)
+	{
+	}
+
+	void CoalescedLoadScheduler::Queue(
+		const IO::PathView path,
+		const Priority priority,
+		AsyncLoadCallback&& callback,
+		const ByteView target,
+		const Math::Range<size> dataRange
+	)
+	{
+		{
+			Threading::UniqueLock lock(m_pendingLoadsMutex);
+			m_pendingLoads.EmplaceBack(PendingLoad{IO::Path(path), Forward<AsyncLoadCallback>(callback), target, dataRange, priority});
+		}
+		// Loads queued while we are flushing queue the scheduler again, so they are picked up by the next run
+		TryQueue(System::Get<Threading::JobManager>());
+	}
+
+	[[nodiscard]] PURE_STATICS static bool CanMergeRange(const Math::Range<size> dataRange)
+	{
+		// Whole file loads use a range up to the maximum size value
+		return dataRange.GetSize() <= CoalescedLoadScheduler::MaximumMergedReadSize;
+	}
+
+	void CoalescedLoadScheduler::PlanReads(const ArrayView<PendingLoad, uint32> loads, Vector<MergedRead, uint32>& readsOut)
+	{
+		std::sort(
+			loads.begin().Get(),
+			loads.end().Get(),
+			[](const PendingLoad& left, const PendingLoad& right)
+			{
+				if (left.m_path != right.m_path)
+				{
+					return left.m_path.GetView() < right.m_path.GetView();
+				}
+				if (left.m_dataRange.GetMinimum() != right.m_dataRange.GetMinimum())
+				{
+					return left.m_dataRange.GetMinimum() < right.m_dataRange.GetMinimum();
+				}
+				return left.m_dataRange.GetSize() < right.m_dataRange.GetSize();
+			}
+		);
+
+		for (uint32 loadIndex = 0, loadCount = loads.GetSize(); loadIndex < loadCount;)
+		{
+			const PendingLoad& firstLoad = loads[loadIndex];
+			MergedRead read{firstLoad.m_dataRange, loadIndex, 1, firstLoad.m_priority};
+			if (CanMergeRange(firstLoad.m_dataRange))
+			{
+				const size readStart = firstLoad.m_dataRange.GetMinimum();
+				size readEnd = firstLoad.m_dataRange.GetEnd();
+				for (uint32 nextLoadIndex = loadIndex + 1; nextLoadIndex < loadCount; ++nextLoadIndex)
+				{
+					const PendingLoad& nextLoad = loads[nextLoadIndex];
+					if (nextLoad.m_path != firstLoad.m_path || !CanMergeRange(nextLoad.m_dataRange) ||
+					    nextLoad.m_dataRange.GetMinimum() > readEnd + MaximumMergeGap)
+					{
+						break;
+					}
+
+					const size mergedReadEnd = Math::Max(readEnd, nextLoad.m_dataRange.GetEnd());
+					if (mergedReadEnd - readStart > MaximumMergedReadSize)
+					{
+						break;
+					}
+
+					readEnd = mergedReadEnd;
+					read.m_loadCount++;
+					read.m_priority = Math::Min(read.m_priority, nextLoad.m_priority);
+				}
+				read.m_dataRange = Math::Range<size>::Make(readStart, readEnd - readStart);
+			}
+
+			readsOut.EmplaceBack(read);
+			loadIndex += read.m_loadCount;
+		}
+
+		// Keep file order for reads of the same priority, so the disk sees ascending offsets
+		std::stable_sort(
+			readsOut.begin().Get(),
+			readsOut.end().Get(),
+			[](const MergedRead& left, const MergedRead& right)
+			{
+				return left.m_priority < right.m_priority;
+			}
+		);
+	}
+
+	//! Distributes the result of a merged read to the loads it served
+	struct ScatteredLoads
+	{
+		using PendingLoad = CoalescedLoadScheduler::PendingLoad;
+
+		void OnReadFinished(const ConstByteView data)
+		{
+			for (PendingLoad& load : m_loads)
+			{
+				if (data.IsEmpty())
+				{
+					load.m_callback({});
+					continue;
+				}
+
+				// The read is truncated to the file size, so ranges past the end receive less or no data
+				const size offset = Math::Min(load.m_dataRange.GetMinimum() - m_dataRange.GetMinimum(), data.GetDataSize());
+				const size availableSize = Math::Min(load.m_dataRange.GetSize(), data.GetDataSize() - offset);
+				const ConstByteView loadData = data.GetSubView(offset, availableSize);
+				if (load.m_target.HasElements())
+				{
+					const ByteView target = load.m_target.GetSubView((size)0, Math::Min(load.m_target.GetDataSize(), availableSize));
+					target.CopyFrom(loadData);
+					load.m_callback(target);
+				}
+				else
+				{
+					load.m_callback(loadData);
+				}
+			}
+		}
+
+		Math::Range<size> m_dataRange;
+		Vector<PendingLoad, uint32> m_loads;
+	};
+
+	Threading::Job::Result CoalescedLoadScheduler::OnExecute(Threading::JobRunnerThread& thread)
+	{
+		Vector<PendingLoad, uint32> loads;
+		{
+			Threading::UniqueLock lock(m_pendingLoadsMutex);
+			loads.Swap(Move(m_pendingLoads));
+		}
+
+		Vector<MergedRead, uint32> reads(Memory::Reserve, loads.GetSize());
+		PlanReads(loads.GetView(), reads);
+
+		for (const MergedRead& read : reads)
+		{
+			Threading::Job* pReadJob;
+			if (read.m_loadCount == 1)
+			{
+				PendingLoad& load = loads[read.m_firstLoadIndex];
+				pReadJob = CreateAsyncLoadFromDiskJob(load.m_path, load.m_priority, Move(load.m_callback), load.m_target, load.m_dataRange);
+			}
+			else
+			{
+				ScatteredLoads* pScatteredLoads =
+					new ScatteredLoads{read.m_dataRange, Vector<PendingLoad, uint32>(Memory::Reserve, read.m_loadCount)};
+				for (PendingLoad& load : loads.GetSubView(read.m_firstLoadIndex, read.m_loadCount))
+				{
+					pScatteredLoads->m_loads.EmplaceBack(Move(load));
+				}
+				// Notify the most urgent loads first
+				std::stable_sort(
+					pScatteredLoads->m_loads.begin().Get(),
+					pScatteredLoads->m_loads.end().Get(),
+					[](const PendingLoad& left, const PendingLoad& right)
+					{
+						return left.m_priority < right.m_priority;
+					}
+				);
+
+				// Let the job allocate the merged buffer, it is released once the callback returns
+				pReadJob = CreateAsyncLoadFromDiskJob(
+					pScatteredLoads->m_loads[0].m_path,
+					read.m_priority,
+					[pScatteredLoads](const ConstByteView data)
+					{
+						pScatteredLoads->OnReadFinished(data);
+						delete pScatteredLoads;
+					},
+					{},
+					read.m_dataRange
+				);
+			}
+			thread.Queue(*pReadJob);
+		}
+		return Result::Finished;
+	}
+
+	CoalescedLoadScheduler& GetCoalescedLoadScheduler()
+	{
+		static CoalescedLoadScheduler scheduler;
+		return scheduler;
+	}
+}
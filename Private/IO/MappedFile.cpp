@@ -0,0 +1,181 @@
+#include "IO/MappedFile.h"
+
+#include <Common/IO/ZeroTerminatedPathView.h>
+
+#if PLATFORM_WINDOWS
+#include <Platform/Windows.h>
+#elif PLATFORM_POSIX
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace ngine::IO
+{
+#if PLATFORM_POSIX
+	[[nodiscard]] static int GetAdvice(const MappedFile::AccessPattern accessPattern)
+	{
+		switch (accessPattern)
+		{
+			case MappedFile::AccessPattern::Default:
+				return MADV_NORMAL;
+			case MappedFile::AccessPattern::Sequential:
+				return MADV_SEQUENTIAL;
+			case MappedFile::AccessPattern::Random:
+				return MADV_RANDOM;
+		}
+		ExpectUnreachable();
+	}
+
+	[[nodiscard]] static size GetPageSize()
+	{
+		static const size pageSize = (size)sysconf(_SC_PAGESIZE);
+		return pageSize;
+	}
+#endif
+
+	MappedFile::MappedFile(const IO::ConstZeroTerminatedPathView filePath, [[maybe_unused]] const AccessPattern accessPattern)
+	{
+#if PLATFORM_WINDOWS
+		const HANDLE fileHandle = CreateFileW(
+			filePath,
+			GENERIC_READ,
+			FILE_SHARE_READ,
+			nullptr,
+			OPEN_EXISTING,
+			FILE_ATTRIBUTE_NORMAL | (FILE_FLAG_SEQUENTIAL_SCAN * (accessPattern == AccessPattern::Sequential)) |
+				(FILE_FLAG_RANDOM_ACCESS * (accessPattern == AccessPattern::Random)),
+			nullptr
+		);
+		if (fileHandle == INVALID_HANDLE_VALUE)
+		{
+			return;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (UNLIKELY(!GetFileSizeEx(fileHandle, &fileSize)))
+		{
+			CloseHandle(fileHandle);
+			return;
+		}
+
+		if (fileSize.QuadPart == 0)
+		{
+			// Empty files can't be mapped
+			CloseHandle(fileHandle);
+			m_isValid = true;
+			return;
+		}
+
+		const HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		// The view keeps the mapping and file alive
+		CloseHandle(fileHandle);
+		if (UNLIKELY(mappingHandle == nullptr))
+		{
+			return;
+		}
+
+		void* pData = MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0);
+		CloseHandle(mappingHandle);
+		if (UNLIKELY(pData == nullptr))
+		{
+			return;
+		}
+
+		m_pData = static_cast<const ByteType*>(pData);
+		m_size = (size)fileSize.QuadPart;
+		m_isValid = true;
+#elif PLATFORM_POSIX
+		const int fileDescriptor = open(filePath, O_RDONLY | O_CLOEXEC);
+		if (fileDescriptor == -1)
+		{
+			return;
+		}
+
+		struct stat fileStatus;
+		if (UNLIKELY(fstat(fileDescriptor, &fileStatus) != 0 || !S_ISREG(fileStatus.st_mode)))
+		{
+			close(fileDescriptor);
+			return;
+		}
+
+		if (fileStatus.st_size == 0)
+		{
+			// Empty files can't be mapped
+			close(fileDescriptor);
+			m_isValid = true;
+			return;
+		}
+
+		void* pData = mmap(nullptr, (size)fileStatus.st_size, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+		// The mapping keeps the file alive
+		close(fileDescriptor);
+		if (UNLIKELY(pData == MAP_FAILED))
+		{
+			return;
+		}
+
+		m_pData = static_cast<const ByteType*>(pData);
+		m_size = (size)fileStatus.st_size;
+		m_isValid = true;
+
+		if (accessPattern != AccessPattern::Default)
+		{
+			Advise(accessPattern);
+		}
+#else
+		static_unreachable("Mapped files are not implemented for this platform!");
+#endif
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_pData != nullptr)
+		{
+#if PLATFORM_WINDOWS
+			UnmapViewOfFile(m_pData);
+#elif PLATFORM_POSIX
+			munmap(const_cast<ByteType*>(m_pData), m_size);
+#endif
+		}
+		m_pData = nullptr;
+		m_size = 0;
+		m_isValid = false;
+	}
+
+	void MappedFile::Advise([[maybe_unused]] const AccessPattern accessPattern, [[maybe_unused]] const ConstByteView range) const
+	{
+		Assert(range.IsEmpty() || (range.GetData() >= m_pData && range.GetData() + range.GetDataSize() <= m_pData + m_size));
+#if PLATFORM_POSIX
+		if (range.HasElements())
+		{
+			// The address passed to madvise must be page aligned
+			const uintptr start = reinterpret_cast<uintptr>(range.GetData()) & ~(GetPageSize() - 1);
+			const uintptr end = reinterpret_cast<uintptr>(range.GetData()) + range.GetDataSize();
+			madvise(reinterpret_cast<void*>(start), end - start, GetAdvice(accessPattern));
+		}
+#endif
+		// Windows only supports access hints when opening the file
+	}
+
+	void MappedFile::Prefetch([[maybe_unused]] const ConstByteView range) const
+	{
+		Assert(range.IsEmpty() || (range.GetData() >= m_pData && range.GetData() + range.GetDataSize() <= m_pData + m_size));
+		if (range.IsEmpty())
+		{
+			return;
+		}
+
+#if PLATFORM_WINDOWS
+		WIN32_MEMORY_RANGE_ENTRY entry;
+		entry.VirtualAddress = const_cast<ByteType*>(range.GetData());
+		entry.NumberOfBytes = range.GetDataSize();
+		PrefetchVirtualMemory(GetCurrentProcess(), 1, &entry, 0);
+#elif PLATFORM_POSIX
+		const uintptr start = reinterpret_cast<uintptr>(range.GetData()) & ~(GetPageSize() - 1);
+		const uintptr end = reinterpret_cast<uintptr>(range.GetData()) + range.GetDataSize();
+		madvise(reinterpret_cast<void*>(start), end - start, MADV_WILLNEED);
+#endif
+	}
+}
@@ -0,0 +1,330 @@
+#include "Memory/Allocators/AllocationSampling.h"
+#include "Memory/Allocators/MemoryUsage.h"
+#include "Memory/Allocators/Allocate.h"
+
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/Format/String.h>
+#include <Common/Memory/Containers/Format/StringView.h>
+#include <Common/Algorithms/Sort.h>
+#include <Common/Math/Max.h>
+#include <Common/Platform/Likely.h>
+#include <Common/Platform/Unused.h>
+#include <Common/Platform/Windows.h>
+
+#include <cstring>
+
+#if PLATFORM_LINUX || PLATFORM_APPLE
+#include <execinfo.h>
+#include <dlfcn.h>
+#endif
+
+namespace ngine::Memory
+{
+	namespace Internal
+	{
+		Threading::Atomic<size> allocationSampleInterval = 0;
+		Threading::Atomic<uint32> liveAllocationSampleCount = 0;
+	}
+
+	inline static constexpr uint8 MaximumSampledStackDepth = 24;
+	//! Frames of the profiler and allocation functions that are left out of sampled call stacks
+	inline static constexpr uint8 SkippedStackDepth = 3;
+	//! Sampled addresses are grouped in buckets of one cache line, so the lookup on free touches a single line
+	inline static constexpr uint32 SampleBucketSize = 8;
+	inline static constexpr uint32 SampleBucketCountLog2 = 11;
+	inline static constexpr uint32 SampleBucketCount = 1u << SampleBucketCountLog2;
+	//! Address of a slot that is reserved while its sample is written
+	inline static constexpr uintptr WritingSampleAddress = 1;
+
+	struct AllocationSample
+	{
+		size m_estimatedSize;
+		UsageTag m_tag;
+		uint8 m_stackDepth;
+		Array<void*, MaximumSampledStackDepth> m_stack;
+	};
+
+	struct alignas(64) SampleBucket
+	{
+		//! Address of each slot's sampled allocation, zero when the slot is free
+		Array<Threading::Atomic<uintptr>, SampleBucketSize> m_addresses;
+		Array<AllocationSample, SampleBucketSize> m_samples;
+	};
+
+	struct ThreadSamplingState
+	{
+		intptr m_bytesUntilNextSample{0};
+		uint64 m_randomState{0};
+		//! Set while the thread is inside the profiler, its own allocations are never sampled
+		bool m_isInsideProfiler{false};
+	};
+
+	static SampleBucket* pSampleBuckets = nullptr;
+	static Threading::Atomic<size> droppedSampleCount = 0;
+	//! Interval of the current or last sampling run, reported after sampling stopped
+	static size reportedSampleInterval = 0;
+	static thread_local ThreadSamplingState threadSamplingState;
+
+	[[nodiscard]] FORCE_INLINE SampleBucket& GetSampleBucket(const uintptr address)
+	{
+		const uint64 hash = (address >> 4) * 0x9E3779B97F4A7C15ull;
+		return pSampleBuckets[hash >> (64 - SampleBucketCountLog2)];
+	}
+
+	//! Picks the distance to the next sample uniformly between half and one and a half intervals
+	//! Randomizing avoids always sampling the same allocation of a periodic allocation pattern
+	[[nodiscard]] intptr GetNextSampleDistance(ThreadSamplingState& state, const size sampleInterval)
+	{
+		uint64 randomState = state.m_randomState;
+		randomState ^= randomState << 13;
+		randomState ^= randomState >> 7;
+		randomState ^= randomState << 17;
+		state.m_randomState = randomState;
+		return static_cast<intptr>(sampleInterval / 2 + randomState % (sampleInterval + 1));
+	}
+
+	[[nodiscard]] uint8 CaptureStack(Array<void*, MaximumSampledStackDepth>& stack)
+	{
+#if PLATFORM_WINDOWS
+		return static_cast<uint8>(RtlCaptureStackBackTrace(SkippedStackDepth, MaximumSampledStackDepth, stack.GetData(), nullptr));
+#elif PLATFORM_LINUX || PLATFORM_APPLE
+		void* frames[MaximumSampledStackDepth + SkippedStackDepth];
+		const int frameCount = backtrace(frames, MaximumSampledStackDepth + SkippedStackDepth);
+		if (frameCount <= SkippedStackDepth)
+		{
+			return 0;
+		}
+		const uint8 stackDepth = static_cast<uint8>(frameCount - SkippedStackDepth);
+		for (uint8 frameIndex = 0; frameIndex < stackDepth; ++frameIndex)
+		{
+			stack[frameIndex] = frames[frameIndex + SkippedStackDepth];
+		}
+		return stackDepth;
+#else
+		UNUSED(stack);
+		return 0;
+#endif
+	}
+
+	void StartAllocationSampling(const size sampleInterval) noexcept
+	{
+		Assert(sampleInterval > 0);
+		ThreadSamplingState& state = threadSamplingState;
+		state.m_isInsideProfiler = true;
+
+		Internal::allocationSampleInterval = 0;
+		if (pSampleBuckets == nullptr)
+		{
+			pSampleBuckets = static_cast<SampleBucket*>(Memory::AllocateAligned(sizeof(SampleBucket) * SampleBucketCount, alignof(SampleBucket)));
+		}
+		for (SampleBucket& bucket : ArrayView<SampleBucket, uint32>{pSampleBuckets, SampleBucketCount})
+		{
+			for (Threading::Atomic<uintptr>& address : bucket.m_addresses)
+			{
+				address = 0;
+			}
+		}
+		Internal::liveAllocationSampleCount = 0;
+		droppedSampleCount = 0;
+		reportedSampleInterval = sampleInterval;
+		Internal::allocationSampleInterval = sampleInterval;
+
+		state.m_isInsideProfiler = false;
+	}
+
+	void StopAllocationSampling() noexcept
+	{
+		Internal::allocationSampleInterval = 0;
+	}
+
+	bool IsSamplingAllocations() noexcept
+	{
+		return (size)Internal::allocationSampleInterval != 0;
+	}
+
+	namespace Internal
+	{
+		void SampleAllocation(void* pAllocation, const size allocationSize) noexcept
+		{
+			ThreadSamplingState& state = threadSamplingState;
+			state.m_bytesUntilNextSample -= static_cast<intptr>(allocationSize);
+			if (LIKELY(state.m_bytesUntilNextSample > 0) || state.m_isInsideProfiler || pAllocation == nullptr)
+			{
+				return;
+			}
+
+			const size sampleInterval = allocationSampleInterval;
+			if (UNLIKELY(sampleInterval == 0))
+			{
+				return;
+			}
+
+			if (state.m_randomState == 0)
+			{
+				// First allocation on this thread, start counting instead of sampling
+				state.m_randomState = reinterpret_cast<uintptr>(&state) | 1;
+				state.m_bytesUntilNextSample = GetNextSampleDistance(state, sampleInterval);
+				return;
+			}
+			state.m_bytesUntilNextSample = GetNextSampleDistance(state, sampleInterval);
+
+			state.m_isInsideProfiler = true;
+			SampleBucket& bucket = GetSampleBucket(reinterpret_cast<uintptr>(pAllocation));
+			bool wasSampled = false;
+			for (uint32 slotIndex = 0; slotIndex < SampleBucketSize; ++slotIndex)
+			{
+				uintptr expectedAddress = 0;
+				if (bucket.m_addresses[slotIndex].CompareExchangeStrong(expectedAddress, WritingSampleAddress))
+				{
+					AllocationSample& sample = bucket.m_samples[slotIndex];
+					// Each sample stands for the interval worth of bytes allocated since the previous one
+					sample.m_estimatedSize = Math::Max(allocationSize, sampleInterval);
+					sample.m_tag = GetCurrentUsageTag();
+					sample.m_stackDepth = CaptureStack(sample.m_stack);
+					liveAllocationSampleCount++;
+					bucket.m_addresses[slotIndex] = reinterpret_cast<uintptr>(pAllocation);
+					wasSampled = true;
+					break;
+				}
+			}
+			if (!wasSampled)
+			{
+				droppedSampleCount++;
+			}
+			state.m_isInsideProfiler = false;
+		}
+
+		void ReleaseAllocationSample(void* pAllocation) noexcept
+		{
+			const uintptr address = reinterpret_cast<uintptr>(pAllocation);
+			SampleBucket& bucket = GetSampleBucket(address);
+			for (Threading::Atomic<uintptr>& sampledAddress : bucket.m_addresses)
+			{
+				uintptr expectedAddress = address;
+				if (sampledAddress == address && sampledAddress.CompareExchangeStrong(expectedAddress, 0))
+				{
+					liveAllocationSampleCount--;
+					return;
+				}
+			}
+		}
+	}
+
+	void AppendFrame(String& string, void* pAddress)
+	{
+		String frame;
+#if PLATFORM_WINDOWS
+		constexpr DWORD flags = GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS | GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT;
+		HMODULE module;
+		char modulePath[MAX_PATH];
+		if (GetModuleHandleExA(flags, reinterpret_cast<LPCSTR>(pAddress), &module) && GetModuleFileNameA(module, modulePath, MAX_PATH) != 0)
+		{
+			const char* moduleName = strrchr(modulePath, '\\');
+			moduleName = moduleName != nullptr ? moduleName + 1 : modulePath;
+			frame.Format("{}+0x{:x}", moduleName, reinterpret_cast<uintptr>(pAddress) - reinterpret_cast<uintptr>(module));
+		}
+#elif PLATFORM_LINUX || PLATFORM_APPLE
+		Dl_info info;
+		if (dladdr(pAddress, &info) != 0)
+		{
+			if (info.dli_sname != nullptr)
+			{
+				// Offsets within a function change between builds, only the symbol is kept
+				frame.Format("{}", info.dli_sname);
+			}
+			else if (info.dli_fname != nullptr)
+			{
+				const char* moduleName = strrchr(info.dli_fname, '/');
+				moduleName = moduleName != nullptr ? moduleName + 1 : info.dli_fname;
+				frame.Format("{}+0x{:x}", moduleName, reinterpret_cast<uintptr>(pAddress) - reinterpret_cast<uintptr>(info.dli_fbase));
+			}
+		}
+#endif
+		if (frame.IsEmpty())
+		{
+			frame.Format("0x{:x}", reinterpret_cast<uintptr>(pAddress));
+		}
+		string += frame;
+	}
+
+	String GetAllocationSampleReport()
+	{
+		ThreadSamplingState& state = threadSamplingState;
+		const bool wasInsideProfiler = state.m_isInsideProfiler;
+		state.m_isInsideProfiler = true;
+
+		struct ReportEntry
+		{
+			String m_key;
+			size m_estimatedSize;
+			uint32 m_sampleCount;
+		};
+		Vector<ReportEntry, uint32> entries;
+
+		if (pSampleBuckets != nullptr)
+		{
+			for (const SampleBucket& bucket : ArrayView<const SampleBucket, uint32>{pSampleBuckets, SampleBucketCount})
+			{
+				for (uint32 slotIndex = 0; slotIndex < SampleBucketSize; ++slotIndex)
+				{
+					if (bucket.m_addresses[slotIndex] <= WritingSampleAddress)
+					{
+						continue;
+					}
+
+					const AllocationSample& sample = bucket.m_samples[slotIndex];
+					String key(GetUsageTagName(sample.m_tag));
+					key += '\t';
+					for (uint8 frameIndex = 0; frameIndex < sample.m_stackDepth; ++frameIndex)
+					{
+						if (frameIndex > 0)
+						{
+							key += ';';
+						}
+						AppendFrame(key, sample.m_stack[frameIndex]);
+					}
+					entries.EmplaceBack(ReportEntry{Move(key), sample.m_estimatedSize, 1});
+				}
+			}
+		}
+
+		Algorithms::Sort(
+			entries.begin().Get(),
+			entries.end().Get(),
+			[](const ReportEntry& left, const ReportEntry& right)
+			{
+				return left.m_key.GetView() < right.m_key.GetView();
+			}
+		);
+
+		String report;
+		report.Format(
+			"# Allocation samples, interval {} bytes, {} dropped\n# <estimated bytes>\t<sample count>\t<tag>\t<call stack>\n",
+			reportedSampleInterval,
+			(size)droppedSampleCount
+		);
+		String line;
+		for (uint32 entryIndex = 0, entryCount = entries.GetSize(); entryIndex < entryCount;)
+		{
+			// Merge samples with the same tag and call stack
+			const ReportEntry& entry = entries[entryIndex];
+			size estimatedSize = 0;
+			uint32 sampleCount = 0;
+			uint32 nextEntryIndex = entryIndex;
+			for (; nextEntryIndex < entryCount && entries[nextEntryIndex].m_key == entry.m_key; ++nextEntryIndex)
+			{
+				estimatedSize += entries[nextEntryIndex].m_estimatedSize;
+				sampleCount += entries[nextEntryIndex].m_sampleCount;
+			}
+
+			line.Format("{}\t{}\t{}\n", estimatedSize, sampleCount, entry.m_key);
+			report += line;
+			entryIndex = nextEntryIndex;
+		}
+
+		state.m_isInsideProfiler = wasInsideProfiler;
+		return report;
+	}
+}
@@ -0,0 +1,155 @@
+#include "Memory/Allocators/Arena.h"
+
+#include <Common/Memory/Copy.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Max.h>
+
+namespace ngine::Memory
+{
+	struct alignas(Arena::DefaultAlignment) Arena::Block
+	{
+		[[nodiscard]] uintptr GetBegin() const
+		{
+			return reinterpret_cast<uintptr>(this + 1);
+		}
+		[[nodiscard]] uintptr GetEnd() const
+		{
+			return GetBegin() + m_size;
+		}
+
+		Block* m_pNext;
+		size m_size;
+	};
+
+	void* Arena::AllocateFromNextBlock(const size requestedSize, const size alignment) noexcept
+	{
+		const size requiredBlockSize = requestedSize + alignment;
+
+		// Reuse blocks kept from before the last reset
+		Block* pPreviousBlock = m_pCurrentBlock;
+		Block* pBlock = m_pCurrentBlock != nullptr ? m_pCurrentBlock->m_pNext : m_pFirstBlock;
+		while (pBlock != nullptr && pBlock->m_size < requiredBlockSize)
+		{
+			pPreviousBlock = pBlock;
+			pBlock = pBlock->m_pNext;
+		}
+
+		if (pBlock == nullptr)
+		{
+			const size blockSize = Math::Max(m_blockSize, requiredBlockSize);
+			pBlock = static_cast<Block*>(Memory::Allocate(sizeof(Block) + blockSize));
+			if (UNLIKELY(pBlock == nullptr))
+			{
+				return nullptr;
+			}
+			pBlock->m_pNext = nullptr;
+			pBlock->m_size = blockSize;
+			if (pPreviousBlock != nullptr)
+			{
+				pPreviousBlock->m_pNext = pBlock;
+			}
+			else
+			{
+				m_pFirstBlock = pBlock;
+			}
+		}
+		else if (pPreviousBlock != m_pCurrentBlock)
+		{
+			// Move the fitting block up so skipped blocks remain available after it
+			pPreviousBlock->m_pNext = pBlock->m_pNext;
+			Block*& pInsertionPoint = m_pCurrentBlock != nullptr ? m_pCurrentBlock->m_pNext : m_pFirstBlock;
+			pBlock->m_pNext = pInsertionPoint;
+			pInsertionPoint = pBlock;
+		}
+
+		m_pCurrentBlock = pBlock;
+		const uintptr position = Memory::Align(pBlock->GetBegin(), alignment);
+		m_position = position + requestedSize;
+		m_end = pBlock->GetEnd();
+		m_lastAllocation = position;
+		return reinterpret_cast<void*>(position);
+	}
+
+	void* Arena::Reallocate(void* pData, const size previousSize, const size requestedSize, const size alignment) noexcept
+	{
+		if (pData == nullptr)
+		{
+			return Allocate(requestedSize, alignment);
+		}
+
+		const uintptr position = reinterpret_cast<uintptr>(pData);
+		if (position == m_lastAllocation && position + requestedSize <= m_end)
+		{
+			m_position = position + requestedSize;
+			return pData;
+		}
+
+		void* pNewData = Allocate(requestedSize, alignment);
+		if (LIKELY(pNewData != nullptr))
+		{
+			Memory::CopyWithoutOverlap(pNewData, pData, Math::Min(previousSize, requestedSize));
+		}
+		return pNewData;
+	}
+
+	void Arena::ResetToMarker(const Marker marker) noexcept
+	{
+		m_lastAllocation = 0;
+		if (marker.m_pBlock != nullptr)
+		{
+			m_pCurrentBlock = marker.m_pBlock;
+			m_position = marker.m_position;
+			m_end = marker.m_pBlock->GetEnd();
+		}
+		else if (m_pFirstBlock != nullptr)
+		{
+			// Marker was taken before the first allocation, start over from the first block
+			m_pCurrentBlock = m_pFirstBlock;
+			m_position = m_pFirstBlock->GetBegin();
+			m_end = m_pFirstBlock->GetEnd();
+		}
+	}
+
+	void Arena::ReleaseMemory() noexcept
+	{
+		Block* pBlock = m_pFirstBlock;
+		while (pBlock != nullptr)
+		{
+			Block* pNextBlock = pBlock->m_pNext;
+			Memory::Deallocate(pBlock);
+			pBlock = pNextBlock;
+		}
+		m_pFirstBlock = nullptr;
+		m_pCurrentBlock = nullptr;
+		m_position = 0;
+		m_end = 0;
+		m_lastAllocation = 0;
+	}
+
+	bool Arena::Contains(const void* pData) const
+	{
+		const uintptr position = reinterpret_cast<uintptr>(pData);
+		for (const Block* pBlock = m_pFirstBlock; pBlock != nullptr; pBlock = pBlock->m_pNext)
+		{
+			if (pBlock == m_pCurrentBlock)
+			{
+				return position >= pBlock->GetBegin() && position < m_position;
+			}
+			if (position >= pBlock->GetBegin() && position < pBlock->GetEnd())
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	size Arena::GetReservedSize() const
+	{
+		size reservedSize = 0;
+		for (const Block* pBlock = m_pFirstBlock; pBlock != nullptr; pBlock = pBlock->m_pNext)
+		{
+			reservedSize += pBlock->m_size;
+		}
+		return reservedSize;
+	}
+}
@@ -0,0 +1,57 @@
+#include "Memory/Allocators/MemoryUsage.h"
+
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Threading/Mutexes/UniqueLock.h>
+#include <Common/Assert/Assert.h>
+#include <Common/Platform/Likely.h>
+
+namespace ngine::Memory
+{
+	struct UsageTagRegistry
+	{
+		UsageTagRegistry()
+		{
+			m_names[UntaggedUsage] = "Untagged";
+		}
+
+		Threading::Mutex m_mutex;
+		Array<ConstStringView, MaximumUsageTagCount> m_names;
+		uint16 m_count{1};
+	};
+
+	[[nodiscard]] static UsageTagRegistry& GetUsageTagRegistry()
+	{
+		// Constructed on first use, as tags are typically registered during static initialization
+		static UsageTagRegistry registry;
+		return registry;
+	}
+
+	UsageTag RegisterUsageTag(const ConstStringView name) noexcept
+	{
+		UsageTagRegistry& registry = GetUsageTagRegistry();
+		Threading::UniqueLock lock(registry.m_mutex);
+		for (uint16 tag = 0; tag < registry.m_count; ++tag)
+		{
+			if (registry.m_names[tag] == name)
+			{
+				return static_cast<UsageTag>(tag);
+			}
+		}
+
+		if (UNLIKELY_ERROR(registry.m_count == MaximumUsageTagCount))
+		{
+			Assert(false, "Exceeded the maximum number of memory usage tags");
+			return UntaggedUsage;
+		}
+
+		registry.m_names[registry.m_count] = name;
+		return static_cast<UsageTag>(registry.m_count++);
+	}
+
+	ConstStringView GetUsageTagName(const UsageTag tag) noexcept
+	{
+		UsageTagRegistry& registry = GetUsageTagRegistry();
+		Threading::UniqueLock lock(registry.m_mutex);
+		return tag < registry.m_count ? registry.m_names[tag] : ConstStringView{};
+	}
+}
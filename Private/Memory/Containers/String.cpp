@@ -14,8 +14,6 @@
 #include <string_view>
 #include <string>
 #include <iostream>
-#include <locale>
-#include <codecvt>
 
 #if PLATFORM_WINDOWS
 #include <uchar.h>
@@ -27,326 +25,369 @@
 #include <Common/Serialization/Writer.h>
 
 #include <Common/TypeTraits/IsSame.h>
+#include <Common/Memory/CountBits.h>
+#include <Common/Math/Min.h>
+
+#if USE_SSE || USE_WASM_SIMD128
+#include <Common/Math/Vectorization/PackedInt8.h>
+#endif
 
 namespace ngine
 {
 	namespace Internal
 	{
-		PUSH_MSVC_WARNINGS
-		DISABLE_MSVC_WARNINGS(4996)
+		//! Code point written in place of invalid sequences
+		inline static constexpr char32_t ReplacementCharacter = 0xFFFD;
+		inline static constexpr char32_t MaximumCodePoint = 0x10FFFF;
 
-		PUSH_CLANG_WARNINGS
-		DISABLE_CLANG_WARNING("-Wdeprecated-declarations")
-
-		bool UTF8ToUTF16(TStringView<char16_t> destination, const TStringView<const UTF8CharType> source) noexcept
+		[[nodiscard]] FORCE_INLINE static bool IsSurrogate(const char32_t codePoint)
 		{
-			Assert(destination.GetSize() >= source.GetSize());
-
-			using Converter = std::codecvt_utf8_utf16<char16_t>;
-			static thread_local Converter converter;
-			mbstate_t state = {};
-
-			const UTF8CharType* firstSource = source.begin();
-			const UTF8CharType* lastSource = source.end();
+			return (codePoint >= 0xD800) & (codePoint <= 0xDFFF);
+		}
 
-			char16_t* firstDestination = destination.begin();
-			char16_t* lastDestination = destination.end();
-			char16_t* nextDestination;
+		//! Returns the number of code units at the start of the source that are ASCII
+		template<typename SourceUnitType>
+		[[nodiscard]] FORCE_INLINE static size GetASCIILength(const SourceUnitType* pSource, const size count)
+		{
+			size index = 0;
+#if USE_SSE || USE_WASM_SIMD128
+			using PackedBytes = Math::Vectorization::Packed<uint8, 16>;
+			constexpr size UnitsPerVector = 16 / sizeof(SourceUnitType);
+
+			// Bits that are set in any code unit above 0x7F, code units are little endian on all platforms with these instruction sets
+			alignas(16) uint8 nonASCIIBitBytes[16];
+			for (size byteIndex = 0; byteIndex < 16; ++byteIndex)
+			{
+				nonASCIIBitBytes[byteIndex] = byteIndex % sizeof(SourceUnitType) == 0 ? 0x80 : 0xFF;
+			}
+			const PackedBytes nonASCIIBits(Math::Vectorization::LoadAligned, nonASCIIBitBytes);
+			const PackedBytes zero(Math::Zero);
 
-			for (; firstSource != lastSource;)
+			for (; index + UnitsPerVector <= count; index += UnitsPerVector)
 			{
-				switch (converter.in(state, firstSource, lastSource, firstSource, firstDestination, lastDestination, nextDestination))
+				const PackedBytes units(Math::Vectorization::LoadUnaligned, reinterpret_cast<const uint8*>(pSource + index));
+				const uint32 nonASCIIMask = uint32(((units & nonASCIIBits) == zero).GetMask()) ^ 0xFFFFu;
+				if (nonASCIIMask != 0)
+				{
+					return index + Memory::GetNumberOfTrailingZeros(nonASCIIMask) / uint32(sizeof(SourceUnitType));
+				}
+			}
+#else
+			// Without a native byte mask, check blocks of units at once and only find the exact position in the last block
+			constexpr size UnitsPerBlock = 8;
+			for (; index + UnitsPerBlock <= count; index += UnitsPerBlock)
+			{
+				SourceUnitType combinedUnits = 0;
+				for (size unitIndex = 0; unitIndex < UnitsPerBlock; ++unitIndex)
+				{
+					combinedUnits |= pSource[index + unitIndex];
+				}
+				if (combinedUnits >= 0x80)
 				{
-					case Converter::partial:
-					case Converter::ok:
-					{
-						if (firstDestination < nextDestination)
-						{
-							firstDestination = nextDestination;
-						}
-						else
-						{
-							return false;
-						}
-					}
 					break;
-					case Converter::noconv:
-					{
-						for (; firstSource != lastSource; ++firstSource, ++firstDestination)
-						{
-							*firstDestination = static_cast<char16_t>(static_cast<unsigned char>(*firstSource));
-						}
-						return true;
-					}
-					case Converter::error:
-						return false;
-					default:
-						ExpectUnreachable();
 				}
 			}
-			return true;
+#endif
+
+			for (; index < count && pSource[index] < 0x80; ++index)
+			{
+			}
+			return index;
 		}
 
-		bool UTF8ToUTF32(TStringView<char32_t> destination, const TStringView<const UTF8CharType> source) noexcept
+		//! Decodes one code point and advances the source, invalid sequences decode to the replacement character
+		//! @returns false if the sequence was invalid
+		[[nodiscard]] FORCE_INLINE static bool Decode(const uint8*& pSource, const uint8* const pSourceEnd, char32_t& codePointOut)
 		{
-			Assert(destination.GetSize() >= source.GetSize());
-
-			using Converter = std::codecvt_utf8<char32_t>;
-			static thread_local Converter converter;
-			mbstate_t state = {};
-
-			const UTF8CharType* firstSource = source.begin();
-			const UTF8CharType* lastSource = source.end();
+			const uint8 leadingByte = *pSource++;
+			if (leadingByte < 0x80)
+			{
+				codePointOut = leadingByte;
+				return true;
+			}
 
-			char32_t* firstDestination = destination.begin();
-			char32_t* lastDestination = destination.end();
-			char32_t* nextDestination;
+			uint8 continuationCount;
+			char32_t minimumCodePoint;
+			char32_t codePoint;
+			if ((leadingByte & 0xE0) == 0xC0)
+			{
+				continuationCount = 1;
+				minimumCodePoint = 0x80;
+				codePoint = leadingByte & 0x1F;
+			}
+			else if ((leadingByte & 0xF0) == 0xE0)
+			{
+				continuationCount = 2;
+				minimumCodePoint = 0x800;
+				codePoint = leadingByte & 0x0F;
+			}
+			else if ((leadingByte & 0xF8) == 0xF0)
+			{
+				continuationCount = 3;
+				minimumCodePoint = 0x10000;
+				codePoint = leadingByte & 0x07;
+			}
+			else
+			{
+				codePointOut = ReplacementCharacter;
+				return false;
+			}
 
-			for (; firstSource != lastSource;)
+			for (; continuationCount > 0; --continuationCount)
 			{
-				switch (converter.in(state, firstSource, lastSource, firstSource, firstDestination, lastDestination, nextDestination))
+				// Truncated sequences leave the next byte to be decoded on its own
+				if (pSource == pSourceEnd || (*pSource & 0xC0) != 0x80)
 				{
-					case Converter::partial:
-					case Converter::ok:
-					{
-						if (firstDestination < nextDestination)
-						{
-							firstDestination = nextDestination;
-						}
-						else
-						{
-							return false;
-						}
-					}
-					break;
-					case Converter::noconv:
-					{
-						for (; firstSource != lastSource; ++firstSource, ++firstDestination)
-						{
-							*firstDestination = static_cast<char32_t>(static_cast<unsigned char>(*firstSource));
-						}
-						return true;
-					}
-					case Converter::error:
-						return false;
-					default:
-						ExpectUnreachable();
+					codePointOut = ReplacementCharacter;
+					return false;
 				}
+				codePoint = (codePoint << 6) | (*pSource++ & 0x3F);
 			}
+
+			// Reject overlong encodings, encoded surrogates and code points past the unicode range
+			if ((codePoint < minimumCodePoint) | (codePoint > MaximumCodePoint) | IsSurrogate(codePoint))
+			{
+				codePointOut = ReplacementCharacter;
+				return false;
+			}
+			codePointOut = codePoint;
 			return true;
 		}
 
-		bool UTF16ToUTF8(TStringView<UTF8CharType> destination, const TStringView<const char16_t> source) noexcept
+		[[nodiscard]] FORCE_INLINE static bool Decode(const char16_t*& pSource, const char16_t* const pSourceEnd, char32_t& codePointOut)
 		{
-			Assert(destination.GetSize() >= source.GetSize());
-
-			using Converter = std::codecvt_utf8_utf16<char16_t>;
-			static thread_local Converter converter;
-			mbstate_t state = {};
+			const char32_t unit = *pSource++;
+			if (!IsSurrogate(unit))
+			{
+				codePointOut = unit;
+				return true;
+			}
 
-			const char16_t* firstSource = source.begin();
-			const char16_t* lastSource = source.end();
+			if (unit <= 0xDBFF && pSource != pSourceEnd && (*pSource >= 0xDC00) & (*pSource <= 0xDFFF))
+			{
+				codePointOut = 0x10000 + ((unit - 0xD800) << 10) + (char32_t(*pSource++) - 0xDC00);
+				return true;
+			}
 
-			UTF8CharType* firstDestination = destination.begin();
-			UTF8CharType* lastDestination = destination.end();
-			UTF8CharType* nextDestination;
+			codePointOut = ReplacementCharacter;
+			return false;
+		}
 
-			for (; firstSource != lastSource;)
+		[[nodiscard]] FORCE_INLINE static bool Decode(const char32_t*& pSource, const char32_t* const, char32_t& codePointOut)
+		{
+			const char32_t codePoint = *pSource++;
+			if ((codePoint > MaximumCodePoint) | IsSurrogate(codePoint))
 			{
-				switch (converter.out(state, firstSource, lastSource, firstSource, firstDestination, lastDestination, nextDestination))
-				{
-					case Converter::partial:
-					case Converter::ok:
-					{
-						if (firstDestination < nextDestination)
-						{
-							firstDestination = nextDestination;
-						}
-						else
-						{
-							return false;
-						}
-					}
-					break;
-					case Converter::noconv:
-					{
-						for (; firstSource != lastSource; ++firstSource, ++firstDestination)
-						{
-							*firstDestination = static_cast<UTF8CharType>(static_cast<unsigned char>(*firstSource));
-						}
-						return true;
-					}
-					case Converter::error:
-						return false;
-					default:
-						ExpectUnreachable();
-				}
+				codePointOut = ReplacementCharacter;
+				return false;
 			}
+			codePointOut = codePoint;
 			return true;
 		}
 
-		bool UTF16ToUTF32(TStringView<char32_t> destination, const TStringView<const char16_t> source) noexcept
+		template<typename TargetUnitType>
+		[[nodiscard]] FORCE_INLINE static size GetEncodedLength(const char32_t codePoint)
+		{
+			if constexpr (sizeof(TargetUnitType) == 1)
+			{
+				return 1 + (codePoint >= 0x80) + (codePoint >= 0x800) + (codePoint >= 0x10000);
+			}
+			else if constexpr (sizeof(TargetUnitType) == 2)
+			{
+				return 1 + (codePoint >= 0x10000);
+			}
+			else
+			{
+				return 1;
+			}
+		}
+
+		FORCE_INLINE static void Encode(const char32_t codePoint, uint8* pDestination)
 		{
-			Assert(destination.GetSize() >= source.GetSize());
+			if (codePoint < 0x80)
+			{
+				pDestination[0] = uint8(codePoint);
+			}
+			else if (codePoint < 0x800)
+			{
+				pDestination[0] = uint8(0xC0 | (codePoint >> 6));
+				pDestination[1] = uint8(0x80 | (codePoint & 0x3F));
+			}
+			else if (codePoint < 0x10000)
+			{
+				pDestination[0] = uint8(0xE0 | (codePoint >> 12));
+				pDestination[1] = uint8(0x80 | ((codePoint >> 6) & 0x3F));
+				pDestination[2] = uint8(0x80 | (codePoint & 0x3F));
+			}
+			else
+			{
+				pDestination[0] = uint8(0xF0 | (codePoint >> 18));
+				pDestination[1] = uint8(0x80 | ((codePoint >> 12) & 0x3F));
+				pDestination[2] = uint8(0x80 | ((codePoint >> 6) & 0x3F));
+				pDestination[3] = uint8(0x80 | (codePoint & 0x3F));
+			}
+		}
 
-			using Converter = std::codecvt_utf16<char32_t>;
-			static thread_local Converter converter;
-			mbstate_t state = {};
+		FORCE_INLINE static void Encode(const char32_t codePoint, char16_t* pDestination)
+		{
+			if (codePoint < 0x10000)
+			{
+				pDestination[0] = char16_t(codePoint);
+			}
+			else
+			{
+				pDestination[0] = char16_t(0xD800 + ((codePoint - 0x10000) >> 10));
+				pDestination[1] = char16_t(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+			}
+		}
 
-			const char* firstSource = reinterpret_cast<const char*>(source.begin().Get());
-			const char* lastSource = reinterpret_cast<const char*>(source.end().Get());
+		FORCE_INLINE static void Encode(const char32_t codePoint, char32_t* pDestination)
+		{
+			pDestination[0] = codePoint;
+		}
 
-			char32_t* firstDestination = destination.begin();
-			char32_t* lastDestination = destination.end();
-			char32_t* nextDestination;
+		//! Returns the number of code units the source converts to
+		//! Invalid sequences are counted as the replacement character they are converted to, so the result always matches Transcode.
+		template<typename TargetUnitType, typename SourceUnitType>
+		[[nodiscard]] static size GetTranscodedLength(const SourceUnitType* pSource, const SourceUnitType* const pSourceEnd)
+		{
+			size length = 0;
+			while (pSource != pSourceEnd)
+			{
+				if (*pSource < 0x80)
+				{
+					const size asciiLength = GetASCIILength(pSource, size(pSourceEnd - pSource));
+					length += asciiLength;
+					pSource += asciiLength;
+				}
+				else
+				{
+					char32_t codePoint;
+					[[maybe_unused]] const bool isValid = Decode(pSource, pSourceEnd, codePoint);
+					length += GetEncodedLength<TargetUnitType>(codePoint);
+				}
+			}
+			return length;
+		}
 
-			for (; firstSource != lastSource;)
+		//! Converts the source to the destination encoding
+		//! Runs of ASCII are copied directly, everything else is decoded and encoded one code point at a time.
+		//! @returns false if the source contained invalid sequences that were replaced, or if the destination was too small
+		template<typename TargetUnitType, typename SourceUnitType>
+		static bool Transcode(
+			TargetUnitType* pDestination,
+			TargetUnitType* const pDestinationEnd,
+			const SourceUnitType* pSource,
+			const SourceUnitType* const pSourceEnd
+		)
+		{
+			bool isValid = true;
+			while (pSource != pSourceEnd)
 			{
-				switch (converter.in(state, firstSource, lastSource, firstSource, firstDestination, lastDestination, nextDestination))
+				if (*pSource < 0x80)
 				{
-					case Converter::partial:
-					case Converter::ok:
+					const size copiedLength =
+						GetASCIILength(pSource, Math::Min(size(pSourceEnd - pSource), size(pDestinationEnd - pDestination)));
+					if (UNLIKELY_ERROR(copiedLength == 0))
 					{
-						if (firstDestination < nextDestination)
-						{
-							firstDestination = nextDestination;
-						}
-						else
-						{
-							return false;
-						}
+						return false;
 					}
-					break;
-					case Converter::noconv:
+					for (size index = 0; index < copiedLength; ++index)
 					{
-						for (; firstSource != lastSource; ++firstSource, ++firstDestination)
-						{
-							*firstDestination = static_cast<char16_t>(static_cast<unsigned char>(*firstSource));
-						}
-						return true;
+						pDestination[index] = TargetUnitType(pSource[index]);
 					}
-					case Converter::error:
+					pSource += copiedLength;
+					pDestination += copiedLength;
+				}
+				else
+				{
+					char32_t codePoint;
+					isValid &= Decode(pSource, pSourceEnd, codePoint);
+					const size encodedLength = GetEncodedLength<TargetUnitType>(codePoint);
+					if (UNLIKELY_ERROR(size(pDestinationEnd - pDestination) < encodedLength))
+					{
 						return false;
-					default:
-						ExpectUnreachable();
+					}
+					Encode(codePoint, pDestination);
+					pDestination += encodedLength;
 				}
 			}
+			return isValid;
+		}
 
-			for (char16_t& character : ArrayView<char16_t>{(char16_t*)destination.GetData(), uint32(destination.GetSize() * 2)})
-			{
-				character = (char16_t)Memory::ByteSwap((uint16)character);
-			}
-
-			return true;
+		template<typename TargetUnitType, typename TargetCharType, typename SourceUnitType, typename SourceCharType>
+		static bool Transcode(const TStringView<TargetCharType> destination, const TStringView<const SourceCharType> source)
+		{
+			TargetUnitType* pDestination = reinterpret_cast<TargetUnitType*>(destination.GetData());
+			const SourceUnitType* pSource = reinterpret_cast<const SourceUnitType*>(source.GetData());
+			return Transcode(pDestination, pDestination + destination.GetSize(), pSource, pSource + source.GetSize());
 		}
 
-		bool UTF32ToUTF8(TStringView<UTF8CharType> destination, const TStringView<const char32_t> source) noexcept
+		template<typename TargetUnitType, typename SourceUnitType, typename SourceCharType>
+		[[nodiscard]] static size GetTranscodedLength(const TStringView<const SourceCharType> source)
 		{
-			Assert(destination.GetSize() >= source.GetSize());
+			const SourceUnitType* pSource = reinterpret_cast<const SourceUnitType*>(source.GetData());
+			return GetTranscodedLength<TargetUnitType>(pSource, pSource + source.GetSize());
+		}
 
-			using Converter = std::codecvt_utf8<char32_t>;
-			static thread_local Converter converter;
-			mbstate_t state = {};
+		bool UTF8ToUTF16(const TStringView<char16_t> destination, const TStringView<const UTF8CharType> source) noexcept
+		{
+			return Transcode<char16_t, char16_t, uint8>(destination, source);
+		}
 
-			const char32_t* firstSource = source.begin();
-			const char32_t* lastSource = source.end();
+		bool UTF8ToUTF32(const TStringView<char32_t> destination, const TStringView<const UTF8CharType> source) noexcept
+		{
+			return Transcode<char32_t, char32_t, uint8>(destination, source);
+		}
 
-			UTF8CharType* firstDestination = reinterpret_cast<char*>(destination.begin().Get());
-			UTF8CharType* lastDestination = reinterpret_cast<char*>(destination.end().Get());
-			UTF8CharType* nextDestination;
+		bool UTF16ToUTF8(const TStringView<UTF8CharType> destination, const TStringView<const char16_t> source) noexcept
+		{
+			return Transcode<uint8, UTF8CharType, char16_t>(destination, source);
+		}
 
-			for (; firstSource != lastSource;)
-			{
-				switch (converter.out(state, firstSource, lastSource, firstSource, firstDestination, lastDestination, nextDestination))
-				{
-					case Converter::partial:
-					case Converter::ok:
-					{
-						if (firstDestination < nextDestination)
-						{
-							firstDestination = nextDestination;
-						}
-						else
-						{
-							return false;
-						}
-					}
-					break;
-					case Converter::noconv:
-					{
-						for (; firstSource != lastSource; ++firstSource, ++firstDestination)
-						{
-							*firstDestination = static_cast<UTF8CharType>(static_cast<unsigned char>(*firstSource));
-						}
-						return true;
-					}
-					case Converter::error:
-						return false;
-					default:
-						ExpectUnreachable();
-				}
-			}
-			return true;
+		bool UTF16ToUTF32(const TStringView<char32_t> destination, const TStringView<const char16_t> source) noexcept
+		{
+			return Transcode<char32_t, char32_t, char16_t>(destination, source);
 		}
 
-		bool UTF32ToUTF16(TStringView<char16_t> destination, const TStringView<const char32_t> source) noexcept
+		bool UTF32ToUTF8(const TStringView<UTF8CharType> destination, const TStringView<const char32_t> source) noexcept
 		{
-			Assert(destination.GetSize() >= source.GetSize());
+			return Transcode<uint8, UTF8CharType, char32_t>(destination, source);
+		}
 
-			using Converter = std::codecvt_utf16<char32_t>;
-			static thread_local Converter converter;
-			mbstate_t state = {};
+		bool UTF32ToUTF16(const TStringView<char16_t> destination, const TStringView<const char32_t> source) noexcept
+		{
+			return Transcode<char16_t, char16_t, char32_t>(destination, source);
+		}
 
-			const char32_t* firstSource = source.begin();
-			const char32_t* lastSource = source.end();
+		size GetUTF16Length(const TStringView<const UTF8CharType> source) noexcept
+		{
+			return GetTranscodedLength<char16_t, uint8>(source);
+		}
 
-			char* firstDestination = reinterpret_cast<char*>(destination.begin().Get());
-			char* lastDestination = reinterpret_cast<char*>(destination.end().Get());
-			char* nextDestination;
+		size GetUTF32Length(const TStringView<const UTF8CharType> source) noexcept
+		{
+			return GetTranscodedLength<char32_t, uint8>(source);
+		}
 
-			for (; firstSource != lastSource;)
-			{
-				switch (converter.out(state, firstSource, lastSource, firstSource, firstDestination, lastDestination, nextDestination))
-				{
-					case Converter::partial:
-					case Converter::ok:
-					{
-						if (firstDestination < nextDestination)
-						{
-							firstDestination = nextDestination;
-						}
-						else
-						{
-							return false;
-						}
-					}
-					break;
-					case Converter::noconv:
-					{
-						for (; firstSource != lastSource; ++firstSource, ++firstDestination)
-						{
-							*firstDestination = static_cast<char>(static_cast<unsigned char>(*firstSource));
-						}
+		size GetUTF8Length(const TStringView<const char16_t> source) noexcept
+		{
+			return GetTranscodedLength<uint8, char16_t>(source);
+		}
 
-						for (char16_t& character : destination)
-						{
-							character = (char16_t)Memory::ByteSwap((uint16)character);
-						}
+		size GetUTF32Length(const TStringView<const char16_t> source) noexcept
+		{
+			return GetTranscodedLength<char32_t, char16_t>(source);
+		}
 
-						return true;
-					}
-					case Converter::error:
-						return false;
-					default:
-						ExpectUnreachable();
-				}
-			}
+		size GetUTF8Length(const TStringView<const char32_t> source) noexcept
+		{
+			return GetTranscodedLength<uint8, char32_t>(source);
+		}
 
-			for (char16_t& character : destination)
-			{
-				character = (char16_t)Memory::ByteSwap((uint16)character);
-			}
-			return true;
+		size GetUTF16Length(const TStringView<const char32_t> source) noexcept
+		{
+			return GetTranscodedLength<char16_t, char32_t>(source);
 		}
 
 		UnicodeString FromModifiedUTF8(TStringView<const char> source) noexcept
@@ -433,8 +474,6 @@ namespace ngine
 
 			return destination;
 		}
-		POP_CLANG_WARNINGS
-		POP_MSVC_WARNINGS
 	}
 
 	template<typename CharType, typename AllocatorType, unsigned char Flags>
@@ -0,0 +1,369 @@
+#include <Common/Memory/Containers/VectorizedSearch.h>
+
+#include <Common/Memory/Copy.h>
+#include <Common/Memory/Compare.h>
+#include <Common/Memory/CountBits.h>
+
+#if USE_SSE || USE_WASM_SIMD128
+#include <Common/Math/Vectorization/PackedInt8.h>
+#endif
+
+namespace ngine::Memory::VectorizedSearch
+{
+	// NEON has no native byte mask, emulating it costs more than the scalar loops save so NEON targets use the scalar paths
+#if USE_SSE || USE_WASM_SIMD128
+	using PackedBytes = Math::Vectorization::Packed<uint8, 16>;
+	inline static constexpr size VectorSize = 16;
+
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static PackedBytes Splat(const Type value)
+	{
+		if constexpr (sizeof(Type) == 1)
+		{
+			return PackedBytes(uint8(value));
+		}
+		else
+		{
+			alignas(16) uint8 bytes[VectorSize];
+			for (size offset = 0; offset < VectorSize; offset += sizeof(Type))
+			{
+				Memory::CopyWithoutOverlap(bytes + offset, &value, sizeof(Type));
+			}
+			return PackedBytes(Math::Vectorization::LoadAligned, bytes);
+		}
+	}
+
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static PackedBytes LoadElements(const uint8* pBytes, const size index)
+	{
+		return PackedBytes(Math::Vectorization::LoadUnaligned, pBytes + index * sizeof(Type));
+	}
+
+	//! Reduces a mask of matching bytes to one bit per element, set on its first byte when all of the element's bytes matched
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static uint32 GetElementMask(uint32 byteMask)
+	{
+		if constexpr (sizeof(Type) >= 2)
+		{
+			byteMask &= byteMask >> 1u;
+		}
+		if constexpr (sizeof(Type) >= 4)
+		{
+			byteMask &= byteMask >> 2u;
+		}
+		if constexpr (sizeof(Type) == 8)
+		{
+			byteMask &= byteMask >> 4u;
+		}
+
+		if constexpr (sizeof(Type) == 1)
+		{
+			return byteMask;
+		}
+		else if constexpr (sizeof(Type) == 2)
+		{
+			return byteMask & 0x5555u;
+		}
+		else if constexpr (sizeof(Type) == 4)
+		{
+			return byteMask & 0x1111u;
+		}
+		else
+		{
+			return byteMask & 0x0101u;
+		}
+	}
+
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static uint32 GetFirstElementIndex(const uint32 elementMask)
+	{
+		return Memory::GetNumberOfTrailingZeros(elementMask) / uint32(sizeof(Type));
+	}
+
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static uint32 GetLastElementIndex(const uint32 elementMask)
+	{
+		return (31u - Memory::GetNumberOfLeadingZeros(elementMask)) / uint32(sizeof(Type));
+	}
+#endif
+
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static Type LoadElement(const uint8* pBytes, const size index)
+	{
+		Type value;
+		Memory::CopyWithoutOverlap(&value, pBytes + index * sizeof(Type), sizeof(Type));
+		return value;
+	}
+
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE static bool
+	IsRangeAt(const uint8* pBytes, const size index, const uint8* pRangeBytes, const size rangeDataSize)
+	{
+		return Memory::Compare(pBytes + index * sizeof(Type), pRangeBytes, rangeDataSize) == 0;
+	}
+
+	template<typename Type>
+	size FindFirst(const void* pElements, const size count, const Type value) noexcept
+	{
+		const uint8* pBytes = static_cast<const uint8*>(pElements);
+		size index = 0;
+
+#if USE_SSE || USE_WASM_SIMD128
+		constexpr size ElementsPerVector = VectorSize / sizeof(Type);
+		if (count >= ElementsPerVector)
+		{
+			const PackedBytes splatValue = Splat(value);
+			for (; index + ElementsPerVector <= count; index += ElementsPerVector)
+			{
+				const uint32 mask = GetElementMask<Type>(uint32((LoadElements<Type>(pBytes, index) == splatValue).GetMask()));
+				if (mask != 0)
+				{
+					return index + GetFirstElementIndex<Type>(mask);
+				}
+			}
+
+			if (index < count)
+			{
+				// Overlap the last vector with elements that were already checked, none of them matched
+				index = count - ElementsPerVector;
+				const uint32 mask = GetElementMask<Type>(uint32((LoadElements<Type>(pBytes, index) == splatValue).GetMask()));
+				return mask != 0 ? index + GetFirstElementIndex<Type>(mask) : count;
+			}
+			return count;
+		}
+#endif
+
+		for (; index < count; ++index)
+		{
+			if (LoadElement<Type>(pBytes, index) == value)
+			{
+				return index;
+			}
+		}
+		return count;
+	}
+
+	template<typename Type>
+	size FindLast(const void* pElements, const size count, const Type value) noexcept
+	{
+		const uint8* pBytes = static_cast<const uint8*>(pElements);
+		size index = count;
+
+#if USE_SSE || USE_WASM_SIMD128
+		constexpr size ElementsPerVector = VectorSize / sizeof(Type);
+		if (count >= ElementsPerVector)
+		{
+			const PackedBytes splatValue = Splat(value);
+			for (; index >= ElementsPerVector; index -= ElementsPerVector)
+			{
+				const size blockIndex = index - ElementsPerVector;
+				const uint32 mask = GetElementMask<Type>(uint32((LoadElements<Type>(pBytes, blockIndex) == splatValue).GetMask()));
+				if (mask != 0)
+				{
+					return blockIndex + GetLastElementIndex<Type>(mask);
+				}
+			}
+
+			if (index > 0)
+			{
+				// Overlap the first vector with elements that were already checked, none of them matched
+				const uint32 mask = GetElementMask<Type>(uint32((LoadElements<Type>(pBytes, 0) == splatValue).GetMask()));
+				return mask != 0 ? GetLastElementIndex<Type>(mask) : count;
+			}
+			return count;
+		}
+#endif
+
+		while (index > 0)
+		{
+			--index;
+			if (LoadElement<Type>(pBytes, index) == value)
+			{
+				return index;
+			}
+		}
+		return count;
+	}
+
+	template<typename Type>
+	size FindFirstRange(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept
+	{
+		if ((rangeCount == 0) | (rangeCount > count))
+		{
+			return count;
+		}
+
+		const uint8* pBytes = static_cast<const uint8*>(pElements);
+		const uint8* pRangeBytes = static_cast<const uint8*>(pRange);
+		const size rangeDataSize = rangeCount * sizeof(Type);
+		const size startCount = count - rangeCount + 1;
+		const Type firstValue = LoadElement<Type>(pRangeBytes, 0);
+		size index = 0;
+
+#if USE_SSE || USE_WASM_SIMD128
+		constexpr size ElementsPerVector = VectorSize / sizeof(Type);
+		if (startCount >= ElementsPerVector)
+		{
+			// Each vector checks as many start positions, only those where both the first and last element match are compared in full
+			const PackedBytes splatFirstValue = Splat(firstValue);
+			const PackedBytes splatLastValue = Splat(LoadElement<Type>(pRangeBytes, rangeCount - 1));
+			for (; index + ElementsPerVector <= startCount; index += ElementsPerVector)
+			{
+				const PackedBytes firstMatches = LoadElements<Type>(pBytes, index) == splatFirstValue;
+				const PackedBytes lastMatches = LoadElements<Type>(pBytes, index + rangeCount - 1) == splatLastValue;
+				uint32 mask = GetElementMask<Type>(uint32((firstMatches & lastMatches).GetMask()));
+				while (mask != 0)
+				{
+					const size startIndex = index + GetFirstElementIndex<Type>(mask);
+					if (IsRangeAt<Type>(pBytes, startIndex, pRangeBytes, rangeDataSize))
+					{
+						return startIndex;
+					}
+					mask &= mask - 1u;
+				}
+			}
+		}
+#endif
+
+		for (; index < startCount; ++index)
+		{
+			if (LoadElement<Type>(pBytes, index) == firstValue && IsRangeAt<Type>(pBytes, index, pRangeBytes, rangeDataSize))
+			{
+				return index;
+			}
+		}
+		return count;
+	}
+
+	template<typename Type>
+	size FindLastRange(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept
+	{
+		if ((rangeCount == 0) | (rangeCount > count))
+		{
+			return count;
+		}
+
+		const uint8* pBytes = static_cast<const uint8*>(pElements);
+		const uint8* pRangeBytes = static_cast<const uint8*>(pRange);
+		const size rangeDataSize = rangeCount * sizeof(Type);
+		const Type firstValue = LoadElement<Type>(pRangeBytes, 0);
+		size index = count - rangeCount + 1;
+
+#if USE_SSE || USE_WASM_SIMD128
+		constexpr size ElementsPerVector = VectorSize / sizeof(Type);
+		if (index >= ElementsPerVector)
+		{
+			const PackedBytes splatFirstValue = Splat(firstValue);
+			const PackedBytes splatLastValue = Splat(LoadElement<Type>(pRangeBytes, rangeCount - 1));
+			for (; index >= ElementsPerVector; index -= ElementsPerVector)
+			{
+				const size blockIndex = index - ElementsPerVector;
+				const PackedBytes firstMatches = LoadElements<Type>(pBytes, blockIndex) == splatFirstValue;
+				const PackedBytes lastMatches = LoadElements<Type>(pBytes, blockIndex + rangeCount - 1) == splatLastValue;
+				uint32 mask = GetElementMask<Type>(uint32((firstMatches & lastMatches).GetMask()));
+				while (mask != 0)
+				{
+					const uint32 elementIndex = GetLastElementIndex<Type>(mask);
+					const size startIndex = blockIndex + elementIndex;
+					if (IsRangeAt<Type>(pBytes, startIndex, pRangeBytes, rangeDataSize))
+					{
+						return startIndex;
+					}
+					mask &= ~(1u << (elementIndex * uint32(sizeof(Type))));
+				}
+			}
+		}
+#endif
+
+		while (index > 0)
+		{
+			--index;
+			if (LoadElement<Type>(pBytes, index) == firstValue && IsRangeAt<Type>(pBytes, index, pRangeBytes, rangeDataSize))
+			{
+				return index;
+			}
+		}
+		return count;
+	}
+
+	//! 256-bit lookup table of byte values
+	struct ByteSet
+	{
+		ByteSet(const uint8* pValues, const size valueCount)
+		{
+			for (const uint8* pValue = pValues, *pEndValue = pValues + valueCount; pValue != pEndValue; ++pValue)
+			{
+				m_bits[*pValue >> 6u] |= uint64(1) << (*pValue & 63u);
+			}
+		}
+
+		[[nodiscard]] FORCE_INLINE bool Contains(const uint8 value) const
+		{
+			return ((m_bits[value >> 6u] >> (value & 63u)) & 1u) != 0;
+		}
+	protected:
+		uint64 m_bits[4]{0, 0, 0, 0};
+	};
+
+	size FindFirstOfAny(const uint8* pElements, const size count, const uint8* pValues, const size valueCount) noexcept
+	{
+		switch (valueCount)
+		{
+			case 0:
+				return count;
+			case 1:
+				return FindFirst<uint8>(pElements, count, pValues[0]);
+		}
+
+		size index = 0;
+#if USE_SSE || USE_WASM_SIMD128
+		// Sets such as path separators are small enough to compare against every value, repeating the last one if there are less than four
+		if (valueCount <= 4)
+		{
+			const PackedBytes first(pValues[0]);
+			const PackedBytes second(pValues[1]);
+			const PackedBytes third(pValues[valueCount > 2 ? 2 : 1]);
+			const PackedBytes fourth(pValues[valueCount - 1]);
+			for (; index + VectorSize <= count; index += VectorSize)
+			{
+				const PackedBytes elements(Math::Vectorization::LoadUnaligned, pElements + index);
+				const uint32 mask = uint32(((elements == first) | (elements == second) | (elements == third) | (elements == fourth)).GetMask());
+				if (mask != 0)
+				{
+					return index + Memory::GetNumberOfTrailingZeros(mask);
+				}
+			}
+		}
+#endif
+
+		const ByteSet set(pValues, valueCount);
+		for (; index < count; ++index)
+		{
+			if (set.Contains(pElements[index]))
+			{
+				return index;
+			}
+		}
+		return count;
+	}
+
+	template size FindFirst<uint8>(const void* pElements, const size count, const uint8 value) noexcept;
+	template size FindFirst<uint16>(const void* pElements, const size count, const uint16 value) noexcept;
+	template size FindFirst<uint32>(const void* pElements, const size count, const uint32 value) noexcept;
+	template size FindFirst<uint64>(const void* pElements, const size count, const uint64 value) noexcept;
+
+	template size FindLast<uint8>(const void* pElements, const size count, const uint8 value) noexcept;
+	template size FindLast<uint16>(const void* pElements, const size count, const uint16 value) noexcept;
+	template size FindLast<uint32>(const void* pElements, const size count, const uint32 value) noexcept;
+	template size FindLast<uint64>(const void* pElements, const size count, const uint64 value) noexcept;
+
+	template size FindFirstRange<uint8>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	template size FindFirstRange<uint16>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	template size FindFirstRange<uint32>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	template size FindFirstRange<uint64>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+
+	template size FindLastRange<uint8>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	template size FindLastRange<uint16>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	template size FindLastRange<uint32>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	template size FindLastRange<uint64>(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+}
@@ -1,5 +1,7 @@
 #include "Memory/New.h"
 #include "Memory/Allocators/Allocate.h"
+#include "Memory/Allocators/MemoryUsage.h"
+#include "Memory/Allocators/AllocationSampling.h"
 
 #include <cstdlib>
 #include <cstring>
@@ -22,11 +24,17 @@
 #include <Common/Assert/Assert.h>
 #include <Common/TypeTraits/IsSame.h>
 #include <Common/Math/Min.h>
+#include <Common/Math/Max.h>
 #include <Common/Math/NumericLimits.h>
 #include <Common/Platform/Assume.h>
 #include <Common/Platform/Likely.h>
 
 #include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/Atomics/Exchange.h>
+#include <Common/Threading/Atomics/FetchAdd.h>
+#include <Common/Threading/Atomics/Load.h>
+#include <Common/Threading/Atomics/Store.h>
+#include <Common/Memory/Containers/Array.h>
 
 static_assert(ngine::TypeTraits::IsSame<ngine::size, std::size_t>);
 
@@ -43,22 +51,162 @@ namespace ngine::Memory
 #endif
 	}
 
-	static Threading::Atomic<size> memoryUsage = 0;
-
-	[[nodiscard]] size GetDynamicMemoryUsage() noexcept
-	{
-		return memoryUsage;
-	}
-
-	static Threading::Atomic<size> biggestMemoryAllocation = 0;
-	static Threading::Atomic<size> highestMemoryUsage = 0;
-
 #define MAXIMUM_MEMORY_LIMIT_MB 0
 #define MAXIMUM_INDIVIDUAL_ALLOCATION_SIZE_MB 0
 #define TRACK_MEMORY_USAGE PROFILE_BUILD
 #define TRACK_BIGGEST_MEMORY_ALLOCATION 0
 #define TRACK_HIGHEST_MEMORY_USAGE 0
 #define TRACK_MEMORY_USAGE_INTERNAL TRACK_MEMORY_USAGE || MAXIMUM_MEMORY_LIMIT_MB > 0
+#define SAMPLE_ALLOCATIONS !PLATFORM_EMSCRIPTEN
+
+	//! Usage counters of a thread
+	//! Each shard is owned by a single thread that updates it with relaxed loads and stores, so allocating needs no locked instructions.
+	//! Readers aggregate all shards with relaxed loads. Threads beyond the exclusive shard count share the last shard with atomic adds.
+	//! Trivially constructible, so the static shards are zero initialized before any allocation instead of being reset by a constructor
+	struct alignas(64) UsageShard
+	{
+		//! Change in usage not yet published to flushedMemoryUsage, wraps around when more was freed than allocated
+		size m_pendingUsage;
+		Array<size, SizeClassCount> m_sizeClassAllocationCounts;
+		Array<size, SizeClassCount> m_sizeClassDeallocationCounts;
+		Array<size, MaximumUsageTagCount> m_tagAllocatedSizes;
+		Array<size, MaximumUsageTagCount> m_tagAllocationCounts;
+	};
+
+	inline static constexpr uint32 ExclusiveUsageShardCount = 64;
+	inline static constexpr uint32 SharedUsageShardIndex = ExclusiveUsageShardCount;
+	static Array<UsageShard, ExclusiveUsageShardCount + 1> usageShards;
+	static Threading::Atomic<uint32> nextUsageShardIndex = 0;
+
+	//! Sum of the usage published by all shards, excluding their pending usage
+	static size flushedMemoryUsage = 0;
+	static Threading::Atomic<size> highestMemoryUsage = 0;
+	static Threading::Atomic<size> biggestMemoryAllocation = 0;
+
+	static thread_local UsageTag currentUsageTag = UntaggedUsage;
+
+	void SetCurrentUsageTag(const UsageTag tag) noexcept
+	{
+		Assert(tag < MaximumUsageTagCount);
+		currentUsageTag = tag;
+	}
+
+	[[nodiscard]] PURE_STATICS UsageTag GetCurrentUsageTag() noexcept
+	{
+		return currentUsageTag;
+	}
+
+	[[nodiscard]] FORCE_INLINE uint32 GetUsageShardIndex()
+	{
+		// Shards are never handed to another thread, once all are assigned new threads share the last one
+		static thread_local const uint32 shardIndex = Math::Min(nextUsageShardIndex.FetchAdd(1), SharedUsageShardIndex);
+		return shardIndex;
+	}
+
+	//! Adds to a counter of the current thread's shard, returning the new value
+	FORCE_INLINE size AddToShardCounter(size& counter, const size value, const bool isSharedShard)
+	{
+		if (UNLIKELY(isSharedShard))
+		{
+			return Threading::Atomics::FetchAddRelaxed(counter, value) + value;
+		}
+
+		const size newValue = Threading::Atomics::LoadRelaxed(counter) + value;
+		Threading::Atomics::StoreRelaxed(counter, newValue);
+		return newValue;
+	}
+
+	[[nodiscard]] PURE_STATICS size GetDynamicMemoryUsage() noexcept
+	{
+		size memoryUsage = Threading::Atomics::LoadRelaxed(flushedMemoryUsage);
+		for (const UsageShard& shard : usageShards)
+		{
+			memoryUsage += Threading::Atomics::LoadRelaxed(shard.m_pendingUsage);
+		}
+		return memoryUsage;
+	}
+
+	[[nodiscard]] PURE_STATICS size GetPeakDynamicMemoryUsage() noexcept
+	{
+		return Math::Max((size)highestMemoryUsage, GetDynamicMemoryUsage());
+	}
+
+	[[nodiscard]] UsageStatistics GetUsageStatistics() noexcept
+	{
+		UsageStatistics statistics;
+		statistics.m_currentUsage = Threading::Atomics::LoadRelaxed(flushedMemoryUsage);
+		for (const UsageShard& shard : usageShards)
+		{
+			statistics.m_currentUsage += Threading::Atomics::LoadRelaxed(shard.m_pendingUsage);
+			for (uint8 sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+			{
+				const size allocationCount = Threading::Atomics::LoadRelaxed(shard.m_sizeClassAllocationCounts[sizeClass]);
+				const size deallocationCount = Threading::Atomics::LoadRelaxed(shard.m_sizeClassDeallocationCounts[sizeClass]);
+				statistics.m_sizeClasses[sizeClass].m_allocationCount += allocationCount;
+				statistics.m_sizeClasses[sizeClass].m_deallocationCount += deallocationCount;
+				statistics.m_allocationCount += allocationCount;
+				statistics.m_deallocationCount += deallocationCount;
+			}
+			for (uint16 tag = 0; tag < MaximumUsageTagCount; ++tag)
+			{
+				statistics.m_tags[tag].m_allocatedSize += Threading::Atomics::LoadRelaxed(shard.m_tagAllocatedSizes[tag]);
+				statistics.m_tags[tag].m_allocationCount += Threading::Atomics::LoadRelaxed(shard.m_tagAllocationCounts[tag]);
+			}
+		}
+		statistics.m_peakUsage = Math::Max((size)highestMemoryUsage, statistics.m_currentUsage);
+		return statistics;
+	}
+
+	//! Publishes a shard's pending usage to the global counter and updates the peak
+	static void FlushPendingUsage(UsageShard& shard, const bool isSharedShard)
+	{
+		size pendingUsage;
+		if (isSharedShard)
+		{
+			pendingUsage = Threading::Atomics::Exchange(shard.m_pendingUsage, size(0));
+		}
+		else
+		{
+			pendingUsage = Threading::Atomics::LoadRelaxed(shard.m_pendingUsage);
+			Threading::Atomics::StoreRelaxed(shard.m_pendingUsage, size(0));
+		}
+
+		const size memoryUsage = Threading::Atomics::FetchAddRelaxed(flushedMemoryUsage, pendingUsage) + pendingUsage;
+		// Frees flushed ahead of other shards' allocations can make the published usage briefly negative
+		if (static_cast<intptr>(memoryUsage) > 0)
+		{
+			highestMemoryUsage.AssignMax(memoryUsage);
+		}
+	}
+
+	FORCE_INLINE void AddPendingUsage(UsageShard& shard, const size usageChange, const bool isSharedShard)
+	{
+		const intptr pendingUsage = static_cast<intptr>(AddToShardCounter(shard.m_pendingUsage, usageChange, isSharedShard));
+		if (UNLIKELY(pendingUsage > static_cast<intptr>(PeakUsagePrecision) || pendingUsage < -static_cast<intptr>(PeakUsagePrecision)))
+		{
+			FlushPendingUsage(shard, isSharedShard);
+		}
+	}
+
+	FORCE_INLINE void RecordAllocation(const size allocationSize)
+	{
+		const uint32 shardIndex = GetUsageShardIndex();
+		const bool isSharedShard = shardIndex == SharedUsageShardIndex;
+		UsageShard& shard = usageShards[shardIndex];
+		AddToShardCounter(shard.m_sizeClassAllocationCounts[GetSizeClass(allocationSize)], 1, isSharedShard);
+		AddToShardCounter(shard.m_tagAllocatedSizes[currentUsageTag], allocationSize, isSharedShard);
+		AddToShardCounter(shard.m_tagAllocationCounts[currentUsageTag], 1, isSharedShard);
+		AddPendingUsage(shard, allocationSize, isSharedShard);
+	}
+
+	FORCE_INLINE void RecordDeallocation(const size allocationSize)
+	{
+		const uint32 shardIndex = GetUsageShardIndex();
+		const bool isSharedShard = shardIndex == SharedUsageShardIndex;
+		UsageShard& shard = usageShards[shardIndex];
+		AddToShardCounter(shard.m_sizeClassDeallocationCounts[GetSizeClass(allocationSize)], 1, isSharedShard);
+		AddPendingUsage(shard, 0 - allocationSize, isSharedShard);
+	}
 
 	[[nodiscard]] FORCE_INLINE bool TryRequestMemory(const size requestedSize)
 	{
@@ -76,35 +224,47 @@ namespace ngine::Memory
 			biggestMemoryAllocation.AssignMax(requestedSize);
 		}
 
-		size currentMemoryUsage = memoryUsage;
-		size requestedNewMemoryUsage = currentMemoryUsage + requestedSize;
-
-		while (true)
+		if constexpr (MAXIMUM_MEMORY_LIMIT_MB > 0)
 		{
-			if constexpr (MAXIMUM_MEMORY_LIMIT_MB > 0)
+			// Checked against the published usage instead of aggregating all shards
+			// The limit can be exceeded by up to PeakUsagePrecision per thread
+			constexpr size MaximumMemoryUsage = 1024 * 1024 * MAXIMUM_MEMORY_LIMIT_MB;
+			const size pendingUsage = Threading::Atomics::LoadRelaxed(usageShards[GetUsageShardIndex()].m_pendingUsage);
+			if (Threading::Atomics::LoadRelaxed(flushedMemoryUsage) + pendingUsage + requestedSize > MaximumMemoryUsage)
 			{
-				constexpr size MaximumMemoryUsage = 1024 * 1024 * MAXIMUM_MEMORY_LIMIT_MB;
-				if (requestedNewMemoryUsage > MaximumMemoryUsage)
-				{
-					return false;
-				}
+				return false;
 			}
+		}
 
-			if (memoryUsage.CompareExchangeWeak(currentMemoryUsage, requestedNewMemoryUsage))
-			{
-				if constexpr (TRACK_HIGHEST_MEMORY_USAGE)
-				{
-					highestMemoryUsage.AssignMax(requestedNewMemoryUsage);
-				}
+		return true;
+	}
 
-				return true;
-			}
-			requestedNewMemoryUsage = currentMemoryUsage + requestedSize;
+#if SAMPLE_ALLOCATIONS
+	FORCE_INLINE void TrySampleAllocation(void* pAllocation, const size requestedSize)
+	{
+		if (UNLIKELY((size)Internal::allocationSampleInterval != 0))
+		{
+			Internal::SampleAllocation(pAllocation, requestedSize);
 		}
+	}
 
-		ExpectUnreachable();
+	FORCE_INLINE void TryReleaseAllocationSample(void* pPointer)
+	{
+		if (UNLIKELY(Internal::liveAllocationSampleCount != 0u) && pPointer != nullptr)
+		{
+			Internal::ReleaseAllocationSample(pPointer);
+		}
+	}
+#else
+	FORCE_INLINE void TrySampleAllocation(void*, const size)
+	{
 	}
 
+	FORCE_INLINE void TryReleaseAllocationSample(void*)
+	{
+	}
+#endif
+
 	[[nodiscard]] PURE_STATICS size GetAllocatedMemorySize(void* pPointer) noexcept
 	{
 		if (pPointer == nullptr)
@@ -162,11 +322,14 @@ namespace ngine::Memory
 		void* pAllocation = malloc(requestedSize);
 #endif
 		Assert(pAllocation != nullptr || requestedSize == 0);
+		TrySampleAllocation(pAllocation, requestedSize);
 
 		if constexpr (TRACK_MEMORY_USAGE_INTERNAL)
 		{
-			memoryUsage += (GetAllocatedMemorySize(pAllocation) - requestedSize) * (pAllocation != nullptr);
-			memoryUsage -= requestedSize * (pAllocation == nullptr);
+			if (pAllocation != nullptr)
+			{
+				RecordAllocation(GetAllocatedMemorySize(pAllocation));
+			}
 		}
 
 		return pAllocation;
@@ -195,11 +358,14 @@ namespace ngine::Memory
 		void* pAllocation = malloc(requestedSize);
 #endif
 		Assert(pAllocation != nullptr || requestedSize == 0);
+		TrySampleAllocation(pAllocation, requestedSize);
 
 		if constexpr (TRACK_MEMORY_USAGE_INTERNAL)
 		{
-			memoryUsage += (GetAllocatedMemorySize(pAllocation) - requestedSize) * (pAllocation != nullptr);
-			memoryUsage -= requestedSize * (pAllocation == nullptr);
+			if (pAllocation != nullptr)
+			{
+				RecordAllocation(GetAllocatedMemorySize(pAllocation));
+			}
 		}
 
 		return pAllocation;
@@ -221,18 +387,22 @@ namespace ngine::Memory
 		const size previousAllocationSize = GetAllocatedMemorySize(pPointer);
 #endif
 
+		TryReleaseAllocationSample(pPointer);
 #if USE_MIMALLOC
 		void* pAllocation = mi_realloc(pPointer, requestedSize);
 #else
 		void* pAllocation = realloc(pPointer, requestedSize);
 #endif
 		Assert(pAllocation != nullptr || requestedSize == 0);
+		TrySampleAllocation(pAllocation, requestedSize);
 
 #if TRACK_MEMORY_USAGE_INTERNAL
 		{
-			memoryUsage += (GetAllocatedMemorySize(pAllocation) - requestedSize) * (pAllocation != nullptr);
-			memoryUsage -= requestedSize * (pAllocation == nullptr);
-			memoryUsage -= previousAllocationSize * (pAllocation != nullptr);
+			if (pAllocation != nullptr)
+			{
+				RecordDeallocation(previousAllocationSize);
+				RecordAllocation(GetAllocatedMemorySize(pAllocation));
+			}
 		}
 #endif
 
@@ -245,6 +415,7 @@ namespace ngine::Memory
 		const size allocationSize = GetAllocatedMemorySize(pPointer);
 #endif
 
+		TryReleaseAllocationSample(pPointer);
 #if USE_MIMALLOC
 		mi_free(pPointer);
 #else
@@ -253,7 +424,10 @@ namespace ngine::Memory
 
 #if TRACK_MEMORY_USAGE_INTERNAL
 		{
-			memoryUsage -= allocationSize;
+			if (pPointer != nullptr)
+			{
+				RecordDeallocation(allocationSize);
+			}
 		}
 #endif
 	}
@@ -281,11 +455,14 @@ namespace ngine::Memory
 #endif
 
 		Assert(pAllocation != nullptr || requestedSize == 0);
+		TrySampleAllocation(pAllocation, requestedSize);
 
 		if constexpr (TRACK_MEMORY_USAGE_INTERNAL)
 		{
-			memoryUsage += (GetAllocatedAlignedMemorySize(pAllocation, alignment) - requestedSize) * (pAllocation != nullptr);
-			memoryUsage -= requestedSize * (pAllocation == nullptr);
+			if (pAllocation != nullptr)
+			{
+				RecordAllocation(GetAllocatedAlignedMemorySize(pAllocation, alignment));
+			}
 		}
 		return pAllocation;
 	}
@@ -307,6 +484,7 @@ namespace ngine::Memory
 		const size previousAllocationSize = GetAllocatedAlignedMemorySize(pPointer, alignment);
 #endif
 
+		TryReleaseAllocationSample(pPointer);
 #if USE_MIMALLOC
 		void* pAllocation = mi_realloc_aligned(pPointer, requestedSize, alignment);
 #elif COMPILER_MSVC || COMPILER_CLANG_WINDOWS
@@ -326,12 +504,15 @@ namespace ngine::Memory
 #else
 #pragma error "Not implemented for platform"
 #endif
+		TrySampleAllocation(pAllocation, requestedSize);
 
 #if TRACK_MEMORY_USAGE_INTERNAL
 		{
-			memoryUsage += (GetAllocatedAlignedMemorySize(pAllocation, alignment) - requestedSize) * (pAllocation != nullptr);
-			memoryUsage -= requestedSize * (pAllocation == nullptr);
-			memoryUsage -= previousAllocationSize * (pAllocation != nullptr);
+			if (pAllocation != nullptr)
+			{
+				RecordDeallocation(previousAllocationSize);
+				RecordAllocation(GetAllocatedAlignedMemorySize(pAllocation, alignment));
+			}
 		}
 #endif
 
@@ -344,6 +525,7 @@ namespace ngine::Memory
 		[[maybe_unused]] const size allocationSize = GetAllocatedAlignedMemorySize(pPointer, alignment);
 #endif
 
+		TryReleaseAllocationSample(pPointer);
 #if USE_MIMALLOC
 		mi_free_aligned(pPointer, alignment);
 #elif COMPILER_MSVC || COMPILER_CLANG_WINDOWS
@@ -354,7 +536,10 @@ namespace ngine::Memory
 
 #if TRACK_MEMORY_USAGE_INTERNAL
 		{
-			memoryUsage -= allocationSize;
+			if (pPointer != nullptr)
+			{
+				RecordDeallocation(allocationSize);
+			}
 		}
 #endif
 	}
@@ -0,0 +1,155 @@
+#include <Common/Platform/GetProcessorTopology.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Max.h>
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+#include <Common/IO/Path.h>
+#include <Common/IO/File.h>
+#include <Common/EnumFlags.h>
+#include <cstring>
+#endif
+
+#include <thread>
+
+namespace ngine::Platform
+{
+	namespace Internal
+	{
+		LogicalProcessorMask ParseLogicalProcessorList(ConstStringView list)
+		{
+			LogicalProcessorMask mask;
+			while (list.HasElements())
+			{
+				const ConstStringView::SizeType separatorIndex = list.FindFirstOf(',');
+				const ConstStringView range = separatorIndex != ConstStringView::InvalidPosition ? list.GetSubstringUpTo(separatorIndex) : list;
+				list = separatorIndex != ConstStringView::InvalidPosition ? list.GetSubstringFrom(separatorIndex + 1) : ConstStringView{};
+
+				if (range.IsEmpty() || range[0] < '0' || range[0] > '9')
+				{
+					continue;
+				}
+
+				const uint16 first = range.ToIntegral<uint16>();
+				const ConstStringView::SizeType rangeSeparatorIndex = range.FindFirstOf('-');
+				const uint16 last = rangeSeparatorIndex != ConstStringView::InvalidPosition
+				                      ? range.GetSubstringFrom(rangeSeparatorIndex + 1).ToIntegral<uint16>()
+				                      : first;
+				if (first < MaximumLogicalProcessorCount && first <= last)
+				{
+					mask.SetAll(Math::Range<uint16>::MakeStartToEnd(first, Math::Min(last, uint16(MaximumLogicalProcessorCount - 1))));
+				}
+			}
+			return mask;
+		}
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+		[[nodiscard]] static bool ReadLogicalProcessorList(const IO::ConstZeroTerminatedPathView filePath, LogicalProcessorMask& maskOut)
+		{
+			IO::File file(filePath, IO::AccessModeFlags::Read);
+			if (!file.IsValid())
+			{
+				return false;
+			}
+
+			Array<char, 8192, uint32, uint32> buffer;
+			if (!file.ReadLineIntoView(buffer.GetDynamicView()))
+			{
+				return false;
+			}
+
+			maskOut = ParseLogicalProcessorList(ConstStringView{buffer.GetData(), (ConstStringView::SizeType)strlen(buffer.GetData())});
+			return maskOut.AreAnySet();
+		}
+#endif
+
+		[[nodiscard]] static ProcessorTopology GetProcessorTopologyInternal()
+		{
+			ProcessorTopology topology;
+
+#if PLATFORM_LINUX || PLATFORM_ANDROID
+			LogicalProcessorMask onlineProcessorMask;
+			if (ReadLogicalProcessorList(IO::Path(MAKE_PATH("/sys/devices/system/cpu/online")), onlineProcessorMask))
+			{
+				constexpr uint16 InvalidIndex = Math::NumericLimits<uint16>::Max;
+				Array<uint16, MaximumLogicalProcessorCount> cacheDomainLookup;
+				cacheDomainLookup.GetView().InitializeAll(InvalidIndex);
+				Array<uint16, MaximumLogicalProcessorCount> numaNodeLookup;
+				numaNodeLookup.GetView().InitializeAll((uint16)0u);
+
+				// Map each processor to its NUMA node, kernels without NUMA support have no node directory and keep everything in node 0
+				LogicalProcessorMask onlineNodeMask;
+				if (ReadLogicalProcessorList(IO::Path(MAKE_PATH("/sys/devices/system/node/online")), onlineNodeMask))
+				{
+					IO::Path::StringType nodeProcessorListPath;
+					uint16 numaNodeCount = 0;
+					for (const uint16 nodeIndex : onlineNodeMask.GetSetBitsIterator())
+					{
+						nodeProcessorListPath.Format("/sys/devices/system/node/node{}/cpulist", nodeIndex);
+						LogicalProcessorMask nodeProcessorMask;
+						if (ReadLogicalProcessorList(nodeProcessorListPath, nodeProcessorMask))
+						{
+							for (const uint16 processorIndex : nodeProcessorMask.GetSetBitsIterator())
+							{
+								numaNodeLookup[processorIndex] = numaNodeCount;
+							}
+							numaNodeCount++;
+						}
+					}
+					topology.m_numaNodeCount = Math::Max(numaNodeCount, (uint16)1u);
+				}
+
+				// Group processors by the set of processors they share the last level cache with
+				// The first processor in the shared list identifies the domain
+				IO::Path::StringType sharedProcessorListPath;
+				uint16 cacheDomainCount = 0;
+				for (const uint16 processorIndex : onlineProcessorMask.GetSetBitsIterator())
+				{
+					LogicalProcessorMask sharedProcessorMask;
+					sharedProcessorListPath.Format("/sys/devices/system/cpu/cpu{}/cache/index3/shared_cpu_list", processorIndex);
+					if (!ReadLogicalProcessorList(sharedProcessorListPath, sharedProcessorMask))
+					{
+						// No L3 reported, fall back to the physical package
+						sharedProcessorListPath.Format("/sys/devices/system/cpu/cpu{}/topology/core_siblings_list", processorIndex);
+						if (!ReadLogicalProcessorList(sharedProcessorListPath, sharedProcessorMask))
+						{
+							sharedProcessorMask.Set(0);
+						}
+					}
+
+					const uint16 cacheDomainKey = (uint16)*sharedProcessorMask.GetFirstSetIndex();
+					if (cacheDomainLookup[cacheDomainKey] == InvalidIndex)
+					{
+						cacheDomainLookup[cacheDomainKey] = cacheDomainCount++;
+					}
+
+					topology.m_logicalProcessors.EmplaceBack(
+						ProcessorTopology::LogicalProcessor{processorIndex, cacheDomainLookup[cacheDomainKey], numaNodeLookup[processorIndex]}
+					);
+				}
+				topology.m_cacheDomainCount = Math::Max(cacheDomainCount, (uint16)1u);
+			}
+#endif
+
+			if (topology.m_logicalProcessors.IsEmpty())
+			{
+				// Topology unknown, treat all processors as a single domain
+				const uint16 processorCount =
+					(uint16)Math::Min(Math::Max(std::thread::hardware_concurrency(), 1u), (uint32)MaximumLogicalProcessorCount);
+				for (uint16 processorIndex = 0; processorIndex < processorCount; ++processorIndex)
+				{
+					topology.m_logicalProcessors.EmplaceBack(ProcessorTopology::LogicalProcessor{processorIndex, 0, 0});
+				}
+				topology.m_cacheDomainCount = 1;
+				topology.m_numaNodeCount = 1;
+			}
+
+			return topology;
+		}
+	}
+
+	const ProcessorTopology& GetProcessorTopology()
+	{
+		static const ProcessorTopology topology = Internal::GetProcessorTopologyInternal();
+		return topology;
+	}
+}
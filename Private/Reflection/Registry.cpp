@@ -2,6 +2,7 @@
 
 #include <Common/Reflection/TypeInterface.h>
 #include <Common/Reflection/FunctionInfo.h>
+#include <Common/Threading/Mutexes/UniqueLock.h>
 
 namespace ngine::Reflection
 {
@@ -59,17 +60,14 @@ namespace ngine::Reflection
 		Registry& staticRegistry = GetStaticRegistry();
 		m_types = staticRegistry.m_types;
 		m_typeDefinitions = staticRegistry.m_typeDefinitions;
-		m_functions = staticRegistry.m_functions;
 		m_globalFunctions = staticRegistry.m_globalFunctions;
 		m_globalEvents = staticRegistry.m_globalEvents;
 
 		// Register functions
-		m_functionIdentifierLookupMap.Reserve(m_functions.GetSize());
-		for (const Registry::FunctionContainer::PairType& functionPair : m_functions)
+		m_functions.Reserve(staticRegistry.m_functions.GetSize());
+		for (const Registry::FunctionContainer::PairType& functionPair : staticRegistry.m_functions)
 		{
-			const FunctionIdentifier identifier = m_functionIdentifiers.AcquireIdentifier();
-			m_functionGuids[identifier] = functionPair.first;
-			m_functionIdentifierLookupMap.Emplace(Guid{functionPair.first}, FunctionIdentifier{identifier});
+			EmplaceFunction(functionPair.first, FunctionData{staticRegistry.m_functionData[functionPair.second]});
 		}
 	}
 
@@ -101,85 +99,118 @@ namespace ngine::Reflection
 
 	void Registry::RegisterDynamicTypeDefinition(const Guid guid, TypeDefinition&& definition)
 	{
-		Threading::UniqueLock lock(m_typeDefinitionMutex);
-		Assert(!m_typeDefinitions.Contains(guid));
-		m_typeDefinitions.Emplace(Guid(guid), Forward<TypeDefinition>(definition));
+		{
+			Threading::UniqueLock lock(m_typeDefinitionMutex);
+			Assert(!m_typeDefinitions.Contains(guid));
+			m_typeDefinitions.Emplace(Guid(guid), Forward<TypeDefinition>(definition));
+		}
+		UpdateLookupSnapshot();
 	}
 
 	void Registry::DeregisterDynamicTypeDefinition(const Guid guid)
 	{
-		Threading::UniqueLock lock(m_typeDefinitionMutex);
-		auto it = m_typeDefinitions.Find(guid);
-		Assert(it != m_typeDefinitions.end());
-		if (LIKELY(it != m_typeDefinitions.end()))
 		{
-			m_typeDefinitions.Remove(it);
+			Threading::UniqueLock lock(m_typeDefinitionMutex);
+			auto it = m_typeDefinitions.Find(guid);
+			Assert(it != m_typeDefinitions.end());
+			if (LIKELY(it != m_typeDefinitions.end()))
+			{
+				m_typeDefinitions.Remove(it);
+			}
 		}
+		UpdateLookupSnapshot();
 	}
 
-	FunctionIdentifier
-	Registry::RegisterDynamicFunction(const FunctionInfo& functionInfo, Scripting::VM::DynamicFunction&& function, const Guid owningTypeGuid)
+	FunctionIdentifier Registry::EmplaceFunction(const Guid guid, FunctionData&& functionData)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
-		Assert(!m_functions.Contains(functionInfo.m_guid));
-		m_functions.Emplace(
-			Guid(functionInfo.m_guid),
-			FunctionData{Forward<Scripting::VM::DynamicFunction>(function), functionInfo.m_flags, owningTypeGuid}
-		);
-
+		Assert(!m_functions.Contains(guid));
 		const FunctionIdentifier identifier = m_functionIdentifiers.AcquireIdentifier();
-		m_functionGuids[identifier] = functionInfo.m_guid;
-		m_functionIdentifierLookupMap.Emplace(Guid{functionInfo.m_guid}, FunctionIdentifier{identifier});
+		m_functionGuids[identifier] = guid;
+		m_functionData[identifier] = Forward<FunctionData>(functionData);
+		m_functions.Emplace(Guid{guid}, FunctionIdentifier{identifier});
 		return identifier;
 	}
 
-	void Registry::DeregisterDynamicFunction(const Guid guid)
+	void Registry::RemoveFunction(const Guid guid)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
+		auto it = m_functions.Find(guid);
+		Assert(it != m_functions.end());
+		if (LIKELY(it != m_functions.end()))
 		{
-			auto it = m_functions.Find(guid);
-			Assert(it != m_functions.end());
-			if (LIKELY(it != m_functions.end()))
+			// Snapshot readers access the data without locking, and may still hold a snapshot containing this function.
+			// Identifiers are never reused, so the data is left in place and only becomes unreachable once the next snapshot is published.
+			if (!m_isSnapshotLookupEnabled)
 			{
-				m_functions.Remove(it);
+				m_functionData[it->second] = {};
 			}
+			m_functions.Remove(it);
 		}
+	}
+
+	PURE_STATICS Optional<const FunctionData*> Registry::FindFunctionData(const Guid guid) const
+	{
+		if (const LookupSnapshotPointer::ReadScope snapshot = m_lookupSnapshot.Read(); snapshot.IsValid())
 		{
-			auto it = m_functionIdentifierLookupMap.Find(guid);
-			Assert(it != m_functionIdentifierLookupMap.end());
-			if (LIKELY(it != m_functionIdentifierLookupMap.end()))
+			// Data is only written before its identifier is published in a snapshot, see RemoveFunction
+			if (auto it = snapshot->m_functions.Find(guid); it != snapshot->m_functions.end())
 			{
-				m_functionIdentifierLookupMap.Remove(it);
+				return m_functionData[it->second];
 			}
+			return Invalid;
+		}
+
+		Threading::SharedLock lock(m_functionMutex);
+		if (auto it = m_functions.Find(guid); it != m_functions.end())
+		{
+			return m_functionData[it->second];
 		}
+		return Invalid;
 	}
 
-	FunctionIdentifier Registry::RegisterDynamicGlobalFunction(const FunctionInfo& functionInfo, Scripting::VM::DynamicFunction&& function)
+	FunctionIdentifier
+	Registry::RegisterDynamicFunction(const FunctionInfo& functionInfo, Scripting::VM::DynamicFunction&& function, const Guid owningTypeGuid)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
-		Assert(!m_functions.Contains(functionInfo.m_guid));
-		m_functions
-			.Emplace(Guid(functionInfo.m_guid), FunctionData{Forward<Scripting::VM::DynamicFunction>(function), functionInfo.m_flags, {}});
-		m_globalFunctions.Emplace(Guid(functionInfo.m_guid), &functionInfo);
-
-		const FunctionIdentifier identifier = m_functionIdentifiers.AcquireIdentifier();
-		m_functionGuids[identifier] = functionInfo.m_guid;
-		m_functionIdentifierLookupMap.Emplace(Guid{functionInfo.m_guid}, FunctionIdentifier{identifier});
+		FunctionIdentifier identifier;
+		{
+			Threading::UniqueLock lock(m_functionMutex);
+			identifier = EmplaceFunction(
+				functionInfo.m_guid,
+				FunctionData{Forward<Scripting::VM::DynamicFunction>(function), functionInfo.m_flags, owningTypeGuid, &functionInfo, Invalid}
+			);
+		}
+		UpdateLookupSnapshot();
 		return identifier;
 	}
 
-	void Registry::DeregisterDynamicGlobalFunction(const Guid guid)
+	void Registry::DeregisterDynamicFunction(const Guid guid)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
 		{
-			auto it = m_functions.Find(guid);
-			Assert(it != m_functions.end());
-			if (LIKELY(it != m_functions.end()))
-			{
-				m_functions.Remove(it);
-			}
+			Threading::UniqueLock lock(m_functionMutex);
+			RemoveFunction(guid);
+		}
+		UpdateLookupSnapshot();
+	}
+
+	FunctionIdentifier Registry::RegisterDynamicGlobalFunction(const FunctionInfo& functionInfo, Scripting::VM::DynamicFunction&& function)
+	{
+		FunctionIdentifier identifier;
+		{
+			Threading::UniqueLock lock(m_functionMutex);
+			m_globalFunctions.Emplace(Guid(functionInfo.m_guid), &functionInfo);
+			identifier = EmplaceFunction(
+				functionInfo.m_guid,
+				FunctionData{Forward<Scripting::VM::DynamicFunction>(function), functionInfo.m_flags, {}, &functionInfo, Invalid}
+			);
 		}
+		UpdateLookupSnapshot();
+		return identifier;
+	}
+
+	void Registry::DeregisterDynamicGlobalFunction(const Guid guid)
+	{
 		{
+			Threading::UniqueLock lock(m_functionMutex);
+			RemoveFunction(guid);
 			auto it = m_globalFunctions.Find(guid);
 			Assert(it != m_globalFunctions.end());
 			if (LIKELY(it != m_globalFunctions.end()))
@@ -187,22 +218,14 @@ namespace ngine::Reflection
 				m_globalFunctions.Remove(it);
 			}
 		}
-		{
-			auto it = m_functionIdentifierLookupMap.Find(guid);
-			Assert(it != m_functionIdentifierLookupMap.end());
-			if (LIKELY(it != m_functionIdentifierLookupMap.end()))
-			{
-				m_functionIdentifierLookupMap.Remove(it);
-			}
-		}
+		UpdateLookupSnapshot();
 	}
 
 	PURE_STATICS const FunctionData& Registry::FindFunction(const Guid guid) const
 	{
-		Threading::SharedLock lock(m_functionMutex);
-		if (auto it = m_functions.Find(guid); it != m_functions.end())
+		if (const Optional<const FunctionData*> pFunctionData = FindFunctionData(guid))
 		{
-			return it->second;
+			return *pFunctionData;
 		}
 		static FunctionData dummyFunctionData;
 		return dummyFunctionData;
@@ -220,30 +243,13 @@ namespace ngine::Reflection
 
 	PURE_STATICS Optional<const FunctionInfo*> Registry::FindTypeFunctionDefinition(const Guid functionGuid) const
 	{
-		Threading::SharedLock lock(m_functionMutex);
-		if (auto it = m_functions.Find(functionGuid); it != m_functions.end())
+		if (const Optional<const FunctionData*> pFunctionData = FindFunctionData(functionGuid))
 		{
-			if (it->second.m_flags.IsNotSet(FunctionFlags::IsEvent))
+			if (pFunctionData->m_flags.IsNotSet(FunctionFlags::IsEvent))
 			{
-				Assert(it->second.m_flags.IsSet(FunctionFlags::IsMemberFunction));
-				Assert(it->second.m_owningTypeGuid.IsValid());
-
-				const Optional<const TypeInterface*> pOwningTypeInterface = FindTypeInterface(it->second.m_owningTypeGuid);
-				Optional<const Reflection::FunctionInfo*> pFunctionInfo;
-				Assert(pOwningTypeInterface.IsValid());
-				if (LIKELY(pOwningTypeInterface.IsValid()))
-				{
-					pOwningTypeInterface->IterateFunctions(
-						[functionGuid, &pFunctionInfo](const Reflection::FunctionInfo& functionInfo)
-						{
-							if (functionInfo.m_guid == functionGuid)
-							{
-								pFunctionInfo = &functionInfo;
-							}
-						}
-					);
-				}
-				return pFunctionInfo;
+				Assert(pFunctionData->m_flags.IsSet(FunctionFlags::IsMemberFunction));
+				Assert(pFunctionData->m_owningTypeGuid.IsValid());
+				return pFunctionData->m_pFunctionInfo;
 			}
 		}
 		return Invalid;
@@ -251,35 +257,12 @@ namespace ngine::Reflection
 
 	PURE_STATICS Optional<const FunctionInfo*> Registry::FindFunctionDefinition(const Guid functionGuid) const
 	{
-		Threading::SharedLock lock(m_functionMutex);
-		if (auto it = m_functions.Find(functionGuid); it != m_functions.end())
+		if (const Optional<const FunctionData*> pFunctionData = FindFunctionData(functionGuid))
 		{
-			if (it->second.m_flags.IsNotSet(FunctionFlags::IsEvent))
+			if (pFunctionData->m_flags.IsNotSet(FunctionFlags::IsEvent))
 			{
-				Assert(it->second.m_flags.IsSet(FunctionFlags::IsMemberFunction) == it->second.m_owningTypeGuid.IsValid());
-				if (it->second.m_flags.IsSet(FunctionFlags::IsMemberFunction))
-				{
-					const Optional<const TypeInterface*> pOwningTypeInterface = FindTypeInterface(it->second.m_owningTypeGuid);
-					Optional<const Reflection::FunctionInfo*> pFunctionInfo;
-					Assert(pOwningTypeInterface.IsValid());
-					if (LIKELY(pOwningTypeInterface.IsValid()))
-					{
-						pOwningTypeInterface->IterateFunctions(
-							[functionGuid, &pFunctionInfo](const Reflection::FunctionInfo& functionInfo)
-							{
-								if (functionInfo.m_guid == functionGuid)
-								{
-									pFunctionInfo = &functionInfo;
-								}
-							}
-						);
-					}
-					return pFunctionInfo;
-				}
-				else if (auto globalIt = m_globalFunctions.Find(functionGuid); globalIt != m_globalFunctions.end())
-				{
-					return globalIt->second;
-				}
+				Assert(pFunctionData->m_flags.IsSet(FunctionFlags::IsMemberFunction) == pFunctionData->m_owningTypeGuid.IsValid());
+				return pFunctionData->m_pFunctionInfo;
 			}
 		}
 		return Invalid;
@@ -304,8 +287,19 @@ namespace ngine::Reflection
 
 	FunctionIdentifier Registry::FindFunctionIdentifier(const Guid guid) const
 	{
-		auto it = m_functionIdentifierLookupMap.Find(guid);
-		if (it != m_functionIdentifierLookupMap.end())
+		if (const LookupSnapshotPointer::ReadScope snapshot = m_lookupSnapshot.Read(); snapshot.IsValid())
+		{
+			auto it = snapshot->m_functions.Find(guid);
+			if (it != snapshot->m_functions.end())
+			{
+				return it->second;
+			}
+			return {};
+		}
+
+		Threading::SharedLock lock(m_functionMutex);
+		auto it = m_functions.Find(guid);
+		if (it != m_functions.end())
 		{
 			return it->second;
 		}
@@ -315,81 +309,55 @@ namespace ngine::Reflection
 	FunctionIdentifier
 	Registry::RegisterDynamicEvent(const EventInfo& eventInfo, Scripting::VM::DynamicFunction&& function, const Guid owningTypeGuid)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
-		Assert(!m_functions.Contains(eventInfo.m_guid));
-		m_functions.Emplace(
-			Guid(eventInfo.m_guid),
-			FunctionData{Forward<Scripting::VM::DynamicFunction>(function), FunctionFlags::IsEvent, owningTypeGuid}
-		);
-
-		const FunctionIdentifier identifier = m_functionIdentifiers.AcquireIdentifier();
-		m_functionGuids[identifier] = eventInfo.m_guid;
-		m_functionIdentifierLookupMap.Emplace(Guid{eventInfo.m_guid}, FunctionIdentifier{identifier});
+		FunctionIdentifier identifier;
+		{
+			Threading::UniqueLock lock(m_functionMutex);
+			identifier = EmplaceFunction(
+				eventInfo.m_guid,
+				FunctionData{Forward<Scripting::VM::DynamicFunction>(function), FunctionFlags::IsEvent, owningTypeGuid, Invalid, &eventInfo}
+			);
+		}
+		UpdateLookupSnapshot();
 		return identifier;
 	}
 
 	void Registry::DeregisterDynamicEvent(const Guid guid)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
-		{
-			auto it = m_functions.Find(guid);
-			Assert(it != m_functions.end());
-			if (LIKELY(it != m_functions.end()))
-			{
-				m_functions.Remove(it);
-			}
-		}
 		{
-			auto it = m_functionIdentifierLookupMap.Find(guid);
-			Assert(it != m_functionIdentifierLookupMap.end());
-			if (LIKELY(it != m_functionIdentifierLookupMap.end()))
-			{
-				m_functionIdentifierLookupMap.Remove(it);
-			}
+			Threading::UniqueLock lock(m_functionMutex);
+			RemoveFunction(guid);
 		}
+		UpdateLookupSnapshot();
 	}
 
 	FunctionIdentifier Registry::RegisterDynamicGlobalEvent(const EventInfo& eventInfo, Scripting::VM::DynamicFunction&& function)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
-		Assert(!m_functions.Contains(eventInfo.m_guid));
-		m_functions
-			.Emplace(Guid(eventInfo.m_guid), FunctionData{Forward<Scripting::VM::DynamicFunction>(function), FunctionFlags::IsEvent, {}});
-		m_globalEvents.Emplace(Guid(eventInfo.m_guid), &eventInfo);
-
-		const FunctionIdentifier identifier = m_functionIdentifiers.AcquireIdentifier();
-		m_functionGuids[identifier] = eventInfo.m_guid;
-		m_functionIdentifierLookupMap.Emplace(Guid{eventInfo.m_guid}, FunctionIdentifier{identifier});
+		FunctionIdentifier identifier;
+		{
+			Threading::UniqueLock lock(m_functionMutex);
+			m_globalEvents.Emplace(Guid(eventInfo.m_guid), &eventInfo);
+			identifier = EmplaceFunction(
+				eventInfo.m_guid,
+				FunctionData{Forward<Scripting::VM::DynamicFunction>(function), FunctionFlags::IsEvent, {}, Invalid, &eventInfo}
+			);
+		}
+		UpdateLookupSnapshot();
 		return identifier;
 	}
 
 	void Registry::DeregisterDynamicGlobalEvent(const Guid guid)
 	{
-		Threading::UniqueLock lock(m_functionMutex);
 		{
-			auto it = m_functions.Find(guid);
-			Assert(it != m_functions.end());
-			if (LIKELY(it != m_functions.end()))
+			Threading::UniqueLock lock(m_functionMutex);
+			RemoveFunction(guid);
+			auto it = m_globalEvents.Find(guid);
+			Assert(it != m_globalEvents.end());
+			if (LIKELY(it != m_globalEvents.end()))
 			{
-				m_functions.Remove(it);
-			}
-		}
-		{
-			auto it = m_globalFunctions.Find(guid);
-			Assert(it != m_globalFunctions.end());
-			if (LIKELY(it != m_globalFunctions.end()))
-			{
-				m_globalFunctions.Remove(it);
-			}
-		}
-		{
-			auto it = m_functionIdentifierLookupMap.Find(guid);
-			Assert(it != m_functionIdentifierLookupMap.end());
-			if (LIKELY(it != m_functionIdentifierLookupMap.end()))
-			{
-				m_functionIdentifierLookupMap.Remove(it);
+				m_globalEvents.Remove(it);
 			}
 		}
+		UpdateLookupSnapshot();
 	}
 
 	PURE_STATICS Optional<const EventInfo*> Registry::FindGlobalEventDefinition(const Guid guid) const
@@ -404,28 +372,12 @@ namespace ngine::Reflection
 
 	PURE_STATICS Optional<const EventInfo*> Registry::FindTypeEventDefinition(const Guid eventGuid) const
 	{
-		Threading::SharedLock lock(m_functionMutex);
-		if (auto it = m_functions.Find(eventGuid); it != m_functions.end())
+		if (const Optional<const FunctionData*> pFunctionData = FindFunctionData(eventGuid))
 		{
-			if (it->second.m_flags.IsSet(FunctionFlags::IsEvent))
+			if (pFunctionData->m_flags.IsSet(FunctionFlags::IsEvent))
 			{
-				Assert(it->second.m_owningTypeGuid.IsValid());
-				const Optional<const TypeInterface*> pOwningTypeInterface = FindTypeInterface(it->second.m_owningTypeGuid);
-				Optional<const Reflection::EventInfo*> pEventInfo;
-				Assert(pOwningTypeInterface.IsValid());
-				if (LIKELY(pOwningTypeInterface.IsValid()))
-				{
-					pOwningTypeInterface->IterateEvents(
-						[eventGuid, &pEventInfo](const Reflection::EventInfo& eventInfo)
-						{
-							if (eventInfo.m_guid == eventGuid)
-							{
-								pEventInfo = &eventInfo;
-							}
-						}
-					);
-				}
-				return pEventInfo;
+				Assert(pFunctionData->m_owningTypeGuid.IsValid());
+				return pFunctionData->m_pEventInfo;
 			}
 		}
 		return Invalid;
@@ -433,34 +385,11 @@ namespace ngine::Reflection
 
 	PURE_STATICS Optional<const EventInfo*> Registry::FindEventDefinition(const Guid eventGuid) const
 	{
-		Threading::SharedLock lock(m_functionMutex);
-		if (auto it = m_functions.Find(eventGuid); it != m_functions.end())
+		if (const Optional<const FunctionData*> pFunctionData = FindFunctionData(eventGuid))
 		{
-			if (it->second.m_flags.IsSet(FunctionFlags::IsEvent))
+			if (pFunctionData->m_flags.IsSet(FunctionFlags::IsEvent))
 			{
-				if (it->second.m_owningTypeGuid.IsValid())
-				{
-					Optional<const Reflection::EventInfo*> pEventInfo;
-					const Optional<const TypeInterface*> pOwningTypeInterface = FindTypeInterface(it->second.m_owningTypeGuid);
-					Assert(pOwningTypeInterface.IsValid());
-					if (LIKELY(pOwningTypeInterface.IsValid()))
-					{
-						pOwningTypeInterface->IterateEvents(
-							[eventGuid, &pEventInfo](const Reflection::EventInfo& eventInfo)
-							{
-								if (eventInfo.m_guid == eventGuid)
-								{
-									pEventInfo = &eventInfo;
-								}
-							}
-						);
-					}
-					return pEventInfo;
-				}
-				else if (auto globalIt = m_globalEvents.Find(eventGuid); globalIt != m_globalEvents.end())
-				{
-					return globalIt->second;
-				}
+				return pFunctionData->m_pEventInfo;
 			}
 		}
 		return Invalid;
@@ -480,6 +409,16 @@ namespace ngine::Reflection
 
 	PURE_STATICS Optional<const TypeDefinition*> Registry::FindTypeDefinition(const Guid guid) const
 	{
+		if (const LookupSnapshotPointer::ReadScope snapshot = m_lookupSnapshot.Read(); snapshot.IsValid())
+		{
+			auto it = snapshot->m_typeDefinitions.Find(guid);
+			if (it != snapshot->m_typeDefinitions.end())
+			{
+				return it->second;
+			}
+			return Invalid;
+		}
+
 		Threading::SharedLock lock(m_typeDefinitionMutex);
 		auto it = m_typeDefinitions.Find(guid);
 		if (it != m_typeDefinitions.end())
@@ -505,6 +444,16 @@ namespace ngine::Reflection
 
 	PURE_STATICS Optional<const TypeInterface*> Registry::FindTypeInterface(const Guid guid) const
 	{
+		if (const LookupSnapshotPointer::ReadScope snapshot = m_lookupSnapshot.Read(); snapshot.IsValid())
+		{
+			auto it = snapshot->m_types.Find(guid);
+			if (it != snapshot->m_types.end())
+			{
+				return it->second;
+			}
+			return Invalid;
+		}
+
 		Threading::SharedLock lock(m_typeMutex);
 		auto it = m_types.Find(guid);
 		if (it != m_types.end())
@@ -525,11 +474,45 @@ namespace ngine::Reflection
 			}
 		}
 	}
+
+	void Registry::EnableSnapshotLookups()
+	{
+		m_isSnapshotLookupEnabled = true;
+		PublishLookupSnapshot();
+	}
+
+	void Registry::UpdateLookupSnapshot()
+	{
+		if (m_isSnapshotLookupEnabled)
+		{
+			PublishLookupSnapshot();
+		}
+	}
+
+	void Registry::PublishLookupSnapshot()
+	{
+		// Copies are taken after the change that triggered publication, so the last published snapshot always includes all changes
+		Threading::UniqueLock publishLock(m_lookupSnapshotMutex);
+		UniquePtr<LookupSnapshot> pSnapshot = UniquePtr<LookupSnapshot>::Make();
+		{
+			Threading::SharedLock lock(m_typeMutex);
+			pSnapshot->m_types = m_types;
+		}
+		{
+			Threading::SharedLock lock(m_typeDefinitionMutex);
+			pSnapshot->m_typeDefinitions = m_typeDefinitions;
+		}
+		{
+			Threading::SharedLock lock(m_functionMutex);
+			pSnapshot->m_functions = m_functions;
+		}
+		Threading::Reclaim(m_lookupSnapshot.Publish(Move(pSnapshot)));
+	}
 }
 
 namespace ngine
 {
 	template struct UnorderedMap<Guid, const Reflection::TypeInterface*, Guid::Hash>;
 	template struct UnorderedMap<Guid, Reflection::TypeDefinition, Guid::Hash>;
-	template struct UnorderedMap<Guid, Reflection::FunctionData, Guid::Hash>;
+	template struct UnorderedMap<Guid, Scripting::FunctionIdentifier, Guid::Hash>;
 }
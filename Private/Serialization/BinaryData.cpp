@@ -0,0 +1,430 @@
+#include <Common/Serialization/BinaryData.h>
+#include <Common/Serialization/SerializedData.h>
+
+#include <Common/Memory/BitCast.h>
+#include <Common/Memory/Containers/ByteView.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/StringView.h>
+#include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Math/NumericLimits.h>
+
+namespace ngine::Serialization
+{
+	//! Limits nesting of decoded values, so corrupted data can't exhaust the stack
+	inline static constexpr uint16 MaximumBinaryDataDepth = 512;
+
+	using BinaryDataBuffer = Vector<ByteType, size>;
+	using BinaryDataKeyIndices = UnorderedMap<ConstStringView, uint32, ConstStringView::Hash>;
+	using BinaryDataKeys = Vector<ConstStringView, uint32>;
+
+	static void WriteVariableInteger(BinaryDataBuffer& buffer, uint64 value)
+	{
+		while (value >= 0x80)
+		{
+			buffer.EmplaceBack(ByteType(value | 0x80));
+			value >>= 7;
+		}
+		buffer.EmplaceBack(ByteType(value));
+	}
+
+	static void WriteString(BinaryDataBuffer& buffer, const ConstStringView string)
+	{
+		WriteVariableInteger(buffer, string.GetSize());
+		buffer.CopyEmplaceRangeBack(ArrayView<const ByteType, size>{reinterpret_cast<const ByteType*>(string.GetData()), string.GetSize()});
+	}
+
+	[[nodiscard]] static ConstStringView GetStringView(const Value& value)
+	{
+		return ConstStringView{value.GetString(), value.GetStringLength()};
+	}
+
+	static void CollectKeys(const Value& value, BinaryDataKeyIndices& keyIndices, BinaryDataKeys& keys)
+	{
+		if (value.IsObject())
+		{
+			for (auto it = value.MemberBegin(), endIt = value.MemberEnd(); it != endIt; ++it)
+			{
+				const ConstStringView name = GetStringView(it->name);
+				if (!keyIndices.Contains(name))
+				{
+					keyIndices.Emplace(ConstStringView{name}, keys.GetSize());
+					keys.EmplaceBack(name);
+				}
+				CollectKeys(it->value, keyIndices, keys);
+			}
+		}
+		else if (value.IsArray())
+		{
+			for (auto it = value.Begin(), endIt = value.End(); it != endIt; ++it)
+			{
+				CollectKeys(*it, keyIndices, keys);
+			}
+		}
+	}
+
+	static void WriteValue(BinaryDataBuffer& buffer, const Value& value, const BinaryDataKeyIndices& keyIndices)
+	{
+		switch (value.GetType())
+		{
+			case rapidjson::kNullType:
+				buffer.EmplaceBack(ByteType(BinaryValueType::Null));
+				break;
+			case rapidjson::kFalseType:
+				buffer.EmplaceBack(ByteType(BinaryValueType::False));
+				break;
+			case rapidjson::kTrueType:
+				buffer.EmplaceBack(ByteType(BinaryValueType::True));
+				break;
+			case rapidjson::kNumberType:
+			{
+				if (value.IsInt64())
+				{
+					const int64 integer = value.GetInt64();
+					buffer.EmplaceBack(ByteType(BinaryValueType::Integer));
+					WriteVariableInteger(buffer, (uint64(integer) << 1) ^ uint64(integer >> 63));
+				}
+				else if (value.IsUint64())
+				{
+					buffer.EmplaceBack(ByteType(BinaryValueType::UnsignedInteger));
+					WriteVariableInteger(buffer, value.GetUint64());
+				}
+				else
+				{
+					buffer.EmplaceBack(ByteType(BinaryValueType::Double));
+					const uint64 bits = Memory::BitCast<uint64>(value.GetDouble());
+					for (uint8 byteIndex = 0; byteIndex < sizeof(uint64); ++byteIndex)
+					{
+						buffer.EmplaceBack(ByteType(bits >> (byteIndex * 8)));
+					}
+				}
+			}
+			break;
+			case rapidjson::kStringType:
+				buffer.EmplaceBack(ByteType(BinaryValueType::String));
+				WriteString(buffer, GetStringView(value));
+				break;
+			case rapidjson::kArrayType:
+			{
+				buffer.EmplaceBack(ByteType(BinaryValueType::Array));
+				WriteVariableInteger(buffer, value.Size());
+				for (auto it = value.Begin(), endIt = value.End(); it != endIt; ++it)
+				{
+					WriteValue(buffer, *it, keyIndices);
+				}
+			}
+			break;
+			case rapidjson::kObjectType:
+			{
+				buffer.EmplaceBack(ByteType(BinaryValueType::Object));
+				WriteVariableInteger(buffer, value.MemberCount());
+				for (auto it = value.MemberBegin(), endIt = value.MemberEnd(); it != endIt; ++it)
+				{
+					const auto keyIt = keyIndices.Find(GetStringView(it->name));
+					Assert(keyIt != keyIndices.end());
+					WriteVariableInteger(buffer, keyIt->second);
+					WriteValue(buffer, it->value, keyIndices);
+				}
+			}
+			break;
+		}
+	}
+
+	Vector<ByteType, size> EncodeBinaryData(const Value& value)
+	{
+		BinaryDataKeyIndices keyIndices;
+		BinaryDataKeys keys;
+		CollectKeys(value, keyIndices, keys);
+
+		BinaryDataBuffer buffer;
+		buffer.CopyEmplaceRangeBack(ArrayView<const ByteType, size>{BinaryDataMagic, sizeof(BinaryDataMagic)});
+		buffer.EmplaceBack(BinaryDataVersion);
+
+		WriteVariableInteger(buffer, keys.GetSize());
+		for (const ConstStringView key : keys)
+		{
+			WriteString(buffer, key);
+		}
+
+		WriteValue(buffer, value, keyIndices);
+		return buffer;
+	}
+
+	bool IsBinaryData(const ConstByteView data)
+	{
+		if (data.GetDataSize() < sizeof(BinaryDataMagic))
+		{
+			return false;
+		}
+
+		const ByteType* pData = data.GetData();
+		for (uint8 index = 0; index < sizeof(BinaryDataMagic); ++index)
+		{
+			if (pData[index] != BinaryDataMagic[index])
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	//! Builds document values from binary data, validating every read against the end of the data
+	struct BinaryDataDecoder
+	{
+		BinaryDataDecoder(const ConstByteView data, Document& document)
+			: m_pPosition(data.GetData())
+			, m_pEnd(data.GetData() + data.GetDataSize())
+			, m_allocator(document.GetAllocator())
+		{
+		}
+
+		[[nodiscard]] bool Decode(Value& valueOut)
+		{
+			return ReadHeader() && ReadValue(valueOut, 0) && m_pPosition == m_pEnd;
+		}
+	protected:
+		[[nodiscard]] size GetRemainingSize() const
+		{
+			return size(m_pEnd - m_pPosition);
+		}
+
+		[[nodiscard]] bool ReadVariableInteger(uint64& valueOut)
+		{
+			uint64 value = 0;
+			for (uint8 shift = 0; shift < 64; shift += 7)
+			{
+				if (UNLIKELY(m_pPosition == m_pEnd))
+				{
+					return false;
+				}
+
+				const ByteType byte = *m_pPosition++;
+				value |= uint64(byte & 0x7F) << shift;
+				if ((byte & 0x80) == 0)
+				{
+					valueOut = value;
+					return true;
+				}
+			}
+			return false;
+		}
+
+		//! Reads a count or length of elements that each occupy at least one byte of the remaining data
+		[[nodiscard]] bool ReadCount(rapidjson::SizeType& countOut)
+		{
+			uint64 count;
+			if (UNLIKELY(!ReadVariableInteger(count) || count > GetRemainingSize() || count > Math::NumericLimits<rapidjson::SizeType>::Max))
+			{
+				return false;
+			}
+			countOut = (rapidjson::SizeType)count;
+			return true;
+		}
+
+		[[nodiscard]] bool ReadString(ConstStringView& stringOut)
+		{
+			rapidjson::SizeType length;
+			if (UNLIKELY(!ReadCount(length)))
+			{
+				return false;
+			}
+			stringOut = ConstStringView{reinterpret_cast<const char*>(m_pPosition), length};
+			m_pPosition += length;
+			return true;
+		}
+
+		[[nodiscard]] bool ReadHeader()
+		{
+			if (UNLIKELY(!IsBinaryData(ConstByteView{m_pPosition, GetRemainingSize()})))
+			{
+				return false;
+			}
+			m_pPosition += sizeof(BinaryDataMagic);
+
+			if (UNLIKELY(m_pPosition == m_pEnd || *m_pPosition++ != BinaryDataVersion))
+			{
+				return false;
+			}
+
+			rapidjson::SizeType keyCount;
+			if (UNLIKELY(!ReadCount(keyCount)))
+			{
+				return false;
+			}
+			m_keys.Reserve(keyCount);
+			for (rapidjson::SizeType keyIndex = 0; keyIndex < keyCount; ++keyIndex)
+			{
+				ConstStringView key;
+				if (UNLIKELY(!ReadString(key)))
+				{
+					return false;
+				}
+				m_keys.EmplaceBack(key);
+			}
+			return true;
+		}
+
+		[[nodiscard]] bool ReadValue(Value& valueOut, const uint16 depth)
+		{
+			if (UNLIKELY(m_pPosition == m_pEnd || depth == MaximumBinaryDataDepth))
+			{
+				return false;
+			}
+
+			switch (BinaryValueType(*m_pPosition++))
+			{
+				case BinaryValueType::Null:
+					valueOut.SetNull();
+					return true;
+				case BinaryValueType::False:
+					valueOut.SetBool(false);
+					return true;
+				case BinaryValueType::True:
+					valueOut.SetBool(true);
+					return true;
+				case BinaryValueType::Integer:
+				{
+					uint64 encodedValue;
+					if (UNLIKELY(!ReadVariableInteger(encodedValue)))
+					{
+						return false;
+					}
+					valueOut.SetInt64(int64(encodedValue >> 1) ^ -int64(encodedValue & 1));
+					return true;
+				}
+				case BinaryValueType::UnsignedInteger:
+				{
+					uint64 value;
+					if (UNLIKELY(!ReadVariableInteger(value)))
+					{
+						return false;
+					}
+					valueOut.SetUint64(value);
+					return true;
+				}
+				case BinaryValueType::Double:
+				{
+					if (UNLIKELY(GetRemainingSize() < sizeof(uint64)))
+					{
+						return false;
+					}
+					uint64 bits = 0;
+					for (uint8 byteIndex = 0; byteIndex < sizeof(uint64); ++byteIndex)
+					{
+						bits |= uint64(m_pPosition[byteIndex]) << (byteIndex * 8);
+					}
+					m_pPosition += sizeof(uint64);
+					valueOut.SetDouble(Memory::BitCast<double>(bits));
+					return true;
+				}
+				case BinaryValueType::String:
+				{
+					ConstStringView string;
+					if (UNLIKELY(!ReadString(string)))
+					{
+						return false;
+					}
+					valueOut.SetString(string.GetData(), string.GetSize(), m_allocator);
+					return true;
+				}
+				case BinaryValueType::Array:
+				{
+					rapidjson::SizeType elementCount;
+					if (UNLIKELY(!ReadCount(elementCount)))
+					{
+						return false;
+					}
+					valueOut.SetArray();
+					valueOut.Reserve(elementCount, m_allocator);
+					for (rapidjson::SizeType elementIndex = 0; elementIndex < elementCount; ++elementIndex)
+					{
+						// Decode in place, so partially decoded values always belong to the document
+						valueOut.PushBack(Value(), m_allocator);
+						if (UNLIKELY(!ReadValue(valueOut[elementIndex], depth + 1)))
+						{
+							return false;
+						}
+					}
+					return true;
+				}
+				case BinaryValueType::Object:
+				{
+					rapidjson::SizeType memberCount;
+					if (UNLIKELY(!ReadCount(memberCount)))
+					{
+						return false;
+					}
+					valueOut.SetObject();
+					valueOut.ReserveMembers(memberCount, m_allocator);
+					for (rapidjson::SizeType memberIndex = 0; memberIndex < memberCount; ++memberIndex)
+					{
+						uint64 keyIndex;
+						if (UNLIKELY(!ReadVariableInteger(keyIndex) || keyIndex >= m_keys.GetSize()))
+						{
+							return false;
+						}
+						const ConstStringView key = m_keys[(uint32)keyIndex];
+						valueOut.AddMember(Value(key.GetData(), key.GetSize(), m_allocator), Value(), m_allocator);
+						if (UNLIKELY(!ReadValue((valueOut.MemberEnd() - 1)->value, depth + 1)))
+						{
+							return false;
+						}
+					}
+					return true;
+				}
+			}
+			return false;
+		}
+	protected:
+		const ByteType* m_pPosition;
+		const ByteType* m_pEnd;
+		Document::AllocatorType& m_allocator;
+		BinaryDataKeys m_keys;
+	};
+
+	//! Values of documents backed by an arena are not freed individually, they are released with the arena
+	static void ClearDocument(Document& document)
+	{
+		if (document.GetAllocator().NeedsFree())
+		{
+			document.SetNull();
+		}
+		else
+		{
+			new (static_cast<Value*>(&document)) Value();
+		}
+	}
+
+	bool DecodeBinaryData(const ConstByteView data, Document& document)
+	{
+		BinaryDataDecoder decoder(data, document);
+		ClearDocument(document);
+		if (UNLIKELY(!decoder.Decode(document)))
+		{
+			ClearDocument(document);
+			return false;
+		}
+		return true;
+	}
+
+	Vector<ByteType, size> ConvertJsonToBinaryData(const ConstStringView json)
+	{
+		Document document;
+		document.Parse(json.GetData(), json.GetSize());
+		if (UNLIKELY(document.HasParseError()))
+		{
+			return {};
+		}
+		return EncodeBinaryData(document);
+	}
+
+	String ConvertBinaryDataToJson(const ConstByteView data, const EnumFlags<SavingFlags> flags)
+	{
+		Document document;
+		if (UNLIKELY(!DecodeBinaryData(data, document)))
+		{
+			return {};
+		}
+		const Data serializedData(Move(document));
+		return serializedData.SaveToBuffer<String>(flags & ~SavingFlags::Binary);
+	}
+}
@@ -0,0 +1,49 @@
+#include <Common/Serialization/DocumentArena.h>
+
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Serialization
+{
+	//! Limits how many arenas each thread keeps, loads rarely hold more documents at once
+	inline static constexpr uint8 MaximumCachedDocumentArenaCount = 4;
+	//! Arenas that grew beyond this for an unusually large document return their blocks instead of holding on to them
+	inline static constexpr size MaximumCachedDocumentArenaSize = 4 * 1024 * 1024;
+
+	using DocumentArenaCache = Vector<UniquePtr<DocumentArena>, uint8>;
+
+	[[nodiscard]] static DocumentArenaCache& GetThreadDocumentArenaCache()
+	{
+		static thread_local DocumentArenaCache cache;
+		return cache;
+	}
+
+	UniquePtr<DocumentArena> DocumentArena::Acquire()
+	{
+		DocumentArenaCache& cache = GetThreadDocumentArenaCache();
+		if (cache.HasElements())
+		{
+			return cache.PopAndGetBack();
+		}
+		return UniquePtr<DocumentArena>::Make();
+	}
+
+	void DocumentArena::Release(UniquePtr<DocumentArena>&& pArena)
+	{
+		DocumentArenaCache& cache = GetThreadDocumentArenaCache();
+		if (cache.GetSize() == MaximumCachedDocumentArenaCount)
+		{
+			pArena = nullptr;
+			return;
+		}
+
+		if (pArena->GetReservedSize() > MaximumCachedDocumentArenaSize)
+		{
+			pArena->m_arena.ReleaseMemory();
+		}
+		else
+		{
+			pArena->m_arena.Reset();
+		}
+		cache.EmplaceBack(Move(pArena));
+	}
+}
@@ -0,0 +1,281 @@
+#include <Common/Serialization/StreamingReader.h>
+#include <Common/Serialization/Reader.h>
+
+#include <Common/Memory/Containers/ByteView.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/StringView.h>
+#include <Common/IO/File.h>
+#include <Common/IO/MappedFile.h>
+
+namespace ngine::Serialization
+{
+	//! Receives the SAX events of the top-level container and builds its members or elements into a document one at a time
+	struct StreamingHandler
+	{
+		StreamingHandler(const rapidjson::Type containerType, const StreamMemberCallback& callback, Data& valueData)
+			: m_containerType(containerType)
+			, m_callback(callback)
+			, m_valueData(valueData)
+		{
+		}
+
+		[[nodiscard]] bool WasStopped() const
+		{
+			return m_wasStopped;
+		}
+
+		bool Null()
+		{
+			return AddValue(Value());
+		}
+		bool Bool(const bool value)
+		{
+			return AddValue(Value(value));
+		}
+		bool Int(const int value)
+		{
+			return AddValue(Value(value));
+		}
+		bool Uint(const unsigned value)
+		{
+			return AddValue(Value(value));
+		}
+		bool Int64(const int64_t value)
+		{
+			return AddValue(Value(value));
+		}
+		bool Uint64(const uint64_t value)
+		{
+			return AddValue(Value(value));
+		}
+		bool Double(const double value)
+		{
+			return AddValue(Value(value));
+		}
+		bool RawNumber(const char* pString, const rapidjson::SizeType length, const bool copy)
+		{
+			return String(pString, length, copy);
+		}
+		bool String(const char* pString, const rapidjson::SizeType length, [[maybe_unused]] const bool copy)
+		{
+			// The reader reuses its string buffer, so the value needs its own copy
+			return AddValue(Value(pString, length, m_valueData.GetDocument().GetAllocator()));
+		}
+
+		bool StartObject()
+		{
+			return StartContainer(rapidjson::Type::kObjectType);
+		}
+		bool Key(const char* pString, const rapidjson::SizeType length, const bool copy)
+		{
+			if (m_depth == 1)
+			{
+				m_memberName = ConstStringView{pString, length};
+				return true;
+			}
+			return String(pString, length, copy);
+		}
+		bool EndObject(const rapidjson::SizeType memberCount)
+		{
+			if (m_depth-- == 1)
+			{
+				return true;
+			}
+
+			Document::AllocatorType& allocator = m_valueData.GetDocument().GetAllocator();
+			const uint32 firstMemberIndex = m_pendingValues.GetSize() - memberCount * 2;
+			Value& object = m_pendingValues[firstMemberIndex - 1];
+			object.ReserveMembers(memberCount, allocator);
+			for (uint32 index = firstMemberIndex, endIndex = m_pendingValues.GetSize(); index < endIndex; index += 2)
+			{
+				object.AddMember(Move(m_pendingValues[index]), Move(m_pendingValues[index + 1]), allocator);
+			}
+			m_pendingValues.Remove(m_pendingValues.GetView().GetSubViewFrom(firstMemberIndex));
+			return EndContainer();
+		}
+
+		bool StartArray()
+		{
+			return StartContainer(rapidjson::Type::kArrayType);
+		}
+		bool EndArray(const rapidjson::SizeType elementCount)
+		{
+			if (m_depth-- == 1)
+			{
+				return true;
+			}
+
+			Document::AllocatorType& allocator = m_valueData.GetDocument().GetAllocator();
+			const uint32 firstElementIndex = m_pendingValues.GetSize() - elementCount;
+			Value& array = m_pendingValues[firstElementIndex - 1];
+			array.Reserve(elementCount, allocator);
+			for (uint32 index = firstElementIndex, endIndex = m_pendingValues.GetSize(); index < endIndex; ++index)
+			{
+				array.PushBack(Move(m_pendingValues[index]), allocator);
+			}
+			m_pendingValues.Remove(m_pendingValues.GetView().GetSubViewFrom(firstElementIndex));
+			return EndContainer();
+		}
+	protected:
+		bool StartContainer(const rapidjson::Type type)
+		{
+			if (m_depth++ == 0)
+			{
+				return type == m_containerType;
+			}
+			m_pendingValues.EmplaceBack(type);
+			return true;
+		}
+
+		bool EndContainer()
+		{
+			if (m_depth == 1)
+			{
+				return EmitValue(m_pendingValues.PopAndGetBack());
+			}
+			return true;
+		}
+
+		bool AddValue(Value&& value)
+		{
+			switch (m_depth)
+			{
+				case 0:
+					// The top-level value must be the container
+					return false;
+				case 1:
+					return EmitValue(Forward<Value>(value));
+				default:
+					m_pendingValues.EmplaceBack(Forward<Value>(value));
+					return true;
+			}
+		}
+
+		bool EmitValue(Value&& value)
+		{
+			// Replacing the root frees the previously emitted value
+			static_cast<Value&>(m_valueData.GetDocument()) = Forward<Value>(value);
+			if (!m_callback(m_memberName, Reader(m_valueData)))
+			{
+				m_wasStopped = true;
+				return false;
+			}
+			return true;
+		}
+	protected:
+		const rapidjson::Type m_containerType;
+		const StreamMemberCallback& m_callback;
+		Data& m_valueData;
+		//! Values of containers that are still being parsed, interleaved with their member names for objects
+		Vector<Value, uint32> m_pendingValues;
+		ngine::String m_memberName;
+		uint32 m_depth{0};
+		bool m_wasStopped{false};
+	};
+
+	static bool Stream(
+		const ConstByteView data,
+		const rapidjson::Type containerType,
+		const StreamMemberCallback& callback,
+		const EnumFlags<ContextFlags> contextFlags
+	)
+	{
+		if (IsBinaryData(data))
+		{
+			Data serializedData(contextFlags);
+			if (UNLIKELY(!DecodeBinaryData(data, serializedData.GetDocument()) || serializedData.GetDocument().GetType() != containerType))
+			{
+				return false;
+			}
+
+			const Value& container = serializedData.GetDocument();
+			if (containerType == rapidjson::Type::kObjectType)
+			{
+				for (const Value::Member& member : container.GetObject())
+				{
+					if (!callback(ConstStringView{member.name.GetString(), member.name.GetStringLength()}, Reader(member.value, serializedData)))
+					{
+						break;
+					}
+				}
+			}
+			else
+			{
+				for (const Value& element : container.GetArray())
+				{
+					if (!callback(ConstStringView{}, Reader(element, serializedData)))
+					{
+						break;
+					}
+				}
+			}
+			return true;
+		}
+
+		Data valueData(contextFlags);
+		StreamingHandler handler(containerType, callback, valueData);
+		rapidjson::MemoryStream memoryStream(reinterpret_cast<const char*>(data.GetData()), data.GetDataSize());
+		rapidjson::EncodedInputStream<rapidjson::UTF8<>, rapidjson::MemoryStream> inputStream(memoryStream);
+		rapidjson::GenericReader<rapidjson::UTF8<>, rapidjson::UTF8<>, Internal::RapidJsonAllocator> reader;
+		const rapidjson::ParseResult result = reader.Parse<rapidjson::kParseDefaultFlags>(inputStream, handler);
+		return !result.IsError() || handler.WasStopped();
+	}
+
+	static bool
+	StreamFile(const IO::ConstZeroTerminatedPathView filePath, const rapidjson::Type containerType, const StreamMemberCallback& callback)
+	{
+		if (const IO::MappedFile mappedFile(filePath, IO::MappedFile::AccessPattern::Sequential); mappedFile.IsValid())
+		{
+			return Stream(mappedFile.GetView(), containerType, callback, ContextFlags::FromDisk);
+		}
+
+		// Not a regular file, for example packaged assets
+		const IO::File file(filePath, IO::AccessModeFlags::ReadBinary, IO::SharingFlags::DisallowWrite);
+		if (UNLIKELY(!file.IsValid()))
+		{
+			return false;
+		}
+
+		FixedSizeVector<ByteType, size> contents(Memory::ConstructWithSize, Memory::Uninitialized, static_cast<size>(file.GetSize()));
+		if (UNLIKELY(!file.ReadIntoView(contents.GetView())))
+		{
+			return false;
+		}
+		return Stream(contents.GetView(), containerType, callback, ContextFlags::FromDisk);
+	}
+
+	bool StreamObjectMembers(const ConstByteView data, const StreamMemberCallback& callback, const EnumFlags<ContextFlags> contextFlags)
+	{
+		return Stream(data, rapidjson::Type::kObjectType, callback, contextFlags);
+	}
+
+	bool StreamObjectMembers(const IO::ConstZeroTerminatedPathView filePath, const StreamMemberCallback& callback)
+	{
+		return StreamFile(filePath, rapidjson::Type::kObjectType, callback);
+	}
+
+	bool StreamArrayElements(const ConstByteView data, const StreamElementCallback& callback, const EnumFlags<ContextFlags> contextFlags)
+	{
+		return Stream(
+			data,
+			rapidjson::Type::kArrayType,
+			[&callback](ConstStringView, const Reader reader)
+			{
+				return callback(reader);
+			},
+			contextFlags
+		);
+	}
+
+	bool StreamArrayElements(const IO::ConstZeroTerminatedPathView filePath, const StreamElementCallback& callback)
+	{
+		return StreamFile(
+			filePath,
+			rapidjson::Type::kArrayType,
+			[&callback](ConstStringView, const Reader reader)
+			{
+				return callback(reader);
+			}
+		);
+	}
+}
@@ -22,7 +22,7 @@ namespace ngine::Threading
 		Assert(exchanged);
 		if (LIKELY(exchanged))
 		{
-			if ((GetAllowedJobRunnerMask() & (1ull << thread.GetThreadIndex())) != 0)
+			if (CanRunOnRunner(thread.GetThreadIndex()))
 			{
 				if (!thread.QueueJobFromThread(*this))
 				{
@@ -45,7 +45,7 @@ namespace ngine::Threading
 		if (LIKELY(exchanged))
 		{
 			Optional<Threading::JobRunnerThread*> pThread = Threading::JobRunnerThread::GetCurrent();
-			if (pThread.IsValid() && (GetAllowedJobRunnerMask() & (1ull << pThread->GetThreadIndex())) != 0)
+			if (pThread.IsValid() && CanRunOnRunner(pThread->GetThreadIndex()))
 			{
 				if (!pThread->QueueJobFromThread(*this))
 				{
@@ -61,7 +61,7 @@ namespace ngine::Threading
 
 	void Job::QueueExclusiveFromCurrentThread(JobRunnerThread& thread)
 	{
-		Assert((GetAllowedJobRunnerMask() & (1ull << thread.GetThreadIndex())) != 0);
+		Assert(CanRunOnRunner(thread.GetThreadIndex()));
 		Assert(!m_stateFlags.IsSet(StateFlags::Destroying));
 		StateFlags expected = StateFlags::None;
 		[[maybe_unused]] const bool exchanged = m_stateFlags.CompareExchangeStrong(expected, StateFlags::Queued);
@@ -74,7 +74,7 @@ namespace ngine::Threading
 
 	void Job::QueueExclusiveFromAnyThread(JobRunnerThread& thread)
 	{
-		Assert((GetAllowedJobRunnerMask() & (1ull << thread.GetThreadIndex())) != 0);
+		Assert(CanRunOnRunner(thread.GetThreadIndex()));
 		Assert(!m_stateFlags.IsSet(StateFlags::Destroying));
 		StateFlags expected = StateFlags::None;
 		[[maybe_unused]] const bool exchanged = m_stateFlags.CompareExchangeStrong(expected, StateFlags::Queued);
@@ -90,7 +90,7 @@ namespace ngine::Threading
 		const EnumFlags<StateFlags> previousValue = m_stateFlags.FetchOr(StateFlags::Queued);
 		if (!previousValue.IsSet(StateFlags::Queued))
 		{
-			const bool canExecuteOnThread = (GetAllowedJobRunnerMask() & (1ull << thread.GetThreadIndex())) != 0;
+			const bool canExecuteOnThread = CanRunOnRunner(thread.GetThreadIndex());
 			if (!canExecuteOnThread || !thread.QueueJobFromThread(*this))
 			{
 				JobRunnerThread::QueueOnIdealRunner(thread.GetJobManager(), *this);
@@ -105,7 +105,7 @@ namespace ngine::Threading
 		if (!previousValue.IsSet(StateFlags::Queued))
 		{
 			Optional<Threading::JobRunnerThread*> pThread = Threading::JobRunnerThread::GetCurrent();
-			if (pThread.IsValid() && (GetAllowedJobRunnerMask() & (1ull << pThread->GetThreadIndex())) != 0)
+			if (pThread.IsValid() && CanRunOnRunner(pThread->GetThreadIndex()))
 			{
 				if (!pThread->QueueJobFromThread(*this))
 				{
@@ -121,7 +121,7 @@ namespace ngine::Threading
 
 	void Job::TryQueueExclusiveFromThread(JobRunnerThread& thread)
 	{
-		Assert((GetAllowedJobRunnerMask() & (1ull << thread.GetThreadIndex())) != 0);
+		Assert(CanRunOnRunner(thread.GetThreadIndex()));
 		Assert(!m_stateFlags.IsSet(StateFlags::Destroying));
 		const EnumFlags<StateFlags> previousValue = m_stateFlags.FetchOr(StateFlags::Queued);
 		if (!previousValue.IsSet(StateFlags::Queued))
@@ -132,7 +132,7 @@ namespace ngine::Threading
 
 	void Job::TryQueueExclusiveFromAnyThread(JobRunnerThread& thread)
 	{
-		Assert((GetAllowedJobRunnerMask() & (1ull << thread.GetThreadIndex())) != 0);
+		Assert(CanRunOnRunner(thread.GetThreadIndex()));
 		Assert(!m_stateFlags.IsSet(StateFlags::Destroying));
 		const EnumFlags<StateFlags> previousValue = m_stateFlags.FetchOr(StateFlags::Queued);
 		if (!previousValue.IsSet(StateFlags::Queued))
@@ -141,8 +141,42 @@ namespace ngine::Threading
 		}
 	}
 
+	void Job::SetAllowedJobRunnerMask(const JobRunnerMask& mask)
+	{
+		Assert(mask.AreAnySet());
+		if (mask.AreAllSet())
+		{
+			m_runnerAffinity = RunnerAffinity::Any;
+			m_pCustomRunnerMask.DestroyElement();
+		}
+		else if (mask.GetNumberOfSetBits() == 1)
+		{
+			m_runnerAffinity = RunnerAffinity::Exclusive;
+			m_exclusiveRunnerIndex = (uint8)*mask.GetFirstSetIndex();
+			m_pCustomRunnerMask.DestroyElement();
+		}
+		else
+		{
+			m_runnerAffinity = RunnerAffinity::Custom;
+			if (m_pCustomRunnerMask.IsValid())
+			{
+				*m_pCustomRunnerMask = mask;
+			}
+			else
+			{
+				m_pCustomRunnerMask.CreateInPlace(mask);
+			}
+		}
+	}
+
 	void Job::SetExclusiveToThread(JobRunnerThread& thread)
 	{
-		m_allowedJobRunnerMask = 1ull << thread.GetThreadIndex();
+		const uint8 threadIndex = thread.GetThreadIndex();
+		if (!IsExclusiveToRunner(threadIndex))
+		{
+			m_runnerAffinity = RunnerAffinity::Exclusive;
+			m_exclusiveRunnerIndex = threadIndex;
+			m_pCustomRunnerMask.DestroyElement();
+		}
 	}
 }
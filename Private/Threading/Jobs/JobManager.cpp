@@ -12,6 +12,8 @@
 #include <Common/Math/Ceil.h>
 #include <Common/Math/Max.h>
 #include <Common/Platform/GetProcessorCoreTypes.h>
+#include <Common/Platform/GetProcessorTopology.h>
+#include <Common/Algorithms/Sort.h>
 
 #if PLATFORM_WINDOWS
 #include <Common/Platform/Windows.h>
@@ -65,17 +67,19 @@ namespace ngine::Threading
 		const Math::Range<uint16> efficiencyWorkerRange
 	)
 	{
+		Assert(count <= MaximumRunnerCount);
 		CreateJobRunners(count);
+		m_usedRunnerMaskBlockCount = (uint8)Math::Ceil((float)count / (float)JobRunnerMaskBitsPerBlock);
 
 		for (const uint16 threadIndex : performanceHighPriorityWorkerRange)
 		{
 			m_jobThreads[(uint8)threadIndex]->MakeHighPriorityPerformanceTaskRunner();
-			m_performanceHighPriorityThreadMask |= (1ull << threadIndex);
+			m_performanceHighPriorityThreadMask.Set(threadIndex);
 		}
 		for (const uint16 threadIndex : performanceLowPriorityWorkerRange)
 		{
 			m_jobThreads[(uint8)threadIndex]->MakeLowPriorityPerformanceTaskRunner();
-			m_performanceLowPriorityThreadMask |= (1ull << threadIndex);
+			m_performanceLowPriorityThreadMask.Set(threadIndex);
 		}
 
 		if (efficiencyWorkerRange.GetSize() > 0)
@@ -83,7 +87,7 @@ namespace ngine::Threading
 			for (const uint16 threadIndex : efficiencyWorkerRange)
 			{
 				m_jobThreads[(uint8)threadIndex]->MakeEfficiencyTaskRunner();
-				m_efficiencyThreadMask |= (1ull << threadIndex);
+				m_efficiencyThreadMask.Set(threadIndex);
 			}
 		}
 		else
@@ -95,9 +99,9 @@ namespace ngine::Threading
 			m_efficiencyThreadMask = m_performanceLowPriorityThreadMask;
 		}
 
-		Assert(m_performanceHighPriorityThreadMask != 0, "Must have at least one high performance runner!");
-		Assert(m_performanceLowPriorityThreadMask != 0, "Must have at least one low performance runner!");
-		Assert(m_efficiencyThreadMask != 0, "Must have at least one efficiency runner!");
+		Assert(m_performanceHighPriorityThreadMask.AreAnySet(), "Must have at least one high performance runner!");
+		Assert(m_performanceLowPriorityThreadMask.AreAnySet(), "Must have at least one low performance runner!");
+		Assert(m_efficiencyThreadMask.AreAnySet(), "Must have at least one efficiency runner!");
 
 		if constexpr (DEBUG_BUILD && ENABLE_ASSERTS)
 		{
@@ -110,8 +114,12 @@ namespace ngine::Threading
 			}
 		}
 
+		const Platform::ProcessorTopology& processorTopology = Platform::GetProcessorTopology();
+		AssignRunnerLocality(processorTopology);
+
 #if PLATFORM_WINDOWS
 		// Allow running on all threads
+		// Note that this only covers the first processor group, on Windows 11 threads are scheduled across groups by default
 		SetProcessAffinityMask(GetCurrentProcess(), Math::NumericLimits<uint64>::Max);
 #endif
 
@@ -146,6 +154,73 @@ namespace ngine::Threading
 				Assert(GetJobThread(m_jobThreads[i]->GetThreadId()) == &*m_jobThreads[i]);
 			}
 		}
+
+		// Only pin on machines with multiple caches or NUMA nodes, elsewhere the OS scheduler does a better job
+		if (processorTopology.HasMultipleLocalityDomains())
+		{
+			PinRunnersToCacheDomains(processorTopology);
+		}
+	}
+
+	void JobManager::AssignRunnerLocality(const Platform::ProcessorTopology& topology)
+	{
+		using LogicalProcessor = Platform::ProcessorTopology::LogicalProcessor;
+		Platform::ProcessorTopology::LogicalProcessors processors = topology.m_logicalProcessors;
+		Assert(processors.HasElements());
+		Algorithms::Sort(
+			processors.begin().Get(),
+			processors.end().Get(),
+			[](const LogicalProcessor& left, const LogicalProcessor& right)
+			{
+				if (left.m_numaNodeIndex != right.m_numaNodeIndex)
+				{
+					return left.m_numaNodeIndex < right.m_numaNodeIndex;
+				}
+				if (left.m_cacheDomainIndex != right.m_cacheDomainIndex)
+				{
+					return left.m_cacheDomainIndex < right.m_cacheDomainIndex;
+				}
+				return left.m_index < right.m_index;
+			}
+		);
+
+		// Runners beyond the processor count wrap around and share processors
+		const uint8 runnerCount = (uint8)m_jobThreads.GetSize();
+		Array<uint16, MaximumRunnerCount> runnerNumaNodeIndices{Memory::Zeroed};
+		for (uint8 runnerIndex = 0; runnerIndex < runnerCount; ++runnerIndex)
+		{
+			const LogicalProcessor& processor = processors[runnerIndex % processors.GetSize()];
+			m_runnerCacheDomainIndices[runnerIndex] = processor.m_cacheDomainIndex;
+			runnerNumaNodeIndices[runnerIndex] = processor.m_numaNodeIndex;
+		}
+
+		for (uint8 runnerIndex = 0; runnerIndex < runnerCount; ++runnerIndex)
+		{
+			JobRunnerMask sharedCacheRunnerMask;
+			JobRunnerMask sharedNumaNodeRunnerMask;
+			for (uint8 otherRunnerIndex = 0; otherRunnerIndex < runnerCount; ++otherRunnerIndex)
+			{
+				if (m_runnerCacheDomainIndices[otherRunnerIndex] == m_runnerCacheDomainIndices[runnerIndex])
+				{
+					sharedCacheRunnerMask.Set(otherRunnerIndex);
+				}
+				if (runnerNumaNodeIndices[otherRunnerIndex] == runnerNumaNodeIndices[runnerIndex])
+				{
+					sharedNumaNodeRunnerMask.Set(otherRunnerIndex);
+				}
+			}
+			m_jobThreads[runnerIndex]->SetLocalityRunnerMasks(sharedCacheRunnerMask, sharedNumaNodeRunnerMask);
+		}
+	}
+
+	void JobManager::PinRunnersToCacheDomains(const Platform::ProcessorTopology& topology)
+	{
+		// The main thread is owned by the application, only pin the runners we started
+		for (uint8 runnerIndex = 1, runnerCount = (uint8)m_jobThreads.GetSize(); runnerIndex < runnerCount; ++runnerIndex)
+		{
+			const Platform::LogicalProcessorMask processorMask = topology.GetCacheDomainProcessorMask(m_runnerCacheDomainIndices[runnerIndex]);
+			m_jobThreads[runnerIndex]->SetAffinityMask(processorMask);
+		}
 	}
 
 	void JobManager::CreateJobRunners(const uint16 count)
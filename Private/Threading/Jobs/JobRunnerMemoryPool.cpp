@@ -0,0 +1,42 @@
+#include "Threading/Jobs/JobRunnerMemoryPool.h"
+
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Threading/Mutexes/UniqueLock.h>
+
+namespace ngine::Threading
+{
+	//! Pools released by destroyed runners, only accessed when runners are created or destroyed
+	static Threading::Mutex releasedPoolsMutex;
+	static JobRunnerMemoryPool* pReleasedPools{nullptr};
+
+	JobRunnerMemoryPool& JobRunnerMemoryPool::Acquire()
+	{
+		{
+			Threading::UniqueLock lock(releasedPoolsMutex);
+			if (JobRunnerMemoryPool* pPool = pReleasedPools)
+			{
+				pReleasedPools = pPool->m_pNextReleasedPool;
+				pPool->m_pNextReleasedPool = nullptr;
+				return *pPool;
+			}
+		}
+
+		// Intentionally never destroyed, blocks can be freed into the pool after its runner is gone
+		return *new JobRunnerMemoryPool();
+	}
+
+	void JobRunnerMemoryPool::Release(JobRunnerMemoryPool& pool)
+	{
+		// The runner may be destroyed on its own thread, which must not keep using the pool once it is adopted
+		if (GetCurrent().Get() == &pool)
+		{
+			GetCurrent() = nullptr;
+		}
+
+		pool.ReleaseCachedBlocks();
+
+		Threading::UniqueLock lock(releasedPoolsMutex);
+		pool.m_pNextReleasedPool = pReleasedPools;
+		pReleasedPools = &pool;
+	}
+}
@@ -15,6 +15,8 @@ namespace ngine::Threading
 	JobRunnerThread::JobRunnerThread(JobManager& manager)
 		: m_manager(manager)
 	{
+		// Until the topology is known, treat all runners as sharing our cache
+		m_localityRunnerMasks[(uint8)LocalityDistance::SharedCache] = JobRunnerMask{Memory::SetAll};
 	}
 
 	JobRunnerThread::~JobRunnerThread()
@@ -45,11 +47,23 @@ namespace ngine::Threading
 			Assert(cleared);
 		}
 
+		for (StealableQueue& queue : m_stealableQueues)
+		{
+			while (Job* pEntry = queue.Pop())
+			{
+				Job* pJob = &GetStealableQueueEntryJob(pEntry);
+				[[maybe_unused]] const bool cleared = pJob->m_stateFlags.FetchAnd(~Job::StateFlags::Queued).IsSet(Job::StateFlags::Queued);
+				Assert(cleared);
+			}
+		}
+
 		if (m_pNextJob != nullptr)
 		{
 			[[maybe_unused]] const bool cleared = m_pNextJob->m_stateFlags.FetchAnd(~Job::StateFlags::Queued).IsSet(Job::StateFlags::Queued);
 			Assert(cleared);
 		}
+
+		JobRunnerMemoryPool::Release(m_memoryPool);
 	}
 
 	void JobRunnerThread::StartThread(const ConstNativeStringView name, const ThreadIndexType threadIndex)
@@ -78,6 +92,7 @@ namespace ngine::Threading
 
 		// SetAffinityMask(m_threadId, 1ull << 0);
 		GetCurrent() = this;
+		JobRunnerMemoryPool::GetCurrent() = &m_memoryPool;
 
 		BaseType::InitializeExternallyCreatedFromThread();
 	}
@@ -88,6 +103,7 @@ namespace ngine::Threading
 			;
 
 		GetCurrent() = this;
+		JobRunnerMemoryPool::GetCurrent() = &m_memoryPool;
 
 		SetDefaultPriority();
 
@@ -119,6 +135,12 @@ namespace ngine::Threading
 			// No work is available to us right now
 			if (!m_flags.AreAnySet(Flags::HasWork))
 			{
+				if (m_manager.IsWorkStealingEnabled() && TryStealJobFromOtherRunners())
+				{
+					// Stolen job is now our next job, execute it on the next tick
+					return;
+				}
+
 				{
 					Threading::UniqueLock idleLock(m_threadSafeQueueMutex);
 					if (m_flags.AreNoneSet(Flags::HasAnyJobsInThreadSafeQueues))
@@ -194,7 +216,7 @@ namespace ngine::Threading
 
 	bool JobRunnerThread::TrySetNextJob(Job& job)
 	{
-		Assert((job.GetAllowedJobRunnerMask() & (1ull << m_threadIndex)) != 0);
+		Assert(job.CanRunOnRunner(m_threadIndex));
 		Assert(Memory::GetAddressOf(job) != nullptr);
 		Assert(IsExecutingOnThread());
 
@@ -215,7 +237,7 @@ namespace ngine::Threading
 			UpdatePriorityForJob(job);
 			Assert(m_flags.IsSet(Flags::HasNextJob));
 
-			const bool isExclusiveToRunner = pPreviousNextJob->GetAllowedJobRunnerMask() == (1ull << m_threadIndex);
+			const bool isExclusiveToRunner = pPreviousNextJob->IsExclusiveToRunner(m_threadIndex);
 			if (isExclusiveToRunner)
 			{
 				QueueExclusiveJobImmediate(*pPreviousNextJob);
@@ -245,9 +267,17 @@ namespace ngine::Threading
 		{
 			if (!TrySetNextJob(job))
 			{
-				if (!ShareJobWithFirstIdleThread(job))
+				const bool isTriviallyShareable = job.CanRunOnAnyRunner();
+				if (m_manager.IsWorkStealingEnabled() & isTriviallyShareable)
+				{
+					if (!PushStealableJob(job))
+					{
+						QueueJobImmediate(job);
+					}
+				}
+				else if (!ShareJobWithFirstIdleThread(job))
 				{
-					const bool isExclusiveToRunner = job.GetAllowedJobRunnerMask() == (1ull << m_threadIndex);
+					const bool isExclusiveToRunner = job.IsExclusiveToRunner(m_threadIndex);
 					if (isExclusiveToRunner)
 					{
 						QueueExclusiveJobImmediate(job);
@@ -281,7 +311,7 @@ namespace ngine::Threading
 	void JobRunnerThread::QueueJobImmediate(Job& __restrict job)
 	{
 		Assert(Memory::GetAddressOf(job) != nullptr);
-		Assert(job.GetAllowedJobRunnerMask() != (1ull << m_threadIndex), "Job must not be exclusive to thread");
+		Assert(!job.IsExclusiveToRunner(m_threadIndex), "Job must not be exclusive to thread");
 		Assert(job.IsQueued());
 		Assert(!m_queue.Contains(job));
 		Assert(!m_exclusiveQueue.Contains(job));
@@ -310,7 +340,7 @@ namespace ngine::Threading
 
 		Assert(IsExecutingOnThread());
 
-		job.SetAllowedJobRunnerMask(1ull << m_threadIndex);
+		job.SetExclusiveToThread(*this);
 
 		if (!TrySetNextJob(job))
 		{
@@ -323,7 +353,7 @@ namespace ngine::Threading
 		Assert(Memory::GetAddressOf(job) != nullptr);
 		Assert(job.IsQueued());
 
-		job.SetAllowedJobRunnerMask(1ull << m_threadIndex);
+		job.SetExclusiveToThread(*this);
 
 		QueueJobImmediateThreadSafe(job);
 	}
@@ -359,7 +389,7 @@ namespace ngine::Threading
 		Threading::UniqueLock lock(m_threadSafeQueueMutex);
 		m_threadSafeQueueSize++;
 
-		const bool isExclusiveToRunner = job.GetAllowedJobRunnerMask() == (1ull << m_threadIndex);
+		const bool isExclusiveToRunner = job.IsExclusiveToRunner(m_threadIndex);
 		if (isExclusiveToRunner)
 		{
 			m_threadSafeExclusiveQueue.EmplaceBack(job);
@@ -381,14 +411,10 @@ namespace ngine::Threading
 	/* static */ void JobRunnerThread::QueueOnIdealRunner(JobManager& manager, Job& job)
 	{
 		Assert(Memory::GetAddressOf(job) != nullptr);
-		JobRunnerMask allowedRunnerMask = job.GetAllowedJobRunnerMask();
-		if (allowedRunnerMask == Math::NumericLimits<JobRunnerMask>::Max)
-		{
-			// Job has not opted in for explicit runner selection
-			// Calculate based on job priority
-			allowedRunnerMask = manager.GetPreferredRunnerMask(job.GetPriority());
-		}
-		Assert(allowedRunnerMask != 0);
+		// If the job has not opted in for explicit runner selection, calculate based on job priority
+		const JobRunnerMask& allowedRunnerMask =
+			job.CanRunOnAnyRunner() ? manager.GetPreferredRunnerMask(job.GetPriority()) : job.GetAllowedJobRunnerMask();
+		Assert(allowedRunnerMask.AreAnySet());
 		if (Optional<uint8> idleThreadIndex = manager.StealFirstIdleThread(allowedRunnerMask))
 		{
 			JobRunnerThread& idleThread = manager.GetJobThreads()[idleThreadIndex.Get()];
@@ -401,7 +427,7 @@ namespace ngine::Threading
 			Optional<JobRunnerThread*> bestRunner;
 			uint16 bestRunnerJobCount = Math::NumericLimits<uint16>::Max;
 
-			for (const uint8 threadIndex : Memory::GetSetBitsIterator(allowedRunnerMask))
+			for (const uint8 threadIndex : allowedRunnerMask.GetSetBitsIterator())
 			{
 				JobRunnerThread& runner = manager.GetJobThreads()[threadIndex];
 				const uint16 runnerJobCount = runner.GetQueuedJobCount();
@@ -434,7 +460,7 @@ namespace ngine::Threading
 			job.FlagQueued();
 		}
 
-		if (jobs.HasElements())
+		if (jobs.HasElements() && !m_manager.IsWorkStealingEnabled())
 		{
 			ShareJobsWithIdleThreads(
 				jobs,
@@ -481,7 +507,7 @@ namespace ngine::Threading
 		Assert(triviallyShareableJobs.GetNumberOfSetBits() == jobs.GetSize());
 		for (ReferenceWrapper<Job>& job : jobs)
 		{
-			if (job->GetAllowedJobRunnerMask() != Math::NumericLimits<JobRunnerMask>::Max)
+			if (!job->CanRunOnAnyRunner())
 			{
 				const uint16 index = jobs.GetIteratorIndex(Memory::GetAddressOf(job));
 				triviallyShareableJobs.Clear(index);
@@ -491,20 +517,29 @@ namespace ngine::Threading
 		// TODO: Investigate sharing for jobs that have a custom GetAllowedJobRunnerMask
 		// At the moment we keep those on their initial runners.
 
-		const JobRunnerMask allowedRunnerMask =
-			(m_manager.GetPerformanceLowPriorityThreadMask() * m_flags.IsSet(Flags::CanRunLowPriorityPerformanceJobs)) |
-			(m_manager.GetPerformanceHighPriorityThreadMask() * m_flags.IsSet(Flags::CanRunHighPriorityPerformanceJobs)) |
-			(m_manager.GetEfficiencyThreadMask() * m_flags.IsSet(Flags::CanRunEfficiencyJobs));
+		JobRunnerMask allowedRunnerMask;
+		if (m_flags.IsSet(Flags::CanRunLowPriorityPerformanceJobs))
+		{
+			allowedRunnerMask |= m_manager.GetPerformanceLowPriorityThreadMask();
+		}
+		if (m_flags.IsSet(Flags::CanRunHighPriorityPerformanceJobs))
+		{
+			allowedRunnerMask |= m_manager.GetPerformanceHighPriorityThreadMask();
+		}
+		if (m_flags.IsSet(Flags::CanRunEfficiencyJobs))
+		{
+			allowedRunnerMask |= m_manager.GetEfficiencyThreadMask();
+		}
 
 		const uint16 triviallyShareableJobCount = (uint16)triviallyShareableJobs.GetNumberOfSetBits();
 		const uint16 maximumSharedJobCount = triviallyShareableJobCount - uint16(totalExistingJobCount == 0);
 
-		Assert(allowedRunnerMask != 0);
+		Assert(allowedRunnerMask.AreAnySet());
 		const JobRunnerMask idleThreadMask =
 			m_manager.StealIdleThreads((uint8)Math::Min(maximumSharedJobCount, (uint16)m_manager.GetJobThreads().GetSize()), allowedRunnerMask);
-		if (idleThreadMask != 0)
+		if (idleThreadMask.AreAnySet())
 		{
-			const uint8 numIdleThreads = (uint8)Memory::GetNumberOfSetBits(idleThreadMask);
+			const uint8 numIdleThreads = (uint8)idleThreadMask.GetNumberOfSetBits();
 			Assert(numIdleThreads <= triviallyShareableJobCount);
 
 			const uint16 numJobsPerThread = (uint16)Math::Floor((float)triviallyShareableJobCount / (float)(numIdleThreads + 1));
@@ -527,14 +562,14 @@ namespace ngine::Threading
 					}
 					if (triviallyShareableJobs.AreAnySet())
 					{
-						for (const uint8 idleThreadIndex : Memory::GetSetBitsIterator(idleThreadMask))
+						for (const uint8 idleThreadIndex : idleThreadMask.GetSetBitsIterator())
 						{
 							JobRunnerThread& idleThread = m_manager.GetJobThreads()[idleThreadIndex];
 							const uint16 firstSetIndex = (uint16)*triviallyShareableJobs.GetFirstSetIndex();
 
 							[[maybe_unused]] const bool wasQueued = idleThread.QueueJobFromAnyThread(jobs[firstSetIndex]);
 							Assert(wasQueued);
-							unusedThreadMask &= ~(1 << idleThreadIndex);
+							unusedThreadMask.Clear(idleThreadIndex);
 
 							triviallyShareableJobs.Clear(firstSetIndex);
 							if (!triviallyShareableJobs.AreAnySet())
@@ -547,7 +582,7 @@ namespace ngine::Threading
 
 				jobs = jobs.GetSubView(0u, nextKeptJobIndex);
 
-				for (const uint8 idleThreadIndex : Memory::GetSetBitsIterator(unusedThreadMask))
+				for (const uint8 idleThreadIndex : unusedThreadMask.GetSetBitsIterator())
 				{
 					JobRunnerThread& idleThread = m_manager.GetJobThreads()[idleThreadIndex];
 					idleThread.UpdateIdleState();
@@ -559,14 +594,10 @@ namespace ngine::Threading
 	bool JobRunnerThread::ShareJobWithFirstIdleThread(Job& job) const
 	{
 		Assert(Memory::GetAddressOf(job) != nullptr);
-		JobRunnerMask allowedRunnerMask = job.GetAllowedJobRunnerMask();
-		if (allowedRunnerMask == Math::NumericLimits<JobRunnerMask>::Max)
-		{
-			// Job has not opted in for explicit runner selection
-			// Calculate based on job priority
-			allowedRunnerMask = m_manager.GetPreferredRunnerMask(job.GetPriority());
-		}
-		Assert(allowedRunnerMask != 0);
+		// If the job has not opted in for explicit runner selection, calculate based on job priority
+		const JobRunnerMask& allowedRunnerMask =
+			job.CanRunOnAnyRunner() ? m_manager.GetPreferredRunnerMask(job.GetPriority()) : job.GetAllowedJobRunnerMask();
+		Assert(allowedRunnerMask.AreAnySet());
 		if (Optional<uint8> idleThreadIndex = m_manager.StealFirstIdleThread(allowedRunnerMask))
 		{
 			JobRunnerThread& idleThread = m_manager.GetJobThreads()[idleThreadIndex.Get()];
@@ -582,6 +613,13 @@ namespace ngine::Threading
 	void JobRunnerThread::GiveWorkToOtherThreads()
 	{
 		Assert(IsExecutingOnThread());
+		if (m_manager.IsWorkStealingEnabled())
+		{
+			// Idle runners pull work themselves, only make sure our shareable jobs are visible to them
+			PublishStealableJobs();
+			return;
+		}
+
 		JobView jobs = m_queue.GetView();
 		ShareJobsWithIdleThreads(jobs, uint16(m_pNextJob != nullptr) + GetThreadSafeQueueSize() + m_exclusiveQueue.GetSize());
 		if (m_queue.GetSize() != jobs.GetSize())
@@ -607,6 +645,11 @@ namespace ngine::Threading
 		m_flags.Clear(Flags::HasNextJob);
 
 		// Before executing, give work to other idle threads if possible
+		if (m_manager.IsWorkStealingEnabled())
+		{
+			PublishStealableJobs();
+		}
+		else
 		{
 			JobView jobs = m_queue.GetView();
 			// Indicate that we have a job (the one we are about to execute)
@@ -639,7 +682,7 @@ namespace ngine::Threading
 					m_pNextJob = nullptr;
 					m_flags.Clear(Flags::HasNextJob);
 
-					const bool isExclusiveToRunner = pSkippedJob->GetAllowedJobRunnerMask() == (1ull << m_threadIndex);
+					const bool isExclusiveToRunner = pSkippedJob->IsExclusiveToRunner(m_threadIndex);
 					if (isExclusiveToRunner)
 					{
 						QueueExclusiveJobFromThread(*pSkippedJob);
@@ -665,7 +708,11 @@ namespace ngine::Threading
 		}
 
 		UpdatePriorityForJob(*pJob);
-		const Job::Result result = pJob->OnExecute(*this);
+		Job::Result result;
+		{
+			const Memory::UsageTagScope usageTagScope(pJob->GetUsageTag());
+			result = pJob->OnExecute(*this);
+		}
 
 		{
 			[[maybe_unused]] const bool cleared = pJob->m_stateFlags.FetchAnd(~Job::StateFlags::IsExecuting).IsSet(Job::StateFlags::IsExecuting);
@@ -681,7 +728,7 @@ namespace ngine::Threading
 			{
 				if (m_pNextJob != pJob)
 				{
-					const bool isExclusiveToRunner = pJob->GetAllowedJobRunnerMask() == (1ull << m_threadIndex);
+					const bool isExclusiveToRunner = pJob->IsExclusiveToRunner(m_threadIndex);
 					if (isExclusiveToRunner)
 					{
 						pJob->TryQueueExclusiveFromThread(*this);
@@ -842,6 +889,292 @@ namespace ngine::Threading
 				m_flags &= ~(Flags::HasJobsInLocalQueue * m_queue.IsEmpty());
 			}
 		}
+
+		if (flags.IsSet(Flags::HasJobsInStealableQueues))
+		{
+			if (Job* pJob = PopStealableJob())
+			{
+				if (!TrySetNextJob(*pJob))
+				{
+					// Lower priority than our next job, put it back where thieves can still find it
+					[[maybe_unused]] const bool wasPushed = m_stealableQueues[(uint8)GetStealableQueueType(*pJob)].Push(MakeStealableQueueEntry(*pJob));
+					Assert(wasPushed);
+				}
+			}
+		}
+	}
+
+	/* static */ JobRunnerThread::StealableQueueType JobRunnerThread::GetStealableQueueType(const Job& job)
+	{
+		if (job.IsEfficiencyJob())
+		{
+			return StealableQueueType::Efficiency;
+		}
+		else if (job.IsLowPriorityPerformanceJob())
+		{
+			return StealableQueueType::LowPriorityPerformance;
+		}
+		else
+		{
+			return StealableQueueType::HighPriorityPerformance;
+		}
+	}
+
+	JobRunnerMask JobRunnerThread::GetStealableQueueRunnerMask(const StealableQueueType queueType) const
+	{
+		switch (queueType)
+		{
+			case StealableQueueType::HighPriorityPerformance:
+				return m_manager.GetPerformanceHighPriorityThreadMask();
+			case StealableQueueType::LowPriorityPerformance:
+				return m_manager.GetPerformanceLowPriorityThreadMask();
+			case StealableQueueType::Efficiency:
+				// Low priority performance runners are also allowed to run efficiency jobs
+				return m_manager.GetEfficiencyThreadMask() | m_manager.GetPerformanceLowPriorityThreadMask();
+			case StealableQueueType::Count:
+				ExpectUnreachable();
+		}
+		ExpectUnreachable();
+	}
+
+	bool JobRunnerThread::CanStealFromQueue(const StealableQueueType queueType) const
+	{
+		const EnumFlags<Flags> flags = m_flags.GetFlags();
+		switch (queueType)
+		{
+			case StealableQueueType::HighPriorityPerformance:
+				return flags.IsSet(Flags::CanRunHighPriorityPerformanceJobs);
+			case StealableQueueType::LowPriorityPerformance:
+				return flags.IsSet(Flags::CanRunLowPriorityPerformanceJobs);
+			case StealableQueueType::Efficiency:
+				return flags.AreAnySet(Flags::CanRunEfficiencyJobs | Flags::CanRunLowPriorityPerformanceJobs);
+			case StealableQueueType::Count:
+				ExpectUnreachable();
+		}
+		ExpectUnreachable();
+	}
+
+	bool JobRunnerThread::PushStealableJob(Job& job)
+	{
+		Assert(IsExecutingOnThread());
+		Assert(job.IsQueued());
+		Assert(job.CanRunOnAnyRunner());
+
+		const StealableQueueType queueType = GetStealableQueueType(job);
+		if (m_stealableQueues[(uint8)queueType].Push(MakeStealableQueueEntry(job)))
+		{
+			m_flags |= Flags::HasJobsInStealableQueues;
+			WakeIdleRunnersForStealing(queueType, 1, GetMaximumStealDistance(job.GetLocalityHint()));
+			return true;
+		}
+		return false;
+	}
+
+	void JobRunnerThread::PublishStealableJobs()
+	{
+		Assert(IsExecutingOnThread());
+		if (m_queue.IsEmpty())
+		{
+			return;
+		}
+
+		// The local queue is sorted from lowest to highest priority
+		// Push in that order so that we pop the highest priority first, and thieves steal the lowest priority first
+		Array<uint16, (uint8)StealableQueueType::Count> publishedJobCounts{Memory::Zeroed};
+		Array<LocalityDistance, (uint8)StealableQueueType::Count> maximumStealDistances{Memory::Zeroed};
+		const JobView jobs = m_queue.GetView();
+		uint16 keptJobCount = 0;
+		for (Job& job : jobs)
+		{
+			const StealableQueueType queueType = GetStealableQueueType(job);
+			const bool isTriviallyShareable = job.CanRunOnAnyRunner();
+			if (isTriviallyShareable && m_stealableQueues[(uint8)queueType].Push(MakeStealableQueueEntry(job)))
+			{
+				publishedJobCounts[(uint8)queueType]++;
+				maximumStealDistances[(uint8)queueType] =
+					Math::Max(maximumStealDistances[(uint8)queueType], GetMaximumStealDistance(job.GetLocalityHint()));
+			}
+			else
+			{
+				jobs[keptJobCount++] = job;
+			}
+		}
+
+		if (keptJobCount != jobs.GetSize())
+		{
+			m_queue.Remove(m_queue.GetSubView(keptJobCount, m_queue.GetSize() - keptJobCount));
+			m_flags &= ~(Flags::HasJobsInLocalQueue * m_queue.IsEmpty());
+			m_flags |= Flags::HasJobsInStealableQueues;
+
+			for (uint8 queueIndex = 0; queueIndex < (uint8)StealableQueueType::Count; ++queueIndex)
+			{
+				if (publishedJobCounts[queueIndex] > 0)
+				{
+					WakeIdleRunnersForStealing(
+						(StealableQueueType)queueIndex,
+						(uint8)Math::Min(publishedJobCounts[queueIndex], (uint16)255u),
+						maximumStealDistances[queueIndex]
+					);
+				}
+			}
+		}
+	}
+
+	Job* JobRunnerThread::PopStealableJob()
+	{
+		Assert(IsExecutingOnThread());
+		for (StealableQueue& queue : m_stealableQueues)
+		{
+			if (Job* pEntry = queue.Pop())
+			{
+				return &GetStealableQueueEntryJob(pEntry);
+			}
+		}
+
+		// All stolen or executed, stop checking until we publish again
+		m_flags &= ~Flags::HasJobsInStealableQueues;
+		return nullptr;
+	}
+
+	Job* JobRunnerThread::StealJob(const StealableQueueType queueType, const LocalityDistance thiefDistance)
+	{
+		Job* pEntry = m_stealableQueues[(uint8)queueType].StealIf(
+			[thiefDistance](Job* pCandidateEntry)
+			{
+				return CanStealQueueEntry(pCandidateEntry, thiefDistance);
+			},
+			MaximumStealRejectionCount
+		);
+		return pEntry != nullptr ? &GetStealableQueueEntryJob(pEntry) : nullptr;
+	}
+
+	bool JobRunnerThread::TryStealJobFromOtherRunners()
+	{
+		Assert(IsExecutingOnThread());
+		Assert(m_pNextJob == nullptr);
+
+		// Prefer runners sharing our last level cache, then our NUMA node, before going remote
+		for (uint8 distanceIndex = 0; distanceIndex < (uint8)LocalityDistance::Count; ++distanceIndex)
+		{
+			const JobRunnerMask& victimMask = m_localityRunnerMasks[distanceIndex];
+			if (victimMask.AreAnySet() && TryStealJobFromRunners(victimMask, (LocalityDistance)distanceIndex))
+			{
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool JobRunnerThread::TryStealJobFromRunners(const JobRunnerMask& victimMask, const LocalityDistance distance)
+	{
+		const JobManager::JobThreadView jobThreads = m_manager.GetJobThreads();
+		const uint8 runnerCount = (uint8)jobThreads.GetSize();
+		if (runnerCount <= 1)
+		{
+			return false;
+		}
+
+		// Start at a random victim to spread thieves across runners
+		const uint8 firstVictimIndex = (uint8)Math::Random((uint32)0u, (uint32)runnerCount - 1u);
+		for (uint8 victimOffset = 0; victimOffset < runnerCount; ++victimOffset)
+		{
+			const uint8 victimIndex = uint8((firstVictimIndex + victimOffset) % runnerCount);
+			if (victimIndex == m_threadIndex || !victimMask.IsSet(victimIndex))
+			{
+				continue;
+			}
+
+			JobRunnerThread& victim = jobThreads[victimIndex];
+			for (uint8 queueIndex = 0; queueIndex < (uint8)StealableQueueType::Count; ++queueIndex)
+			{
+				const StealableQueueType queueType = (StealableQueueType)queueIndex;
+				if (CanStealFromQueue(queueType))
+				{
+					if (Job* pJob = victim.StealJob(queueType, distance))
+					{
+						[[maybe_unused]] const bool wasSet = TrySetNextJob(*pJob);
+						Assert(wasSet);
+						return true;
+					}
+				}
+			}
+		}
+
+		return false;
+	}
+
+	void JobRunnerThread::WakeIdleRunnersForStealing(
+		const StealableQueueType queueType, uint8 maximumCount, const LocalityDistance maximumDistance
+	)
+	{
+		JobRunnerMask queueRunnerMask = GetStealableQueueRunnerMask(queueType);
+		queueRunnerMask.Clear(m_threadIndex);
+
+		// Wake the closest runners first, and never wake runners that are too far away to steal the published jobs
+		for (uint8 distanceIndex = 0; distanceIndex <= (uint8)maximumDistance && maximumCount > 0; ++distanceIndex)
+		{
+			const JobRunnerMask allowedRunnerMask = queueRunnerMask & m_localityRunnerMasks[distanceIndex];
+			if (allowedRunnerMask.AreNoneSet())
+			{
+				continue;
+			}
+
+			const JobRunnerMask idleThreadMask = m_manager.StealIdleThreads(maximumCount, allowedRunnerMask);
+			for (const uint8 idleThreadIndex : idleThreadMask.GetSetBitsIterator())
+			{
+				JobRunnerThread& idleThread = m_manager.GetJobThreads()[idleThreadIndex];
+				idleThread.Wake();
+				maximumCount--;
+			}
+		}
+	}
+
+	void JobRunnerThread::SetLocalityRunnerMasks(const JobRunnerMask& sharedCacheRunnerMask, const JobRunnerMask& sharedNumaNodeRunnerMask)
+	{
+		JobRunnerMask& sharedCacheMask = m_localityRunnerMasks[(uint8)LocalityDistance::SharedCache];
+		sharedCacheMask = sharedCacheRunnerMask;
+
+		JobRunnerMask& sharedNumaNodeMask = m_localityRunnerMasks[(uint8)LocalityDistance::SharedNumaNode];
+		sharedNumaNodeMask = sharedNumaNodeRunnerMask;
+		sharedNumaNodeMask.Clear(sharedCacheRunnerMask);
+
+		JobRunnerMask& remoteMask = m_localityRunnerMasks[(uint8)LocalityDistance::Remote];
+		remoteMask = JobRunnerMask{Memory::SetAll};
+		remoteMask.Clear(sharedCacheRunnerMask);
+		remoteMask.Clear(sharedNumaNodeRunnerMask);
+	}
+
+	static_assert(alignof(Job) >= 4, "Stealable queue entries store the locality hint in the low pointer bits");
+	inline static constexpr uintptr StealableQueueEntryHintMask = 0b11;
+
+	/* static */ Job* JobRunnerThread::MakeStealableQueueEntry(Job& job)
+	{
+		return reinterpret_cast<Job*>(reinterpret_cast<uintptr>(&job) | (uintptr)job.GetLocalityHint());
+	}
+
+	/* static */ Job& JobRunnerThread::GetStealableQueueEntryJob(Job* pEntry)
+	{
+		return *reinterpret_cast<Job*>(reinterpret_cast<uintptr>(pEntry) & ~StealableQueueEntryHintMask);
+	}
+
+	/* static */ bool JobRunnerThread::CanStealQueueEntry(Job* pEntry, const LocalityDistance thiefDistance)
+	{
+		const JobLocalityHint hint = (JobLocalityHint)(reinterpret_cast<uintptr>(pEntry) & StealableQueueEntryHintMask);
+		return thiefDistance <= GetMaximumStealDistance(hint);
+	}
+
+	/* static */ JobRunnerThread::LocalityDistance JobRunnerThread::GetMaximumStealDistance(const JobLocalityHint hint)
+	{
+		switch (hint)
+		{
+			case JobLocalityHint::None:
+				return LocalityDistance::Remote;
+			case JobLocalityHint::SharedNumaNode:
+				return LocalityDistance::SharedNumaNode;
+			case JobLocalityHint::SharedCache:
+				return LocalityDistance::SharedCache;
+		}
+		ExpectUnreachable();
 	}
 
 	void JobRunnerThread::SetDefaultPriority()
@@ -0,0 +1,68 @@
+#include "Threading/SnapshotPointer.h"
+
+#include "Threading/Jobs/AsyncJob.h"
+#include "Threading/Jobs/JobManager.h"
+#include "Threading/Sleep.h"
+
+#include <Common/Memory/Containers/Array.h>
+#include <Common/System/Query.h>
+
+namespace ngine::Threading
+{
+	namespace Internal
+	{
+		struct alignas(64) SnapshotReaderSlot
+		{
+			Atomic<uint32> m_readerCount{0};
+		};
+		static Array<SnapshotReaderSlot, SnapshotReaderSlotCount> snapshotReaderSlots;
+		static Atomic<uint32> nextSnapshotReaderSlotIndex{0};
+
+		Atomic<uint32>& GetSnapshotReaderSlot()
+		{
+			static thread_local const uint8 slotIndex = uint8(nextSnapshotReaderSlotIndex.FetchAdd(1) % SnapshotReaderSlotCount);
+			return snapshotReaderSlots[slotIndex].m_readerCount;
+		}
+
+		SnapshotReaderSlotMask ClearIdleSnapshotReaderSlots(SnapshotReaderSlotMask mask)
+		{
+			for (uint8 slotIndex = 0; slotIndex < SnapshotReaderSlotCount; ++slotIndex)
+			{
+				const SnapshotReaderSlotMask slotBit = SnapshotReaderSlotMask(1) << slotIndex;
+				if ((mask & slotBit) != 0 && snapshotReaderSlots[slotIndex].m_readerCount.Load() == 0)
+				{
+					mask &= ~slotBit;
+				}
+			}
+			return mask;
+		}
+	}
+
+	void Reclaim(RetiredSnapshot&& snapshot)
+	{
+		if (snapshot.TryReclaim())
+		{
+			return;
+		}
+
+		if (const Optional<JobManager*> pJobManager = System::Find<JobManager>())
+		{
+			pJobManager->QueueCallback(
+				[snapshot = Move(snapshot)](JobRunnerThread&) mutable
+				{
+					return snapshot.TryReclaim() ? Job::Result::FinishedAndDelete : Job::Result::TryRequeue;
+				},
+				JobPriority::DeallocateResourcesMin,
+				"Reclaim Snapshot"
+			);
+		}
+		else
+		{
+			// Read scopes are short, so wait for the remaining readers to leave
+			while (!snapshot.TryReclaim())
+			{
+				Threading::Sleep(0);
+			}
+		}
+	}
+}
@@ -15,6 +15,7 @@
 #endif
 
 #include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/CountBits.h>
 #include <Common/Math/Floor.h>
 #include <Common/Platform/IsDebuggerAttached.h>
 
@@ -70,26 +71,40 @@ namespace ngine::Threading
 
 	/* static */ void Thread::SetAffinityMask(const ThreadId id, const uint64 mask)
 	{
-#if PLATFORM_WINDOWS
-		SetThreadAffinityMask(id.GetHandle(), mask);
-#elif PLATFORM_APPLE
-		Array<thread_affinity_policy, 64> affinityTags;
-		affinityTags.GetView().ZeroInitialize();
-
-		uint8 coreCount = 0;
-		for (uint8 i = 0; i < 64; ++i)
+		Platform::LogicalProcessorMask processorMask;
+		for (const uint8 processorIndex : Memory::GetSetBitsIterator(mask))
 		{
-			if ((mask >> i) & 1)
-			{
-				affinityTags[coreCount++].affinity_tag = i;
-			}
+			processorMask.Set(processorIndex);
 		}
+		SetAffinityMask(id, processorMask);
+	}
+
+	void Thread::SetAffinityMask(const uint64 mask)
+	{
+		SetAffinityMask(ThreadId::Get(GetThreadHandle()), mask);
+	}
+
+	/* static */ void Thread::SetAffinityMask(const ThreadId id, const Platform::LogicalProcessorMask& mask)
+	{
+		Assert(mask.AreAnySet());
+#if PLATFORM_WINDOWS
+		// Windows addresses processors in groups of 64
+		const uint16 groupIndex = (uint16)(*mask.GetFirstSetIndex() / 64u);
+		Assert((uint16)(*mask.GetLastSetIndex() / 64u) == groupIndex, "Affinity mask must not span multiple processor groups");
+		GROUP_AFFINITY groupAffinity{};
+		groupAffinity.Mask = (KAFFINITY)mask.GetBlock(groupIndex);
+		groupAffinity.Group = groupIndex;
+		SetThreadGroupAffinity(id.GetHandle(), &groupAffinity, nullptr);
+#elif PLATFORM_APPLE
+		// Threads sharing an affinity tag are scheduled on cores sharing a cache, use the first processor as the tag
+		thread_affinity_policy affinityPolicy;
+		affinityPolicy.affinity_tag = (integer_t)*mask.GetFirstSetIndex() + 1;
 
 		thread_policy_set(
 			pthread_mach_thread_np(static_cast<pthread_t>(id.GetHandle())),
 			THREAD_AFFINITY_POLICY,
-			(thread_policy_t)affinityTags.GetData(),
-			coreCount
+			(thread_policy_t)&affinityPolicy,
+			THREAD_AFFINITY_POLICY_COUNT
 		);
 #elif USE_WEB_WORKERS
 		UNUSED(id);
@@ -97,19 +112,23 @@ namespace ngine::Threading
 #elif USE_PTHREAD
 		cpu_set_t cpuMask;
 		CPU_ZERO(&cpuMask);
-		for (uint32 i = 0; i < sizeof(cpuMask) * 8; ++i)
+		for (const uint16 processorIndex : mask.GetSetBitsIterator())
 		{
-			if (mask & (1 << i))
+			if (processorIndex < CPU_SETSIZE)
 			{
-				CPU_SET(i, &cpuMask);
+				CPU_SET(processorIndex, &cpuMask);
 			}
 		}
 
-		sched_setaffinity(id.GetId(), sizeof(cpuMask), &cpuMask);
+#if PLATFORM_ANDROID
+		sched_setaffinity(pthread_gettid_np(id.GetHandle()), sizeof(cpuMask), &cpuMask);
+#else
+		pthread_setaffinity_np(id.GetHandle(), sizeof(cpuMask), &cpuMask);
+#endif
 #endif
 	}
 
-	void Thread::SetAffinityMask(const uint64 mask)
+	void Thread::SetAffinityMask(const Platform::LogicalProcessorMask& mask)
 	{
 		SetAffinityMask(ThreadId::Get(GetThreadHandle()), mask);
 	}
@@ -1559,6 +1559,16 @@ namespace absl
 				__builtin_prefetch(static_cast<const void*>(slots_ + seq.offset()));
 #endif // __GNUC__
 			}
+			// Extension: prefetches the probe location of a hash that was already computed by the caller
+			void prefetch_hash(size_t hash) const
+			{
+				(void)hash;
+#if defined(__GNUC__)
+				auto seq = probe(hash);
+				__builtin_prefetch(static_cast<const void*>(ctrl_ + seq.offset()));
+				__builtin_prefetch(static_cast<const void*>(slots_ + seq.offset()));
+#endif // __GNUC__
+			}
 
 			// The API of find() has two extensions.
 			//
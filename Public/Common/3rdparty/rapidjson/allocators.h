@@ -34,6 +34,9 @@ RAPIDJSON_NAMESPACE_BEGIN
 concept Allocator {
     static const bool kNeedFree;    //!< Whether this allocator needs to call Free().
 
+    //! Whether values allocated by this instance need to be freed, allows instances to release all memory as a whole instead
+    bool NeedsFree() const;
+
     // Allocate a memory block.
     // \param size of the memory block in bytes.
     // \returns pointer to the memory block.
@@ -62,6 +65,7 @@ concept Allocator {
 class CrtAllocator {
 public:
     static const bool kNeedFree = true;
+    bool NeedsFree() const { return kNeedFree; }
     void* Malloc(size_t size) { 
         if (size) //  behavior of malloc(0) is implementation defined.
             return std::malloc(size);
@@ -102,6 +106,7 @@ template <typename BaseAllocator = CrtAllocator>
 class MemoryPoolAllocator {
 public:
     static const bool kNeedFree = false;    //!< Tell users that no need to call Free() with this allocator. (concept Allocator)
+    bool NeedsFree() const { return kNeedFree; }
 
     //! Constructor with chunkSize.
     /*! \param chunkSize The size of memory chunk. The default is kDefaultChunkSize.
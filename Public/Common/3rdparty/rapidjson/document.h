@@ -2829,6 +2829,7 @@ public:
 
 	~GenericDocument()
 	{
+		AbandonRootIfNotFreed();
 		Destroy();
 	}
 
@@ -2836,6 +2837,8 @@ public:
 	//! Move assignment in C++11
 	GenericDocument& operator=(GenericDocument&& rhs) RAPIDJSON_NOEXCEPT
 	{
+		AbandonRootIfNotFreed();
+
 		// The cast to ValueType is necessary here, because otherwise it would
 		// attempt to call GenericValue's templated assignment operator.
 		ValueType::operator=(std::move(static_cast<ValueType&>(rhs)));
@@ -2866,6 +2869,8 @@ public:
 
 	GenericDocument& operator=(const GenericDocument& rhs) RAPIDJSON_NOEXCEPT
 	{
+		AbandonRootIfNotFreed();
+
 		// Calling the destructor here would prematurely call stack_'s destructor
 		Destroy();
 
@@ -2926,7 +2931,8 @@ public:
 		if (g(*this))
 		{
 			RAPIDJSON_ASSERT(stack_.GetSize() == sizeof(ValueType));  // Got one and only one root object
-			ValueType::operator=(*stack_.template Pop<ValueType>(1)); // Move value from stack to document
+			AbandonRootIfNotFreed();
+			ValueType::operator=(Move(*stack_.template Pop<ValueType>(1))); // Move value from stack to document
 		}
 		return *this;
 	}
@@ -2950,6 +2956,7 @@ public:
 		if (parseResult_)
 		{
 			RAPIDJSON_ASSERT(stack_.GetSize() == sizeof(ValueType));        // Got one and only one root object
+			AbandonRootIfNotFreed();
 			ValueType::operator=(Move(*stack_.template Pop<ValueType>(1))); // Move value from stack to document
 		}
 		return *this;
@@ -3243,7 +3250,7 @@ public:
 private:
 	void ClearStack()
 	{
-		if (Allocator::kNeedFree)
+		if (Allocator::kNeedFree && (allocator_ == 0 || allocator_->NeedsFree()))
 			while (stack_.GetSize() > 0) // Here assumes all elements in stack array are GenericValue (Member is actually 2 GenericValue objects)
 				(stack_.template Pop<ValueType>(1))->~ValueType();
 		else
@@ -3256,6 +3263,13 @@ private:
 		RAPIDJSON_DELETE(ownAllocator_);
 	}
 
+	//! Drops the root value without freeing it when the allocator instance releases its memory as a whole
+	void AbandonRootIfNotFreed()
+	{
+		if (Allocator::kNeedFree && allocator_ != 0 && !allocator_->NeedsFree())
+			new (static_cast<ValueType*>(this)) ValueType();
+	}
+
 	static const size_t kDefaultStackCapacity = 1024;
 	Allocator* allocator_;
 	Allocator* ownAllocator_;
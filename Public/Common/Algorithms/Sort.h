@@ -11,4 +11,19 @@ namespace ngine::Algorithms
 	{
 		std::sort(begin, end, Forward<Comparator>(comparator));
 	}
+
+	//! Sorts the range while keeping equivalent elements in their original order
+	template<typename Comparator, typename IteratorType>
+	void StableSort(IteratorType begin, IteratorType end, Comparator&& comparator)
+	{
+		std::stable_sort(begin, end, Forward<Comparator>(comparator));
+	}
+
+	//! Merges the two consecutive sorted ranges [begin, middle) and [middle, end) into one sorted range
+	//! Equivalent elements of the first range are ordered before those of the second range.
+	template<typename Comparator, typename IteratorType>
+	void MergeSorted(IteratorType begin, IteratorType middle, IteratorType end, Comparator&& comparator)
+	{
+		std::inplace_merge(begin, middle, end, Forward<Comparator>(comparator));
+	}
 }
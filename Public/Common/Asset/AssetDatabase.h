@@ -31,6 +31,7 @@ namespace ngine
 namespace ngine::Asset
 {
 	struct LocalDatabase;
+	struct DatabaseStamps;
 
 	namespace Internal
 	{
@@ -45,6 +46,15 @@ namespace ngine::Asset
 			using UnorderedSet::UnorderedSet;
 		};
 
+		//! Secondary index from an asset type, component type or tag guid to the assets that have it
+		struct AssetIndex : public UnorderedMap<Guid, AssetSet, Guid::Hash>
+		{
+			using UnorderedMap::UnorderedMap;
+
+			void Add(const Guid key, const Guid assetGuid);
+			void Remove(const Guid key, const Guid assetGuid);
+		};
+
 		bool Serialize(ngine::Asset::Internal::AssetEntryMap& map, const Serialization::Reader serializer, const IO::PathView prefix);
 		bool Serialize(const ngine::Asset::Internal::AssetEntryMap& map, Serialization::Writer serializer, const IO::PathView rootDirectory);
 	}
@@ -80,6 +90,13 @@ namespace ngine::Asset
 		[[nodiscard]] bool LoadAndGenerate(const ProjectInfo& project);
 		[[nodiscard]] bool LoadAndGenerate(const PluginInfo& plugin);
 
+		//! Incremental alternative to LoadAndGenerate, loads the database and the stamps saved next to it and only rescans what changed
+		//! Falls back to scanning everything if either could not be loaded.
+		//! Save the stamps with DatabaseStamps::Save whenever saving the database.
+		[[nodiscard]] bool LoadAndUpdate(const EngineInfo& engine, DatabaseStamps& stamps);
+		[[nodiscard]] bool LoadAndUpdate(const ProjectInfo& project, DatabaseStamps& stamps);
+		[[nodiscard]] bool LoadAndUpdate(const PluginInfo& plugin, DatabaseStamps& stamps);
+
 		void Import(const Database& other);
 
 		void Reserve(const uint32 count)
@@ -98,6 +115,15 @@ namespace ngine::Asset
 		[[nodiscard]] bool
 		RegisterAllAssetsInDirectory(const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory);
 
+		//! Registers new and modified assets in the directory, and removes assets whose files were deleted since the stamps were recorded
+		[[nodiscard]] bool UpdateAllAssetsInDirectory(
+			const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory, DatabaseStamps& stamps
+		);
+		//! Applies a single change reported by an IO::FileChangeListener
+		//! The path can be a file or directory that was added, modified or removed
+		void
+		ApplyFileChange(const IO::ConstZeroTerminatedPathView changedPath, const IO::PathView databaseRootDirectory, DatabaseStamps& stamps);
+
 		using AssetDiscoveryCallback = Function<void(IO::Path&& filePath), 96>;
 		static void FindAssetsInDirectory(const IO::ConstZeroTerminatedPathView directory, AssetDiscoveryCallback&& callback);
 
@@ -113,12 +139,34 @@ namespace ngine::Asset
 			const decltype(m_assetMap)::const_iterator it = m_assetMap.Find(assetGuid);
 			return Optional<const DatabaseEntry*>(&it->second, it != m_assetMap.end());
 		}
+		//! The asset type, component type and tags of the entry must not be changed, they are indexed
+		//! Use ModifyAssetEntry to change them
 		[[nodiscard]] Optional<DatabaseEntry*> GetAssetEntry(const Guid assetGuid) LIFETIME_BOUND
 		{
 			const decltype(m_assetMap)::iterator it = m_assetMap.Find(assetGuid);
 			return Optional<DatabaseEntry*>(&it->second, it != m_assetMap.end());
 		}
 
+		//! Calls the callback with the entry, keeping the secondary indices up to date with changes to its asset type, component type or tags
+		//! Returns false if the asset is not registered
+		template<typename Callback>
+		bool ModifyAssetEntry(const Guid assetGuid, Callback&& callback)
+		{
+			const decltype(m_assetMap)::iterator it = m_assetMap.Find(assetGuid);
+			if (it == m_assetMap.end())
+			{
+				return false;
+			}
+
+			RemoveFromIndices(assetGuid, it->second);
+			callback(it->second);
+			AddToIndices(assetGuid, it->second);
+			return true;
+		}
+
+		//! Rebuilds the secondary indices from scratch, for when indexed data of many entries was changed in place via IterateAssets
+		void RebuildIndices();
+
 		[[nodiscard]] uint32 GetAssetCount() const
 		{
 			return m_assetMap.GetSize();
@@ -128,6 +176,7 @@ namespace ngine::Asset
 			return m_importedAssets.GetSize();
 		}
 
+		//! Entries must not change their indexed data without calling RebuildIndices afterwards, see GetAssetEntry
 		template<typename Callback>
 		void IterateAssets(Callback&& callback)
 		{
@@ -152,17 +201,15 @@ namespace ngine::Asset
 			}
 		}
 
+		//! The following queries use secondary indices, so they only visit the matching assets
 		template<typename Callback>
 		void IterateAssetsOfAssetType(Callback&& callback, const ArrayView<const TypeGuid> typeGuids)
 		{
-			for (auto& pair : m_assetMap)
+			for (const TypeGuid typeGuid : typeGuids)
 			{
-				if (typeGuids.Contains(pair.second.m_assetTypeGuid))
+				if (IterateIndexedAssets(m_assetTypeIndex, typeGuid, callback) == Memory::CallbackResult::Break)
 				{
-					if (callback(pair.first, pair.second) == Memory::CallbackResult::Break)
-					{
-						break;
-					}
+					break;
 				}
 			}
 		}
@@ -170,48 +217,58 @@ namespace ngine::Asset
 		template<typename Callback>
 		void IterateAssetsOfAssetType(Callback&& callback, const TypeGuid typeGuid) const
 		{
-			for (auto& pair : m_assetMap)
-			{
-				if (typeGuid == pair.second.m_assetTypeGuid)
-				{
-					if (callback(pair.first, pair.second) == Memory::CallbackResult::Break)
-					{
-						break;
-					}
-				}
-			}
+			IterateIndexedAssets(m_assetTypeIndex, typeGuid, callback);
 		}
 
 		template<typename Callback>
 		void IterateAssetsOfAssetType(Callback&& callback, const TypeGuid typeGuid)
 		{
-			for (auto& pair : m_assetMap)
-			{
-				if (typeGuid == pair.second.m_assetTypeGuid)
-				{
-					if (callback(pair.first, pair.second) == Memory::CallbackResult::Break)
-					{
-						break;
-					}
-				}
-			}
+			IterateIndexedAssets(m_assetTypeIndex, typeGuid, callback);
 		}
 
 		template<typename Callback>
 		void IterateAssetsOfComponentType(Callback&& callback, const ArrayView<const Guid> typeGuids)
 		{
-			for (auto& pair : m_assetMap)
+			for (const Guid typeGuid : typeGuids)
 			{
-				if (typeGuids.Contains(pair.second.m_componentTypeGuid))
+				if (IterateIndexedAssets(m_componentTypeIndex, typeGuid, callback) == Memory::CallbackResult::Break)
 				{
-					if (callback(pair.first, pair.second) == Memory::CallbackResult::Break)
-					{
-						break;
-					}
+					break;
 				}
 			}
 		}
 
+		template<typename Callback>
+		void IterateAssetsOfComponentType(Callback&& callback, const Guid typeGuid) const
+		{
+			IterateIndexedAssets(m_componentTypeIndex, typeGuid, callback);
+		}
+
+		template<typename Callback>
+		void IterateAssetsWithTag(Callback&& callback, const Tag::Guid tagGuid) const
+		{
+			IterateIndexedAssets(m_tagIndex, tagGuid, callback);
+		}
+
+		template<typename Callback>
+		void IterateAssetsWithTag(Callback&& callback, const Tag::Guid tagGuid)
+		{
+			IterateIndexedAssets(m_tagIndex, tagGuid, callback);
+		}
+
+		[[nodiscard]] uint32 GetAssetCountOfAssetType(const TypeGuid typeGuid) const
+		{
+			return GetIndexedAssetCount(m_assetTypeIndex, typeGuid);
+		}
+		[[nodiscard]] uint32 GetAssetCountOfComponentType(const Guid typeGuid) const
+		{
+			return GetIndexedAssetCount(m_componentTypeIndex, typeGuid);
+		}
+		[[nodiscard]] uint32 GetAssetCountWithTag(const Tag::Guid tagGuid) const
+		{
+			return GetIndexedAssetCount(m_tagIndex, tagGuid);
+		}
+
 		template<typename Callback>
 		void IterateImportedAssets(Callback&& callback) const
 		{
@@ -235,9 +292,80 @@ namespace ngine::Asset
 		bool Serialize(const Serialization::Reader reader, const IO::PathView prefix);
 		bool Serialize(Serialization::Writer writer) const;
 		bool Serialize(Serialization::Writer writer, const IO::PathView rootDirectory) const;
+	protected:
+		//! Adds or replaces an entry, keeping the secondary indices up to date
+		DatabaseEntry& EmplaceEntry(const Guid assetGuid, DatabaseEntry&& entry);
+		void ClearEntries();
+		void AddToIndices(const Guid assetGuid, const DatabaseEntry& entry);
+		void RemoveFromIndices(const Guid assetGuid, const DatabaseEntry& entry);
+
+		template<typename Callback>
+		Memory::CallbackResult IterateIndexedAssets(const Internal::AssetIndex& index, const Guid key, Callback& callback) const
+		{
+			const Internal::AssetIndex::const_iterator indexIt = index.Find(key);
+			if (indexIt != index.end())
+			{
+				for (const Guid assetGuid : indexIt->second)
+				{
+					const decltype(m_assetMap)::const_iterator it = m_assetMap.Find(assetGuid);
+					Assert(it != m_assetMap.end());
+					if (it == m_assetMap.end())
+					{
+						// Indices out of sync with the entries, never hand out the end iterator
+						continue;
+					}
+					if (callback(it->first, it->second) == Memory::CallbackResult::Break)
+					{
+						return Memory::CallbackResult::Break;
+					}
+				}
+			}
+			return Memory::CallbackResult::Continue;
+		}
+
+		template<typename Callback>
+		Memory::CallbackResult IterateIndexedAssets(const Internal::AssetIndex& index, const Guid key, Callback& callback)
+		{
+			const Internal::AssetIndex::const_iterator indexIt = index.Find(key);
+			if (indexIt != index.end())
+			{
+				for (const Guid assetGuid : indexIt->second)
+				{
+					const decltype(m_assetMap)::iterator it = m_assetMap.Find(assetGuid);
+					Assert(it != m_assetMap.end());
+					if (it == m_assetMap.end())
+					{
+						// Indices out of sync with the entries, never hand out the end iterator
+						continue;
+					}
+					if (callback(it->first, it->second) == Memory::CallbackResult::Break)
+					{
+						return Memory::CallbackResult::Break;
+					}
+				}
+			}
+			return Memory::CallbackResult::Continue;
+		}
+
+		[[nodiscard]] static uint32 GetIndexedAssetCount(const Internal::AssetIndex& index, const Guid key)
+		{
+			const Internal::AssetIndex::const_iterator indexIt = index.Find(key);
+			return indexIt != index.end() ? indexIt->second.GetSize() : 0;
+		}
+
+		[[nodiscard]] bool Generate(const EngineInfo& engine, const Optional<DatabaseStamps*> pStamps);
+		[[nodiscard]] bool Generate(const ProjectInfo& project, const Optional<DatabaseStamps*> pStamps);
+		[[nodiscard]] bool Generate(const PluginInfo& plugin, const Optional<DatabaseStamps*> pStamps);
+		[[nodiscard]] bool ScanAssetsInDirectory(
+			const IO::ConstZeroTerminatedPathView directory, const IO::PathView databaseRootDirectory, const Optional<DatabaseStamps*> pStamps
+		);
 	protected:
 		Guid m_guid = Guid::Generate();
 		Internal::AssetEntryMap m_assetMap;
 		Internal::AssetSet m_importedAssets;
+
+		Internal::AssetIndex m_assetTypeIndex;
+		Internal::AssetIndex m_componentTypeIndex;
+		Internal::AssetIndex m_tagIndex;
 	};
 }
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Common/IO/Path.h>
+
+namespace ngine::IO
+{
+	struct FileChangeListener;
+}
+
+namespace ngine::Asset
+{
+	struct Database;
+	struct DatabaseStamps;
+
+	//! Keeps a database and its stamps up to date with the changes reported by an IO::FileChangeListener
+	//! Changes are applied from the listener's callbacks, so the database must not be accessed concurrently with them.
+	//! Changes a listener does not report, such as in subdirectories on platforms without recursive monitoring,
+	//! are still picked up by the next Database::UpdateAllAssetsInDirectory.
+	struct DatabaseMonitor
+	{
+		DatabaseMonitor(Database& database, DatabaseStamps& stamps, const IO::PathView databaseRootDirectory);
+		DatabaseMonitor(const DatabaseMonitor&) = delete;
+		DatabaseMonitor(DatabaseMonitor&&) = delete;
+		DatabaseMonitor& operator=(const DatabaseMonitor&) = delete;
+		DatabaseMonitor& operator=(DatabaseMonitor&&) = delete;
+
+		//! Starts applying the changes in the directory, the monitor must outlive the listener
+		void MonitorDirectory(IO::FileChangeListener& fileChangeListener, const IO::Path& directory);
+	protected:
+		void OnChanged(const IO::PathView directoryPath, const IO::PathView relativeChangedPath);
+	protected:
+		Database& m_database;
+		DatabaseStamps& m_stamps;
+		IO::Path m_databaseRootDirectory;
+	};
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <Common/Guid.h>
+#include <Common/IO/Path.h>
+#include <Common/Time/Timestamp.h>
+#include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Asset
+{
+	//! Modification times of the directories and asset metadata files a database was generated from
+	//! Stored next to the database file, so that Database::UpdateAllAssetsInDirectory only has to rescan what changed since.
+	//! Directories are only listed again when their own modification time changed, which happens when entries are added, removed or renamed.
+	//! Files are parsed again when their modification time changed.
+	struct DatabaseStamps
+	{
+		inline static constexpr IO::PathView FileExtension = MAKE_PATH(".nassetdbstamps");
+
+		struct FileStamp
+		{
+			Time::Timestamp m_modifiedTime;
+			Guid m_assetGuid;
+		};
+
+		struct DirectoryStamp
+		{
+			Time::Timestamp m_modifiedTime;
+			//! Names of the asset metadata files directly in the directory
+			Vector<IO::Path> m_fileNames;
+			Vector<IO::Path> m_subdirectoryNames;
+		};
+
+		using FileMap = UnorderedMap<IO::Path, FileStamp, IO::Path::Hash>;
+		using DirectoryMap = UnorderedMap<IO::Path, DirectoryStamp, IO::Path::Hash>;
+
+		[[nodiscard]] static IO::Path GetFilePath(const IO::PathView databaseFile)
+		{
+			return IO::Path::Merge(databaseFile, FileExtension);
+		}
+
+		//! Loads the stamps stored next to the specified database file
+		bool Load(const IO::PathView databaseFile);
+		//! Saves the stamps next to the specified database file, should be called whenever the database itself is saved
+		[[nodiscard]] bool Save(const IO::PathView databaseFile) const;
+
+		void Clear()
+		{
+			m_files.Clear();
+			m_directories.Clear();
+			m_updateTime = {};
+		}
+
+		//! Starts a new update, returning the time the previous update started
+		[[nodiscard]] Time::Timestamp StartUpdate()
+		{
+			const Time::Timestamp previousUpdateTime = m_updateTime;
+			m_updateTime = Time::Timestamp::GetCurrent();
+			return previousUpdateTime;
+		}
+
+		//! Checks whether a recorded modification time still matches the current one
+		//! Modification times only have a precision of seconds, so changes made in the same second as the previous update could be missed.
+		//! Such stamps are never trusted and the file or directory is scanned again.
+		[[nodiscard]] static bool
+		IsUnchanged(const Time::Timestamp recordedTime, const Time::Timestamp currentTime, const Time::Timestamp previousUpdateTime)
+		{
+			return recordedTime.IsValid() && recordedTime == currentTime && currentTime.GetSeconds() < previousUpdateTime.GetSeconds();
+		}
+
+		bool Serialize(const Serialization::Reader reader, const IO::PathView prefix);
+		bool Serialize(Serialization::Writer writer, const IO::PathView rootDirectory) const;
+
+		FileMap m_files;
+		DirectoryMap m_directories;
+		Time::Timestamp m_updateTime;
+	};
+}
@@ -16,6 +16,9 @@
 #elif PLATFORM_EMSCRIPTEN
 #include <Common/Threading/ForwardDeclarations/WebWorkerIdentifier.h>
 #include <Common/Storage/Identifier.h>
+#elif PLATFORM_LINUX && __has_include(<linux/io_uring.h>)
+#define USE_IO_URING 1
+#include <sys/uio.h>
 #elif PLATFORM_POSIX && !PLATFORM_ANDROID
 #include <aio.h>
 #endif
@@ -26,6 +29,9 @@ namespace ngine::IO
 	{
 #if USE_POSIX_ASYNC_IO || USE_APPLE_ASYNC_IO || PLATFORM_WINDOWS
 		inline static constexpr uint32 MaximumConcurrentRequestCount = 64;
+#elif USE_IO_URING
+		//! Matches the submission ring size, so a started request always has a free submission entry
+		inline static constexpr uint32 MaximumConcurrentRequestCount = 256;
 #elif PLATFORM_EMSCRIPTEN
 		inline static constexpr uint32 MaximumConcurrentRequestCount = 12;
 #endif
@@ -40,6 +46,10 @@ namespace ngine::IO
 		~AsyncLoadFromDiskJob();
 
 		virtual Result OnExecute(Threading::JobRunnerThread&) override;
+#if USE_IO_URING
+		virtual void OnAwaitExternalFinish(Threading::JobRunnerThread& thread) override;
+		void OnReadCompleted(const int32 result);
+#endif
 #if STAGE_DEPENDENCY_PROFILING
 		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
 		{
@@ -76,6 +86,12 @@ namespace ngine::IO
 #elif USE_POSIX_ASYNC_IO
 		int m_fileDescriptor{-1};
 		aiocb m_aiocb;
+#elif USE_IO_URING
+		int m_fileDescriptor{-1};
+		bool m_isDirectIO{false};
+		int32 m_readResult{0};
+		size m_currentTargetOffset{0};
+		iovec m_readVector;
 #elif PLATFORM_EMSCRIPTEN
 		WebWorkerIdentifier m_webWorkerIdentifier;
 		size m_currentTargetOffset{0};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <Common/Threading/Jobs/CoroutineJob.h>
+
+#if HAS_COROUTINE_JOBS
+#include <Common/IO/AsyncLoadFromDiskJob.h>
+#include <Common/Memory/Containers/ByteView.h>
+
+namespace ngine::IO
+{
+	namespace Internal
+	{
+		struct LoadFromDiskAwaiter
+		{
+			LoadFromDiskAwaiter(
+				const IO::PathView path, const ByteView target, const Math::Range<size> dataRange, const Threading::JobPriority priority
+			)
+				: m_path(path)
+				, m_target(target)
+				, m_dataRange(dataRange)
+				, m_priority(priority)
+			{
+			}
+			LoadFromDiskAwaiter(const LoadFromDiskAwaiter&) = delete;
+			LoadFromDiskAwaiter& operator=(const LoadFromDiskAwaiter&) = delete;
+			LoadFromDiskAwaiter(LoadFromDiskAwaiter&&) = delete;
+			LoadFromDiskAwaiter& operator=(LoadFromDiskAwaiter&&) = delete;
+
+			[[nodiscard]] bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			void await_suspend(const Threading::CoroutineJob::Handle handle)
+			{
+				Threading::CoroutineJob::promise_type& promise = handle.promise();
+				promise.SetResumePriority(m_priority);
+				m_resumeStage.m_pPromise = &promise;
+
+				Threading::Job* pLoadJob = CreateAsyncLoadFromDiskJob(
+					m_path,
+					m_priority,
+					[this](const ConstByteView data)
+					{
+						m_data = data;
+					},
+					m_target,
+					m_dataRange
+				);
+				// The load job deletes itself once finished, which unlinks the resume stage
+				pLoadJob->AddSubsequentStage(m_resumeStage);
+				pLoadJob->Queue(*Threading::JobRunnerThread::GetCurrent());
+			}
+
+			//! Returns the loaded part of the target, or an empty view if loading failed
+			[[nodiscard]] ConstByteView await_resume() const noexcept
+			{
+				return m_data;
+			}
+		protected:
+			IO::PathView m_path;
+			ByteView m_target;
+			Math::Range<size> m_dataRange;
+			Threading::JobPriority m_priority;
+			ConstByteView m_data;
+			Threading::Internal::CoroutineResumeStage m_resumeStage;
+		};
+	}
+
+	//! Loads a file into the target and suspends the coroutine until loading finished, resuming with the specified priority
+	//! The target must stay valid until the coroutine resumed
+	[[nodiscard]] inline Internal::LoadFromDiskAwaiter AwaitLoadFromDisk(
+		const IO::PathView path,
+		const ByteView target,
+		const Threading::JobPriority priority,
+		const Math::Range<size> dataRange = Math::Range<size>::MakeStartToEnd(0ull, Math::NumericLimits<size>::Max - 1)
+	)
+	{
+		Assert(target.HasElements(), "Awaited loads must provide a target, the job's own buffer is released before resuming");
+		return Internal::LoadFromDiskAwaiter{path, target, dataRange, priority};
+	}
+}
+#endif
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <Common/Threading/Jobs/Job.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/IO/Path.h>
+#include <Common/IO/AsyncLoadCallback.h>
+#include <Common/Function/Function.h>
+#include <Common/Memory/Containers/ByteView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Math/Range.h>
+
+namespace ngine::IO
+{
+	//! Collects ranged disk loads and issues them as fewer, larger reads
+	//! Pending loads are sorted by file and offset, adjacent or overlapping ranges are merged into a single read
+	//! The result of a merged read is scattered into each load's target
+	//! Reads are issued in priority order, each using the most urgent priority of the loads it serves
+	struct CoalescedLoadScheduler final : public Threading::Job
+	{
+		//! Largest gap between two ranges that is read through instead of issuing a separate read
+		inline static constexpr size MaximumMergeGap = 16 * 1024;
+		//! Merged reads are not extended beyond this size, limiting the temporary buffer
+		inline static constexpr size MaximumMergedReadSize = 4 * 1024 * 1024;
+
+		struct PendingLoad
+		{
+			IO::Path m_path;
+			AsyncLoadCallback m_callback;
+			ByteView m_target;
+			Math::Range<size> m_dataRange;
+			Priority m_priority;
+		};
+
+		//! A single read serving one or more consecutive pending loads
+		struct MergedRead
+		{
+			Math::Range<size> m_dataRange;
+			uint32 m_firstLoadIndex;
+			uint32 m_loadCount;
+			Priority m_priority;
+		};
+
+		CoalescedLoadScheduler();
+
+		//! Queues a ranged load, the callback receives the loaded part of the range or an empty view on failure
+		//! Loads without a target receive a view that is only valid during the callback
+		//! Loads of whole files are issued as is, as their size isn't known up front
+		void Queue(
+			const IO::PathView path,
+			const Priority priority,
+			AsyncLoadCallback&& callback,
+			const ByteView target,
+			const Math::Range<size> dataRange
+		);
+
+		//! Sorts the loads by file and offset and groups them into merged reads, sorted by priority
+		static void PlanReads(const ArrayView<PendingLoad, uint32> loads, Vector<MergedRead, uint32>& readsOut);
+
+		virtual Result OnExecute(Threading::JobRunnerThread& thread) override;
+#if STAGE_DEPENDENCY_PROFILING
+		[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+		{
+			return "Coalesced Load Scheduler";
+		}
+#endif
+	protected:
+		Threading::Mutex m_pendingLoadsMutex;
+		Vector<PendingLoad, uint32> m_pendingLoads;
+	};
+
+	[[nodiscard]] CoalescedLoadScheduler& GetCoalescedLoadScheduler();
+
+	//! Queues a ranged load that may be merged with other pending loads of the same file, see CoalescedLoadScheduler
+	inline void QueueCoalescedLoadFromDisk(
+		const IO::PathView path,
+		const Threading::JobPriority priority,
+		AsyncLoadCallback&& callback,
+		const ByteView target,
+		const Math::Range<size> dataRange
+	)
+	{
+		GetCoalescedLoadScheduler().Queue(path, priority, Forward<AsyncLoadCallback>(callback), target, dataRange);
+	}
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <Common/Memory/Containers/ByteView.h>
+#include <Common/IO/ForwardDeclarations/ZeroTerminatedPathView.h>
+#include <Common/Platform/TrivialABI.h>
+#include <Common/Platform/LifetimeBound.h>
+
+namespace ngine::IO
+{
+	//! Read-only view of a file's contents mapped into memory
+	//! Lets parsers work on the file in place, without reading it into an intermediate buffer
+	//! Pages are loaded on demand by the OS and shared with the file cache
+	struct [[nodiscard]] TRIVIAL_ABI MappedFile
+	{
+		//! Hint for how the mapped contents will be accessed, allows the OS to tune read-ahead
+		enum class AccessPattern : uint8
+		{
+			Default,
+			//! Contents are read front to back, for example when parsing
+			Sequential,
+			//! Contents are accessed in an unpredictable order, for example when looking up database entries
+			Random
+		};
+
+		MappedFile() = default;
+		MappedFile(const IO::ConstZeroTerminatedPathView filePath, const AccessPattern accessPattern = AccessPattern::Default);
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+		MappedFile(MappedFile&& other) noexcept
+			: m_pData(other.m_pData)
+			, m_size(other.m_size)
+			, m_isValid(other.m_isValid)
+		{
+			other.m_pData = nullptr;
+			other.m_size = 0;
+			other.m_isValid = false;
+		}
+		MappedFile& operator=(MappedFile&& other) noexcept
+		{
+			Close();
+			m_pData = other.m_pData;
+			m_size = other.m_size;
+			m_isValid = other.m_isValid;
+			other.m_pData = nullptr;
+			other.m_size = 0;
+			other.m_isValid = false;
+			return *this;
+		}
+		~MappedFile()
+		{
+			Close();
+		}
+
+		//! Whether the file was opened, empty files are valid but have no data
+		[[nodiscard]] bool IsValid() const
+		{
+			return m_isValid;
+		}
+
+		[[nodiscard]] ConstByteView GetView() const LIFETIME_BOUND
+		{
+			return ConstByteView{m_pData, m_size};
+		}
+		[[nodiscard]] size GetSize() const
+		{
+			return m_size;
+		}
+
+		//! Changes the access hint for the whole file
+		void Advise(const AccessPattern accessPattern) const
+		{
+			Advise(accessPattern, GetView());
+		}
+		//! Changes the access hint for a part of the mapping
+		void Advise(const AccessPattern accessPattern, const ConstByteView range) const;
+		//! Asks the OS to start loading a part of the mapping in the background
+		void Prefetch(const ConstByteView range) const;
+
+		void Close();
+	protected:
+		const ByteType* m_pData{nullptr};
+		size m_size{0};
+		bool m_isValid{false};
+	};
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <Common/Math/CoreNumericTypes.h>
+#include <Common/Memory/Containers/ForwardDeclarations/String.h>
+#include <Common/Threading/AtomicInteger.h>
+
+namespace ngine::Memory
+{
+	//! Low overhead heap profiler for finding which code paths and usage tags hold on to memory
+	//! Each thread samples an allocation whenever it has allocated roughly another sample interval worth of bytes
+	//! A sample holds the allocation's call stack and usage tag, and is dropped again when the allocation is freed
+	inline static constexpr size DefaultAllocationSampleInterval = 512 * 1024;
+
+	//! Starts sampling allocations of all threads, discarding samples from a previous run
+	void StartAllocationSampling(const size sampleInterval = DefaultAllocationSampleInterval) noexcept;
+	//! Stops taking new samples, samples of allocations that are still alive are kept for reporting
+	void StopAllocationSampling() noexcept;
+	[[nodiscard]] bool IsSamplingAllocations() noexcept;
+
+	//! Reports the sampled allocations that are still alive as text, with one line per usage tag and call stack:
+	//! <estimated bytes>\t<sample count>\t<tag>\t<frame>;<frame>;...
+	//! Frames use symbol names where available, otherwise module relative offsets
+	//! Lines are sorted by tag and call stack, so reports of different runs and builds can be diffed
+	[[nodiscard]] String GetAllocationSampleReport();
+
+	namespace Internal
+	{
+		//! Non-zero while sampling, checked by the allocation functions before calling SampleAllocation
+		extern Threading::Atomic<size> allocationSampleInterval;
+		//! Non-zero while any sampled allocation is alive, checked by the free functions before calling ReleaseAllocationSample
+		extern Threading::Atomic<uint32> liveAllocationSampleCount;
+
+		void SampleAllocation(void* pAllocation, const size allocationSize) noexcept;
+		//! Must be called before the allocation is returned to the allocator, so the address can't be reused by a new sample
+		void ReleaseAllocationSample(void* pAllocation) noexcept;
+	}
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <Common/Math/CoreNumericTypes.h>
+#include <Common/Memory/Align.h>
+#include <Common/Memory/Allocators/Allocate.h>
+#include <Common/Platform/Pure.h>
+#include <Common/Platform/Likely.h>
+#include <Common/Platform/ForceInline.h>
+#include <Common/Assert/Assert.h>
+
+namespace ngine::Memory
+{
+	//! Linear allocator serving allocations by bumping a pointer inside large blocks
+	//! Only the most recent allocation can be freed or grown in place
+	//! Other memory is released in bulk by resetting to a marker or resetting the whole arena
+	//! Blocks are kept after resetting, so steady state use doesn't touch the global allocator
+	//! Not thread safe, each thread has its own arena, see GetThreadArena
+	struct Arena
+	{
+		inline static constexpr size DefaultBlockSize = 64 * 1024;
+		inline static constexpr size DefaultAlignment = 2 * sizeof(void*);
+
+		struct Block;
+
+		//! Position in the arena that it can be reset to, releasing all allocations made after it
+		struct Marker
+		{
+			Block* m_pBlock;
+			uintptr m_position;
+		};
+
+		//! Resets the arena to the position it had when the scope was entered
+		struct [[nodiscard]] Scope
+		{
+			Scope(Arena& arena)
+				: m_arena(arena)
+				, m_marker(arena.GetMarker())
+			{
+			}
+			Scope(const Scope&) = delete;
+			Scope& operator=(const Scope&) = delete;
+			Scope(Scope&&) = delete;
+			Scope& operator=(Scope&&) = delete;
+			~Scope()
+			{
+				m_arena.ResetToMarker(m_marker);
+			}
+		protected:
+			Arena& m_arena;
+			Marker m_marker;
+		};
+
+		Arena(const size blockSize = DefaultBlockSize)
+			: m_blockSize(blockSize)
+		{
+		}
+		Arena(const Arena&) = delete;
+		Arena& operator=(const Arena&) = delete;
+		Arena(Arena&&) = delete;
+		Arena& operator=(Arena&&) = delete;
+		~Arena()
+		{
+			ReleaseMemory();
+		}
+
+		//! Arena of the calling thread, used by ArenaAllocator
+		[[nodiscard]] PURE_STATICS static Arena& GetThreadArena()
+		{
+			static thread_local Arena arena;
+			return arena;
+		}
+
+		[[nodiscard]] RESTRICTED_RETURN FORCE_INLINE void* Allocate(const size requestedSize, const size alignment = DefaultAlignment) noexcept
+		{
+			const uintptr position = Memory::Align(m_position, alignment);
+			if (LIKELY(position + requestedSize <= m_end && position != 0))
+			{
+				m_position = position + requestedSize;
+				m_lastAllocation = position;
+				return reinterpret_cast<void*>(position);
+			}
+			return AllocateFromNextBlock(requestedSize, alignment);
+		}
+
+		//! Grows or shrinks an allocation, in place if it was the most recent one
+		[[nodiscard]] RESTRICTED_RETURN void*
+		Reallocate(void* pData, const size previousSize, const size requestedSize, const size alignment = DefaultAlignment) noexcept;
+
+		//! Releases an allocation, memory is only reclaimed if it was the most recent allocation
+		FORCE_INLINE void Deallocate(void* pData) noexcept
+		{
+			if (reinterpret_cast<uintptr>(pData) == m_lastAllocation)
+			{
+				m_position = m_lastAllocation;
+				m_lastAllocation = 0;
+			}
+		}
+
+		[[nodiscard]] PURE_STATICS Marker GetMarker() const
+		{
+			return Marker{m_pCurrentBlock, m_position};
+		}
+		//! Releases all allocations made after the marker was taken
+		void ResetToMarker(const Marker marker) noexcept;
+		//! Releases all allocations, keeping the blocks for reuse
+		void Reset() noexcept
+		{
+			ResetToMarker(Marker{nullptr, 0});
+		}
+		//! Releases all allocations and returns the blocks to the global allocator
+		void ReleaseMemory() noexcept;
+
+		//! Whether the pointer was allocated from this arena and is still valid
+		[[nodiscard]] PURE_STATICS bool Contains(const void* pData) const;
+		//! Total size of the blocks owned by the arena, including blocks kept for reuse
+		[[nodiscard]] PURE_STATICS size GetReservedSize() const;
+	protected:
+		[[nodiscard]] RESTRICTED_RETURN void* AllocateFromNextBlock(const size requestedSize, const size alignment) noexcept;
+	protected:
+		size m_blockSize;
+		Block* m_pFirstBlock{nullptr};
+		Block* m_pCurrentBlock{nullptr};
+		uintptr m_position{0};
+		uintptr m_end{0};
+		uintptr m_lastAllocation{0};
+	};
+}
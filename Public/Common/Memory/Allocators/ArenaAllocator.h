@@ -0,0 +1,156 @@
+#pragma once
+
+#include <Common/Platform/LifetimeBound.h>
+#include <Common/Platform/Pure.h>
+#include <Common/Memory/New.h>
+#include <Common/Assert/Assert.h>
+#include <Common/Memory/Containers/ContainerCommon.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Math/NumericLimits.h>
+#include <Common/Memory/Allocators/Arena.h>
+#include <Common/TypeTraits/IsConst.h>
+
+#include "ForwardDeclarations/ArenaAllocator.h"
+
+namespace ngine::Memory
+{
+	//! Container allocator that takes memory from the arena of the thread creating the container
+	//! Intended for transient containers, such as per-frame scratch data, that are released in bulk by resetting the arena
+	//! The container must not outlive the arena scope it was created in, and must only grow on the creating thread
+	template<typename AllocatedType, typename SizeType_, typename IndexType_>
+	struct ArenaAllocator
+	{
+		using SizeType = SizeType_;
+		using DataSizeType = size;
+		using IndexType = IndexType_;
+		using View = ArrayView<AllocatedType, SizeType, IndexType, AllocatedType>;
+		using ConstView = ArrayView<const AllocatedType, SizeType, IndexType, const AllocatedType>;
+		using RestrictedView = typename View::RestrictedView;
+		using ConstRestrictedView = typename ConstView::ConstRestrictedView;
+		using ElementType = AllocatedType;
+
+		template<typename OtherType>
+		using Rebind = ArenaAllocator<OtherType, SizeType, IndexType>;
+
+		inline static constexpr bool IsWritable = !TypeTraits::IsConst<AllocatedType>;
+		inline static constexpr bool IsGrowable = true;
+
+		ArenaAllocator() = default;
+		template<typename CapacitySizeType>
+		inline ArenaAllocator(const ReserveType, const CapacitySizeType capacity) noexcept
+			: m_pData(static_cast<AllocatedType*>(m_pArena->Allocate(static_cast<size>(capacity) * sizeof(AllocatedType), Alignment)))
+			, m_capacity(static_cast<SizeType>(capacity))
+		{
+			Assert((size)capacity <= (size)GetTheoreticalCapacity(), "Tried to reserve past a container's theoretical capacity");
+		}
+		ArenaAllocator(const ArenaAllocator& other)
+			: m_pData(static_cast<AllocatedType*>(m_pArena->Allocate(other.m_capacity * sizeof(AllocatedType), Alignment)))
+			, m_capacity(other.m_capacity)
+		{
+			GetView().CopyFrom(other.GetView());
+		}
+		ArenaAllocator& operator=(const ArenaAllocator& other)
+		{
+			Free();
+			m_pData = static_cast<AllocatedType*>(m_pArena->Allocate(other.m_capacity * sizeof(AllocatedType), Alignment));
+			m_capacity = other.m_capacity;
+			GetView().CopyFrom(other.GetView());
+			return *this;
+		}
+		inline ArenaAllocator(ArenaAllocator&& other) noexcept
+			: m_pArena(other.m_pArena)
+			, m_pData(other.m_pData)
+			, m_capacity(other.m_capacity)
+		{
+			other.m_pData = nullptr;
+			other.m_capacity = 0;
+		}
+		inline ArenaAllocator& operator=(ArenaAllocator&& other) noexcept LIFETIME_BOUND
+		{
+			Free();
+
+			m_pArena = other.m_pArena;
+			m_capacity = other.m_capacity;
+			m_pData = other.m_pData;
+			other.m_pData = nullptr;
+			other.m_capacity = 0;
+			return *this;
+		}
+		inline ~ArenaAllocator()
+		{
+			Free();
+		}
+
+		[[nodiscard]] PURE_STATICS AllocatedType* GetData() noexcept LIFETIME_BOUND
+		{
+			return m_pData;
+		}
+		[[nodiscard]] PURE_STATICS const AllocatedType* GetData() const noexcept LIFETIME_BOUND
+		{
+			return m_pData;
+		}
+		[[nodiscard]] PURE_STATICS View GetView() noexcept LIFETIME_BOUND
+		{
+			return {GetData(), m_capacity};
+		}
+		[[nodiscard]] PURE_STATICS ConstView GetView() const noexcept LIFETIME_BOUND
+		{
+			return {GetData(), m_capacity};
+		}
+		[[nodiscard]] PURE_STATICS RestrictedView GetRestrictedView() noexcept LIFETIME_BOUND
+		{
+			return {GetData(), m_capacity};
+		}
+		[[nodiscard]] PURE_STATICS ConstRestrictedView GetRestrictedView() const noexcept LIFETIME_BOUND
+		{
+			return {GetData(), m_capacity};
+		}
+		[[nodiscard]] PURE_STATICS SizeType GetCapacity() const noexcept
+		{
+			return m_capacity;
+		}
+		[[nodiscard]] PURE_STATICS static constexpr SizeType GetTheoreticalCapacity() noexcept
+		{
+			return Math::NumericLimits<SizeType>::Max;
+		}
+		[[nodiscard]] PURE_STATICS bool HasAnyCapacity() const noexcept
+		{
+			return m_capacity != 0;
+		}
+
+		inline void Allocate(const SizeType newCapacity) noexcept
+		{
+			Assert(newCapacity != m_capacity);
+			Assert(m_pArena == &Arena::GetThreadArena(), "Arena containers can only grow on the thread that created them");
+			m_pData = static_cast<AllocatedType*>(
+				m_pArena->Reallocate(m_pData, m_capacity * sizeof(AllocatedType), newCapacity * sizeof(AllocatedType), Alignment)
+			);
+			m_capacity = newCapacity;
+		}
+
+		inline void Free() noexcept
+		{
+			if (m_pData != nullptr)
+			{
+				// Only the owning thread may reclaim, other threads leave the memory to the next reset
+				if (m_pArena == &Arena::GetThreadArena())
+				{
+					m_pArena->Deallocate(m_pData);
+				}
+				m_pData = nullptr;
+				m_capacity = 0;
+			}
+		}
+
+		[[nodiscard]] PURE_STATICS static constexpr bool IsDynamicallyStored()
+		{
+			return true;
+		}
+	protected:
+		inline static constexpr size Alignment = alignof(AllocatedType);
+
+		Arena* m_pArena = &Arena::GetThreadArena();
+		AllocatedType* m_pData = nullptr;
+		SizeType m_capacity = 0;
+	};
+}
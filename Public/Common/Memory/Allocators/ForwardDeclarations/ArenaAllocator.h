@@ -0,0 +1,9 @@
+#pragma once
+
+#include <Common/Math/CoreNumericTypes.h>
+
+namespace ngine::Memory
+{
+	template<typename AllocatedType, typename SizeType_, typename IndexType_ = SizeType_>
+	struct ArenaAllocator;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <Common/Math/CoreNumericTypes.h>
+#include <Common/Math/Log2.h>
+#include <Common/Math/Min.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/StringView.h>
+#include <Common/Platform/Pure.h>
+#include <Common/Platform/ForceInline.h>
+
+namespace ngine::Memory
+{
+	//! Allocations are bucketed by the power of two of their size, the last class holds everything larger
+	inline static constexpr uint8 SizeClassCount = 32;
+
+	//! Size class an allocation of the given size is counted in, class N holds sizes in [2^(N-1), 2^N)
+	[[nodiscard]] FORCE_INLINE PURE_NOSTATICS constexpr uint8 GetSizeClass(const size allocationSize) noexcept
+	{
+		return allocationSize == 0 ? 0 : (uint8)Math::Min(Math::Log2((uint64)allocationSize) + 1ull, uint64(SizeClassCount - 1));
+	}
+
+	//! Identifies the subsystem allocations are attributed to
+	using UsageTag = uint8;
+	inline static constexpr UsageTag UntaggedUsage = 0;
+	inline static constexpr uint16 MaximumUsageTagCount = 32;
+
+	//! Returns the tag registered under the name, registering it on first use
+	//! The name must remain valid for the lifetime of the process, typically a string literal
+	[[nodiscard]] UsageTag RegisterUsageTag(const ConstStringView name) noexcept;
+	[[nodiscard]] ConstStringView GetUsageTagName(const UsageTag tag) noexcept;
+
+	//! Sets the tag that allocations made by the calling thread are attributed to
+	void SetCurrentUsageTag(const UsageTag tag) noexcept;
+	[[nodiscard]] PURE_STATICS UsageTag GetCurrentUsageTag() noexcept;
+
+	//! Attributes allocations made by the calling thread to a tag until the scope ends
+	//! Scopes nest, restoring the enclosing scope's tag on destruction
+	//! Jobs capture the tag active when they were created and execute under it, see Threading::Job::GetUsageTag
+	struct [[nodiscard]] UsageTagScope
+	{
+		UsageTagScope(const UsageTag tag)
+			: m_previousTag(GetCurrentUsageTag())
+		{
+			SetCurrentUsageTag(tag);
+		}
+		UsageTagScope(const UsageTagScope&) = delete;
+		UsageTagScope& operator=(const UsageTagScope&) = delete;
+		UsageTagScope(UsageTagScope&&) = delete;
+		UsageTagScope& operator=(UsageTagScope&&) = delete;
+		~UsageTagScope()
+		{
+			SetCurrentUsageTag(m_previousTag);
+		}
+	protected:
+		UsageTag m_previousTag;
+	};
+
+	struct SizeClassUsage
+	{
+		size m_allocationCount{0};
+		size m_deallocationCount{0};
+	};
+
+	struct TagUsage
+	{
+		//! Total number of bytes ever allocated under this tag
+		size m_allocatedSize{0};
+		size m_allocationCount{0};
+	};
+
+	//! Snapshot of dynamic memory usage, aggregated from the per-thread counters on request
+	//! Only populated when memory usage tracking is enabled (profile builds)
+	struct UsageStatistics
+	{
+		size m_currentUsage{0};
+		//! Highest usage observed, see PeakUsagePrecision
+		size m_peakUsage{0};
+		size m_allocationCount{0};
+		size m_deallocationCount{0};
+		Array<SizeClassUsage, SizeClassCount> m_sizeClasses;
+		Array<TagUsage, MaximumUsageTagCount> m_tags;
+	};
+
+	//! Threads only publish their usage to the global peak once it changed by this much
+	//! The peak can therefore be under-reported by up to this amount per active thread
+	inline static constexpr size PeakUsagePrecision = 256 * 1024;
+
+	[[nodiscard]] UsageStatistics GetUsageStatistics() noexcept;
+	[[nodiscard]] PURE_STATICS size GetPeakDynamicMemoryUsage() noexcept;
+}
@@ -176,6 +176,19 @@ namespace ngine::Threading
 			return result;
 		}
 
+		[[nodiscard]] FORCE_INLINE RawBlockType LoadBlock(const BlockIndexType index) const
+		{
+			return BaseType::GetBlock(index).Load();
+		}
+		FORCE_INLINE bool CompareExchangeBlock(const BlockIndexType index, RawBlockType& expected, const RawBlockType desired)
+		{
+			return BaseType::GetBlock(index).CompareExchangeStrong(expected, desired);
+		}
+		FORCE_INLINE void SetBlock(const BlockIndexType index, const RawBlockType bits)
+		{
+			BaseType::GetBlock(index) |= bits;
+		}
+
 		[[nodiscard]] bool AreAnySet(const NonAtomicType& other) const
 		{
 			typename NonAtomicType::RawBlockType result = 0;
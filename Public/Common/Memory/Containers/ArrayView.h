@@ -29,6 +29,7 @@
 #include <Common/Memory/IsAligned.h>
 #include <Common/Memory/Containers/ForwardDeclarations/ArrayView.h>
 #include <Common/Memory/Containers/ForwardDeclarations/BitView.h>
+#include <Common/Memory/Containers/VectorizedSearch.h>
 #include <Common/Serialization/ForwardDeclarations/Reader.h>
 #include <Common/Serialization/ForwardDeclarations/Writer.h>
 #include <Common/Math/Min.h>
@@ -363,6 +364,16 @@ namespace ngine
 			typename = EnableIf<TypeTraits::IsEqualityComparable<const ElementType, const ComparableType>>>
 		[[nodiscard]] PURE_STATICS OptionalIteratorType Find(const ComparableType& element) const noexcept
 		{
+			if constexpr (Memory::VectorizedSearch::IsSupported<ContainedType, ComparableType>)
+			{
+				if (GetSize() >= Memory::VectorizedSearch::MinimumElementCount)
+				{
+					using SearchType = Memory::VectorizedSearch::SearchType<ContainedType>;
+					const size index = Memory::VectorizedSearch::FindFirst(GetData(), GetSize(), static_cast<SearchType>(element));
+					return OptionalIteratorType{begin() + index, end()};
+				}
+			}
+
 			StoredPointerType it = begin();
 			const StoredPointerType endIt = end();
 			for (; it != endIt; ++it)
@@ -385,6 +396,16 @@ namespace ngine
 			StoredPointerType it = end() - 1;
 			StoredPointerType lastIt = begin() - 1;
 
+			if constexpr (Memory::VectorizedSearch::IsSupported<ContainedType, ComparableType>)
+			{
+				if (GetSize() >= Memory::VectorizedSearch::MinimumElementCount)
+				{
+					using SearchType = Memory::VectorizedSearch::SearchType<ContainedType>;
+					const size index = Memory::VectorizedSearch::FindLast(GetData(), GetSize(), static_cast<SearchType>(element));
+					return OptionalIteratorType{index != GetSize() ? begin() + index : lastIt, lastIt};
+				}
+			}
+
 			for (; it != lastIt; --it)
 			{
 				if (*it == element)
@@ -409,24 +430,33 @@ namespace ngine
 		[[nodiscard]] PURE_STATICS constexpr View
 		FindFirstRange(const ArrayView<ElementType, OtherSizeType, OtherIndexType, OtherStoredType, OtherFlags> other) const
 		{
-			if (GetSize() < other.GetSize())
+			if (other.IsEmpty() || GetSize() < other.GetSize())
 			{
 				return {};
 			}
 
-			SizeType index = 0;
-			for (const ContainedType& element : *this)
+			if constexpr (Memory::VectorizedSearch::IsSupported<ContainedType, ElementType>)
 			{
-				if (element == other[index])
+				if (!IsConstantEvaluated() && GetSize() >= Memory::VectorizedSearch::MinimumElementCount)
 				{
-					if (++index == other.GetSize())
+					using SearchType = Memory::VectorizedSearch::SearchType<ContainedType>;
+					const size index =
+						Memory::VectorizedSearch::FindFirstRange<SearchType>(GetData(), GetSize(), other.GetData(), other.GetSize());
+					if (index == GetSize())
 					{
-						return {begin() + GetIteratorIndex(Memory::GetAddressOf(element)) - other.GetSize() + 1, other.GetSize()};
+						return {};
 					}
+					return {begin() + index, (SizeType)other.GetSize()};
 				}
-				else
+			}
+
+			const SizeType startCount = GetSize() - (SizeType)other.GetSize() + 1;
+			for (SizeType index = 0; index < startCount; ++index)
+			{
+				const View view{begin() + index, (SizeType)other.GetSize()};
+				if (view == other)
 				{
-					index = 0;
+					return view;
 				}
 			}
 
@@ -434,27 +464,36 @@ namespace ngine
 		}
 
 		template<typename ElementType, typename OtherSizeType, typename OtherIndexType, typename OtherStoredType, uint8 OtherFlags>
-		[[nodiscard]] FORCE_INLINE PURE_STATICS constexpr View
+		[[nodiscard]] PURE_STATICS constexpr View
 		FindLastRange(const ArrayView<ElementType, OtherSizeType, OtherIndexType, OtherStoredType, OtherFlags> other) const
 		{
-			if (GetSize() < other.GetSize())
+			if (other.IsEmpty() || GetSize() < other.GetSize())
 			{
 				return {};
 			}
 
-			StoredPointerType it = end() - 1;
-			StoredPointerType lastIt = Math::Max(begin() - 1, begin() - other.GetSize());
-
-			const ElementType& lastElement = other.GetLastElement();
-			for (; it != lastIt; --it)
+			if constexpr (Memory::VectorizedSearch::IsSupported<ContainedType, ElementType>)
 			{
-				if (*it == lastElement)
+				if (!IsConstantEvaluated() && GetSize() >= Memory::VectorizedSearch::MinimumElementCount)
 				{
-					View view{it - (other.GetSize() - 1), it + 1};
-					if (view == other)
+					using SearchType = Memory::VectorizedSearch::SearchType<ContainedType>;
+					const size index =
+						Memory::VectorizedSearch::FindLastRange<SearchType>(GetData(), GetSize(), other.GetData(), other.GetSize());
+					if (index == GetSize())
 					{
-						return view;
+						return {};
 					}
+					return {begin() + index, (SizeType)other.GetSize()};
+				}
+			}
+
+			for (SizeType index = GetSize() - (SizeType)other.GetSize() + 1; index > 0;)
+			{
+				--index;
+				const View view{begin() + index, (SizeType)other.GetSize()};
+				if (view == other)
+				{
+					return view;
 				}
 			}
 
@@ -472,15 +511,38 @@ namespace ngine
 		[[nodiscard]] PURE_STATICS bool
 		ContainsAny(const ArrayView<ElementType, OtherSizeType, OtherIndexType, OtherStoredType, OtherFlags> elements) const noexcept
 		{
-			for (const ElementType& element : elements)
+			return FindFirstOfAny(elements).IsValid();
+		}
+
+		//! Finds the first element that is equal to any of the specified elements
+		template<typename ElementType, typename OtherSizeType, typename OtherIndexType, typename OtherStoredType, uint8 OtherFlags>
+		[[nodiscard]] PURE_STATICS OptionalIteratorType
+		FindFirstOfAny(const ArrayView<ElementType, OtherSizeType, OtherIndexType, OtherStoredType, OtherFlags> elements) const noexcept
+		{
+			if constexpr (Memory::VectorizedSearch::IsSupported<ContainedType, ElementType> && sizeof(ContainedType) == 1)
 			{
-				if (Contains(element))
+				const size index = Memory::VectorizedSearch::FindFirstOfAny(
+					reinterpret_cast<const uint8*>(GetData()),
+					GetSize(),
+					reinterpret_cast<const uint8*>(elements.GetData()),
+					elements.GetSize()
+				);
+				return OptionalIteratorType{begin() + index, end()};
+			}
+			else
+			{
+				StoredPointerType it = begin();
+				const StoredPointerType endIt = end();
+				for (; it != endIt; ++it)
 				{
-					return true;
+					if (elements.Contains(*it))
+					{
+						return OptionalIteratorType{it, endIt};
+					}
 				}
-			}
 
-			return false;
+				return OptionalIteratorType(endIt, endIt);
+			}
 		}
 
 		template<typename Callback>
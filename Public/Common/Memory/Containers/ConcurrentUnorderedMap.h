@@ -0,0 +1,306 @@
+#pragma once
+
+#include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Memory/Forward.h>
+#include <Common/Memory/Move.h>
+#include <Common/Math/PowerOfTwo.h>
+#include <Common/Threading/Mutexes/SharedMutex.h>
+#include <Common/Threading/Mutexes/SharedLock.h>
+#include <Common/Threading/Mutexes/UniqueLock.h>
+#include <Common/TypeTraits/EnableIf.h>
+
+namespace ngine
+{
+	//! Hash map that can be read and written from any number of threads at once
+	//! Keys are spread over ShardCount independent maps that each have their own shared mutex and cache line.
+	//! Lookups only lock their shard for reading and writers only block the shard their key maps to, so unrelated keys don't contend.
+	//! Elements can be moved by a concurrent insertion at any time,
+	//! so lookups copy values out or invoke a callback while the shard is locked.
+	template<
+		typename _KeyType,
+		typename _ValueType,
+		typename HashType = absl::Hash<_KeyType>,
+		typename EqualityType = Memory::Internal::DefaultEqualityCheck<_KeyType>,
+		uint32 ShardCount = 64>
+	struct ConcurrentUnorderedMap
+	{
+		static_assert(Math::IsPowerOfTwo(ShardCount), "Shard count must be a power of two");
+
+		using KeyType = _KeyType;
+		using ValueType = _ValueType;
+		using MapType = UnorderedMap<KeyType, ValueType, HashType, EqualityType>;
+
+		inline static constexpr bool IsTransparent = MapType::IsTransparent;
+
+		ConcurrentUnorderedMap() = default;
+		ConcurrentUnorderedMap(Memory::ReserveType, const uint32 size)
+		{
+			Reserve(size);
+		}
+		ConcurrentUnorderedMap(const ConcurrentUnorderedMap&) = delete;
+		ConcurrentUnorderedMap& operator=(const ConcurrentUnorderedMap&) = delete;
+		ConcurrentUnorderedMap(ConcurrentUnorderedMap&&) = delete;
+		ConcurrentUnorderedMap& operator=(ConcurrentUnorderedMap&&) = delete;
+
+		[[nodiscard]] bool Contains(const KeyType& key) const
+		{
+			return ContainsInternal(key);
+		}
+		template<typename KeyComparableType, bool Enable = IsTransparent, typename = EnableIf<Enable>>
+		[[nodiscard]] bool Contains(const KeyComparableType key) const
+		{
+			return ContainsInternal(key);
+		}
+
+		//! Returns a copy of the value stored for the key, or an invalid optional if there was none
+		[[nodiscard]] Optional<ValueType> Find(const KeyType& key) const
+		{
+			return FindInternal(key);
+		}
+		template<typename KeyComparableType, bool Enable = IsTransparent, typename = EnableIf<Enable>>
+		[[nodiscard]] Optional<ValueType> Find(const KeyComparableType key) const
+		{
+			return FindInternal(key);
+		}
+
+		//! Invokes the callback with the value stored for the key while its shard is locked for reading
+		//! @returns whether the key was found
+		template<typename Callback>
+		bool Visit(const KeyType& key, Callback&& callback) const
+		{
+			return VisitInternal(key, Forward<Callback>(callback));
+		}
+		template<typename KeyComparableType, typename Callback, bool Enable = IsTransparent, typename = EnableIf<Enable>>
+		bool Visit(const KeyComparableType key, Callback&& callback) const
+		{
+			return VisitInternal(key, Forward<Callback>(callback));
+		}
+
+		//! Invokes the callback with a mutable reference to the value stored for the key while its shard is locked for writing
+		//! @returns whether the key was found
+		template<typename Callback>
+		bool Modify(const KeyType& key, Callback&& callback)
+		{
+			return ModifyInternal(key, Forward<Callback>(callback));
+		}
+		template<typename KeyComparableType, typename Callback, bool Enable = IsTransparent, typename = EnableIf<Enable>>
+		bool Modify(const KeyComparableType key, Callback&& callback)
+		{
+			return ModifyInternal(key, Forward<Callback>(callback));
+		}
+
+		//! Emplaces a key and its value into the map if the key does not exist yet
+		//! Unlike UnorderedMap::Emplace an existing key is not an error, as several threads can race to register the same key.
+		//! @returns whether the key was inserted
+		template<typename KeyImplicitType, typename ValueImplicitType>
+		bool Emplace(KeyImplicitType&& keyArgument, ValueImplicitType&& value)
+		{
+			KeyType key(Forward<KeyImplicitType>(keyArgument));
+			Shard& shard = GetShard(key);
+			Threading::UniqueLock lock(shard.m_mutex);
+			if (shard.m_map.Contains(key))
+			{
+				return false;
+			}
+			shard.m_map.Emplace(Move(key), ValueType(Forward<ValueImplicitType>(value)));
+			return true;
+		}
+		//! Emplaces a key and its value into the map, replacing the value if the key already existed
+		template<typename KeyImplicitType, typename ValueImplicitType>
+		void EmplaceOrAssign(KeyImplicitType&& keyArgument, ValueImplicitType&& value)
+		{
+			KeyType key(Forward<KeyImplicitType>(keyArgument));
+			Shard& shard = GetShard(key);
+			Threading::UniqueLock lock(shard.m_mutex);
+			shard.m_map.EmplaceOrAssign(Move(key), ValueType(Forward<ValueImplicitType>(value)));
+		}
+
+		//! Returns a copy of the value stored for the key, emplacing the result of createValue first if the key did not exist
+		//! The shard is first only locked for reading, createValue is invoked at most once and only while the shard is locked for writing.
+		template<typename KeyImplicitType, typename CreateValueCallback>
+		ValueType FindOrEmplace(KeyImplicitType&& keyArgument, CreateValueCallback&& createValue)
+		{
+			KeyType key(Forward<KeyImplicitType>(keyArgument));
+			Shard& shard = GetShard(key);
+			{
+				Threading::SharedLock lock(shard.m_mutex);
+				const typename MapType::const_iterator it = shard.m_map.Find(key);
+				if (it != shard.m_map.end())
+				{
+					return it->second;
+				}
+			}
+
+			Threading::UniqueLock lock(shard.m_mutex);
+			typename MapType::iterator it = shard.m_map.Find(key);
+			if (it == shard.m_map.end())
+			{
+				// Another thread could have emplaced the key while no lock was held
+				it = shard.m_map.Emplace(Move(key), createValue());
+			}
+			return it->second;
+		}
+
+		//! Removes the key from the map
+		//! @returns whether the key existed
+		bool Remove(const KeyType& key)
+		{
+			return RemoveInternal(key);
+		}
+		template<typename KeyComparableType, bool Enable = IsTransparent, typename = EnableIf<Enable>>
+		bool Remove(const KeyComparableType key)
+		{
+			return RemoveInternal(key);
+		}
+
+		//! Invokes the callback with each key and value, locking one shard at a time for reading
+		//! Elements inserted or removed by other threads during the iteration may or may not be visited.
+		template<typename Callback>
+		void ForEach(Callback&& callback) const
+		{
+			for (const Shard& shard : m_shards)
+			{
+				Threading::SharedLock lock(shard.m_mutex);
+				for (const auto& pair : shard.m_map)
+				{
+					callback(pair.first, pair.second);
+				}
+			}
+		}
+
+		//! Returns the number of elements, which is only exact when no other thread is modifying the map
+		[[nodiscard]] uint32 GetSize() const
+		{
+			uint32 count = 0;
+			for (const Shard& shard : m_shards)
+			{
+				Threading::SharedLock lock(shard.m_mutex);
+				count += shard.m_map.GetSize();
+			}
+			return count;
+		}
+		[[nodiscard]] bool IsEmpty() const
+		{
+			for (const Shard& shard : m_shards)
+			{
+				Threading::SharedLock lock(shard.m_mutex);
+				if (shard.m_map.HasElements())
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		//! Reserves space for the specified number of elements, assuming they are evenly distributed over the shards
+		void Reserve(const uint32 size)
+		{
+			const uint32 shardSize = (size + ShardCount - 1) / ShardCount;
+			for (Shard& shard : m_shards)
+			{
+				Threading::UniqueLock lock(shard.m_mutex);
+				shard.m_map.Reserve(shardSize);
+			}
+		}
+
+		void Clear()
+		{
+			for (Shard& shard : m_shards)
+			{
+				Threading::UniqueLock lock(shard.m_mutex);
+				shard.m_map.Clear();
+			}
+		}
+	protected:
+		struct alignas(64) Shard
+		{
+			mutable Threading::SharedMutex m_mutex;
+			MapType m_map;
+		};
+
+		template<typename SearchedKeyType>
+		[[nodiscard]] static uint32 GetShardIndex(const SearchedKeyType& key)
+		{
+			// Mix the hash before selecting a shard, the maps index buckets by the low bits and not all hashes distribute the high bits
+			const uint64 keyHashValue = uint64(HashType{}(key));
+			return uint32((keyHashValue * 0x9E3779B97F4A7C15ull) >> 32) & (ShardCount - 1);
+		}
+		template<typename SearchedKeyType>
+		[[nodiscard]] Shard& GetShard(const SearchedKeyType& key)
+		{
+			return m_shards[GetShardIndex(key)];
+		}
+		template<typename SearchedKeyType>
+		[[nodiscard]] const Shard& GetShard(const SearchedKeyType& key) const
+		{
+			return m_shards[GetShardIndex(key)];
+		}
+
+		template<typename SearchedKeyType>
+		[[nodiscard]] bool ContainsInternal(const SearchedKeyType& key) const
+		{
+			const Shard& shard = GetShard(key);
+			Threading::SharedLock lock(shard.m_mutex);
+			return shard.m_map.Contains(key);
+		}
+
+		template<typename SearchedKeyType>
+		[[nodiscard]] Optional<ValueType> FindInternal(const SearchedKeyType& key) const
+		{
+			const Shard& shard = GetShard(key);
+			Threading::SharedLock lock(shard.m_mutex);
+			const typename MapType::const_iterator it = shard.m_map.Find(key);
+			if (it != shard.m_map.end())
+			{
+				return Optional<ValueType>(it->second);
+			}
+			return {};
+		}
+
+		template<typename SearchedKeyType, typename Callback>
+		bool VisitInternal(const SearchedKeyType& key, Callback&& callback) const
+		{
+			const Shard& shard = GetShard(key);
+			Threading::SharedLock lock(shard.m_mutex);
+			const typename MapType::const_iterator it = shard.m_map.Find(key);
+			if (it != shard.m_map.end())
+			{
+				callback(it->second);
+				return true;
+			}
+			return false;
+		}
+
+		template<typename SearchedKeyType, typename Callback>
+		bool ModifyInternal(const SearchedKeyType& key, Callback&& callback)
+		{
+			Shard& shard = GetShard(key);
+			Threading::UniqueLock lock(shard.m_mutex);
+			const typename MapType::iterator it = shard.m_map.Find(key);
+			if (it != shard.m_map.end())
+			{
+				callback(it->second);
+				return true;
+			}
+			return false;
+		}
+
+		template<typename SearchedKeyType>
+		bool RemoveInternal(const SearchedKeyType& key)
+		{
+			Shard& shard = GetShard(key);
+			Threading::UniqueLock lock(shard.m_mutex);
+			const typename MapType::iterator it = shard.m_map.Find(key);
+			if (it != shard.m_map.end())
+			{
+				shard.m_map.Remove(it);
+				return true;
+			}
+			return false;
+		}
+	protected:
+		Array<Shard, ShardCount> m_shards;
+	};
+}
@@ -87,5 +87,17 @@ namespace ngine::Memory
 				return leftType == rightType;
 			}
 		};
+
+		template<typename Type>
+		struct DefaultLessCheck
+		{
+			using is_transparent = void;
+
+			template<typename LeftType, typename RightType>
+			bool operator()(const LeftType& leftType, const RightType& rightType) const
+			{
+				return leftType < rightType;
+			}
+		};
 	}
 }
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <Common/Memory/Containers/FlatOrderedTable.h>
+#include <Common/Platform/TrivialABI.h>
+
+namespace ngine
+{
+	namespace Internal
+	{
+		template<typename KeyType, typename ValueType>
+		struct TRIVIAL_ABI FlatOrderedMapPair
+		{
+			KeyType first;
+			ValueType second;
+		};
+
+		template<typename Key, typename Value>
+		struct FlatOrderedMapDetail
+		{
+			[[nodiscard]] static constexpr const Key& GetKey(const FlatOrderedMapPair<Key, Value>& keyValuePair)
+			{
+				return keyValuePair.first;
+			}
+		};
+	}
+
+	//! Ordered map stored as a sorted vector of key value pairs, an alternative to OrderedMap for data that is mostly read
+	//! Keys must not be modified through iterators, as that would break the ordering.
+	template<typename _KeyType, typename _ValueType, typename Compare = Memory::Internal::DefaultLessCheck<_KeyType>>
+	struct FlatOrderedMap : public TFlatOrderedTable<
+														_KeyType,
+														Internal::FlatOrderedMapPair<_KeyType, _ValueType>,
+														Internal::FlatOrderedMapDetail<_KeyType, _ValueType>,
+														Compare>
+	{
+		using BaseType = TFlatOrderedTable<
+			_KeyType,
+			Internal::FlatOrderedMapPair<_KeyType, _ValueType>,
+			Internal::FlatOrderedMapDetail<_KeyType, _ValueType>,
+			Compare>;
+		using KeyType = _KeyType;
+		using ValueType = _ValueType;
+		using PairType = Internal::FlatOrderedMapPair<KeyType, ValueType>;
+		using typename BaseType::iterator;
+		using typename BaseType::SizeType;
+		using BaseType::BaseType;
+
+		//! Emplaces a key and its value at its sorted position, returns the existing element if the key was already present
+		FORCE_INLINE iterator Emplace(KeyType&& key, ValueType&& value) LIFETIME_BOUND
+		{
+			bool wasInserted;
+			const SizeType index = BaseType::EmplaceSorted(
+				key,
+				wasInserted,
+				[&key, &value]()
+				{
+					return PairType{Forward<KeyType>(key), Forward<ValueType>(value)};
+				}
+			);
+			return BaseType::begin() + index;
+		}
+		template<typename KeyImplicitType, typename ValueImplicitType>
+		FORCE_INLINE iterator Emplace(KeyImplicitType&& keyArgument, ValueImplicitType&& value) LIFETIME_BOUND
+		{
+			KeyType key(Forward<KeyImplicitType>(keyArgument));
+			bool wasInserted;
+			const SizeType index = BaseType::EmplaceSorted(
+				key,
+				wasInserted,
+				[&key, &value]()
+				{
+					return PairType{Move(key), ValueType(Forward<ValueImplicitType>(value))};
+				}
+			);
+			return BaseType::begin() + index;
+		}
+		FORCE_INLINE iterator Insert(const KeyType key, const ValueType value) LIFETIME_BOUND
+		{
+			bool wasInserted;
+			const SizeType index = BaseType::EmplaceSorted(
+				key,
+				wasInserted,
+				[&key, &value]()
+				{
+					return PairType{key, value};
+				}
+			);
+			return BaseType::begin() + index;
+		}
+		//! Emplaces a key and its value, replacing the value if the key already existed
+		FORCE_INLINE iterator EmplaceOrAssign(KeyType&& key, ValueType&& value) LIFETIME_BOUND
+		{
+			bool wasInserted;
+			const SizeType index = BaseType::EmplaceSorted(
+				key,
+				wasInserted,
+				[&key, &value]()
+				{
+					return PairType{Forward<KeyType>(key), Forward<ValueType>(value)};
+				}
+			);
+			const iterator it = BaseType::begin() + index;
+			if (!wasInserted)
+			{
+				it->second = Forward<ValueType>(value);
+			}
+			return it;
+		}
+	};
+}
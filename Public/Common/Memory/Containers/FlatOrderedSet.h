@@ -0,0 +1,58 @@
+#pragma once
+
+#include <Common/Memory/Containers/FlatOrderedTable.h>
+
+namespace ngine
+{
+	namespace Internal
+	{
+		template<typename Key>
+		struct FlatOrderedSetDetail
+		{
+			[[nodiscard]] static constexpr const Key& GetKey(const Key& key)
+			{
+				return key;
+			}
+		};
+	}
+
+	//! Ordered set stored as a sorted vector, an alternative to OrderedSet for data that is mostly read
+	//! Keys must not be modified through iterators, as that would break the ordering.
+	template<typename _KeyType, typename Compare = Memory::Internal::DefaultLessCheck<_KeyType>>
+	struct FlatOrderedSet : public TFlatOrderedTable<_KeyType, _KeyType, Internal::FlatOrderedSetDetail<_KeyType>, Compare>
+	{
+		using BaseType = TFlatOrderedTable<_KeyType, _KeyType, Internal::FlatOrderedSetDetail<_KeyType>, Compare>;
+		using KeyType = _KeyType;
+		using typename BaseType::iterator;
+		using typename BaseType::SizeType;
+		using BaseType::BaseType;
+
+		//! Inserts the key at its sorted position, returns the existing element if the key was already present
+		FORCE_INLINE iterator Emplace(KeyType&& key) LIFETIME_BOUND
+		{
+			bool wasInserted;
+			const SizeType index = BaseType::EmplaceSorted(
+				key,
+				wasInserted,
+				[&key]()
+				{
+					return Forward<KeyType>(key);
+				}
+			);
+			return BaseType::begin() + index;
+		}
+		FORCE_INLINE iterator Insert(const KeyType key) LIFETIME_BOUND
+		{
+			bool wasInserted;
+			const SizeType index = BaseType::EmplaceSorted(
+				key,
+				wasInserted,
+				[&key]()
+				{
+					return key;
+				}
+			);
+			return BaseType::begin() + index;
+		}
+	};
+}
@@ -0,0 +1,270 @@
+#pragma once
+
+#include <Common/Algorithms/Sort.h>
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/ContainerCommon.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Forward.h>
+#include <Common/Memory/Move.h>
+#include <Common/Memory/Prefetch.h>
+#include <Common/Platform/ForceInline.h>
+#include <Common/Platform/LifetimeBound.h>
+#include <Common/Platform/Pure.h>
+#include <Common/TypeTraits/Void.h>
+
+namespace ngine
+{
+	//! Ordered container storing its elements sorted by key in a single contiguous vector
+	//! Meant for mostly-read data: lookups are a branchless binary search over contiguous memory, while inserting or removing a single
+	//! element shifts all elements after it. Bulk insertions append and sort the new elements first, then merge them in once.
+	//! Elements are relocated by insertions and removals, so iterators are invalidated by any modification.
+	template<typename Key, typename Element, typename FlatOrderedTableDetail, typename Compare>
+	struct TFlatOrderedTable
+	{
+		using KeyType = Key;
+		using ElementType = Element;
+		using SizeType = uint32;
+		using ContainerType = Vector<ElementType, SizeType>;
+		using View = ArrayView<ElementType, SizeType>;
+		using ConstView = ArrayView<const ElementType, SizeType>;
+
+		using iterator = typename ContainerType::IteratorType;
+		using const_iterator = typename ContainerType::ConstIteratorType;
+
+		TFlatOrderedTable() = default;
+		TFlatOrderedTable(const TFlatOrderedTable&) = default;
+		TFlatOrderedTable& operator=(const TFlatOrderedTable&) = default;
+		TFlatOrderedTable(TFlatOrderedTable&&) = default;
+		TFlatOrderedTable& operator=(TFlatOrderedTable&&) = default;
+		TFlatOrderedTable(Memory::ReserveType, const SizeType size)
+			: m_elements(Memory::Reserve, size)
+		{
+		}
+		~TFlatOrderedTable() = default;
+
+		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator begin() LIFETIME_BOUND
+		{
+			return m_elements.begin();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator begin() const LIFETIME_BOUND
+		{
+			return m_elements.begin();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator cbegin() const LIFETIME_BOUND
+		{
+			return m_elements.begin();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator end() LIFETIME_BOUND
+		{
+			return m_elements.end();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator end() const LIFETIME_BOUND
+		{
+			return m_elements.end();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator cend() const LIFETIME_BOUND
+		{
+			return m_elements.end();
+		}
+
+		//! Gets all elements, sorted by key
+		[[nodiscard]] FORCE_INLINE PURE_STATICS ConstView GetView() const LIFETIME_BOUND
+		{
+			return m_elements.GetView();
+		}
+
+		[[nodiscard]] FORCE_INLINE PURE_STATICS bool HasElements() const
+		{
+			return m_elements.HasElements();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS bool IsEmpty() const
+		{
+			return m_elements.IsEmpty();
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS SizeType GetSize() const
+		{
+			return m_elements.GetSize();
+		}
+
+		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator Find(const KeyType& key) LIFETIME_BOUND
+		{
+			return begin() + FindIndex(key);
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator Find(const KeyType& key) const LIFETIME_BOUND
+		{
+			return begin() + FindIndex(key);
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS bool Contains(const KeyType& key) const
+		{
+			return FindIndex(key) != GetSize();
+		}
+
+		template<typename KeyComparableType, typename CompareType = Compare, typename = TypeTraits::Void<typename CompareType::is_transparent>>
+		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator Find(const KeyComparableType key) LIFETIME_BOUND
+		{
+			return begin() + FindIndex(key);
+		}
+		template<typename KeyComparableType, typename CompareType = Compare, typename = TypeTraits::Void<typename CompareType::is_transparent>>
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator Find(const KeyComparableType key) const LIFETIME_BOUND
+		{
+			return begin() + FindIndex(key);
+		}
+		template<typename KeyComparableType, typename CompareType = Compare, typename = TypeTraits::Void<typename CompareType::is_transparent>>
+		[[nodiscard]] FORCE_INLINE PURE_STATICS bool Contains(const KeyComparableType key) const
+		{
+			return FindIndex(key) != GetSize();
+		}
+
+		//! Returns the first element whose key is not ordered before the specified key, or end() if there is none
+		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator LowerBound(const KeyType& key) LIFETIME_BOUND
+		{
+			return begin() + GetLowerBoundIndex(key);
+		}
+		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator LowerBound(const KeyType& key) const LIFETIME_BOUND
+		{
+			return begin() + GetLowerBoundIndex(key);
+		}
+
+		//! Inserts a range of elements at once, moving them out of the view
+		//! The elements are sorted and merged in with a single pass, which is much cheaper than inserting them one by one.
+		//! Elements whose key already exists in the table, or earlier in the range, are skipped.
+		void MoveEmplaceRange(const View elements)
+		{
+			const SizeType previousSize = GetSize();
+			m_elements.MoveEmplaceRangeBack(elements);
+			MergeAppendedElements(previousSize);
+		}
+		//! Inserts copies of a range of elements at once
+		void CopyEmplaceRange(const ConstView elements)
+		{
+			const SizeType previousSize = GetSize();
+			m_elements.CopyEmplaceRangeBack(elements);
+			MergeAppendedElements(previousSize);
+		}
+
+		FORCE_INLINE void Clear()
+		{
+			m_elements.Clear();
+		}
+		FORCE_INLINE iterator Remove(const const_iterator it)
+		{
+			const SizeType index = SizeType(it - cbegin());
+			m_elements.Remove(it);
+			return begin() + index;
+		}
+		//! Removes the element with the specified key
+		//! @returns whether the key existed
+		bool Remove(const KeyType& key)
+		{
+			const SizeType index = FindIndex(key);
+			if (index != GetSize())
+			{
+				m_elements.RemoveAt(index);
+				return true;
+			}
+			return false;
+		}
+		FORCE_INLINE void Reserve(const SizeType size)
+		{
+			m_elements.Reserve(size);
+		}
+	protected:
+		//! Returns the index of the first element whose key is not ordered before the specified key
+		//! The search halves the range without branching on the comparison, so the loop runs the same number of iterations for any key.
+		//! Both possible midpoints of the next iteration are prefetched, hiding the memory latency of searches in large tables.
+		template<typename SearchedKeyType>
+		[[nodiscard]] PURE_STATICS SizeType GetLowerBoundIndex(const SearchedKeyType& key) const
+		{
+			SizeType count = GetSize();
+			if (count == 0)
+			{
+				return 0;
+			}
+
+			const Compare compare{};
+			const ElementType* const pData = m_elements.GetData();
+			const ElementType* pBase = pData;
+			while (count > 1)
+			{
+				const SizeType half = count / 2;
+				const SizeType nextHalf = (count - half) / 2;
+				Memory::PrefetchLine<Memory::PrefetchType::Read, Memory::PrefetchLocality::KeepInAllPossibleCacheLevels>(pBase + nextHalf);
+				Memory::PrefetchLine<Memory::PrefetchType::Read, Memory::PrefetchLocality::KeepInAllPossibleCacheLevels>(
+					pBase + half + nextHalf
+				);
+
+				pBase = compare(FlatOrderedTableDetail::GetKey(pBase[half]), key) ? pBase + half : pBase;
+				count -= half;
+			}
+			return SizeType(pBase - pData) + SizeType(compare(FlatOrderedTableDetail::GetKey(*pBase), key));
+		}
+
+		//! Returns the index of the element with the specified key, or the size if there is none
+		template<typename SearchedKeyType>
+		[[nodiscard]] PURE_STATICS SizeType FindIndex(const SearchedKeyType& key) const
+		{
+			const SizeType index = GetLowerBoundIndex(key);
+			const SizeType size = GetSize();
+			if (index != size && !Compare()(key, FlatOrderedTableDetail::GetKey(m_elements[index])))
+			{
+				return index;
+			}
+			return size;
+		}
+
+		//! Inserts the element returned by createElement at its sorted position unless the key already exists
+		//! createElement is only invoked after the key was searched for, so it can move from the key.
+		//! @returns the index of the new or existing element, and whether it was inserted
+		template<typename CreateElementCallback>
+		SizeType EmplaceSorted(const KeyType& key, bool& wasInsertedOut, CreateElementCallback&& createElement)
+		{
+			const SizeType index = GetLowerBoundIndex(key);
+			if (index != GetSize() && !Compare()(key, FlatOrderedTableDetail::GetKey(m_elements[index])))
+			{
+				wasInsertedOut = false;
+				return index;
+			}
+
+			m_elements.Emplace(m_elements.GetData() + index, Memory::Uninitialized, createElement());
+			wasInsertedOut = true;
+			return index;
+		}
+
+		//! Sorts the elements appended after previousSize and merges them with the existing elements, dropping duplicate keys
+		void MergeAppendedElements(const SizeType previousSize)
+		{
+			const auto compareElements = [](const ElementType& left, const ElementType& right)
+			{
+				return Compare()(FlatOrderedTableDetail::GetKey(left), FlatOrderedTableDetail::GetKey(right));
+			};
+
+			ElementType* const pBegin = m_elements.GetData();
+			ElementType* const pMiddle = pBegin + previousSize;
+			ElementType* const pEnd = pBegin + GetSize();
+			if (pMiddle == pEnd)
+			{
+				return;
+			}
+
+			// Stable ordering keeps the existing element, or the first in the range, in front of later duplicates
+			Algorithms::StableSort(pMiddle, pEnd, compareElements);
+			Algorithms::MergeSorted(pBegin, pMiddle, pEnd, compareElements);
+
+			ElementType* pLastUnique = pBegin;
+			for (ElementType* pElement = pBegin + 1; pElement != pEnd; ++pElement)
+			{
+				if (compareElements(*pLastUnique, *pElement))
+				{
+					++pLastUnique;
+					if (pLastUnique != pElement)
+					{
+						*pLastUnique = Move(*pElement);
+					}
+				}
+			}
+			m_elements.Shrink(SizeType(pLastUnique - pBegin) + 1);
+		}
+	protected:
+		ContainerType m_elements;
+	};
+}
@@ -8,6 +8,7 @@
 #include <Common/TypeTraits/IsMoveAssignable.h>
 #include <Common/Math/CoreNumericTypes.h>
 #include <Common/Math/Max.h>
+#include <Common/Math/Min.h>
 #include <Common/Math/PowerOfTwo.h>
 #include <Common/Math/Vectorization/PackedInt8.h>
 #include <Common/Memory/Allocators/Allocate.h>
@@ -17,6 +18,7 @@
 #include <Common/Memory/Set.h>
 #include <Common/Memory/Swap.h>
 #include <Common/Memory/CountBits.h>
+#include <Common/Memory/Prefetch.h>
 #include <Common/Memory/Forward.h>
 #include <Common/Memory/ReferenceWrapper.h>
 #include <Common/Platform/LifetimeBound.h>
@@ -158,6 +160,84 @@ namespace ngine
 			controlOut = UsedBucketMask | uint8(keyHashValue);
 		}
 
+		/// Returns the bucket index of the element, or the bucket count if it was not found
+		template<typename SearchedKeyType>
+		[[nodiscard]] SizeType FindBucketIndex(const SearchedKeyType& key, const uint64 keyHashValue) const
+		{
+			// Check if we have any data
+			if (IsEmpty())
+			{
+				return GetBucketCount();
+			}
+
+			// Split hash into index and control value
+			SizeType index;
+			uint8 control;
+			GetBucketIndexAndControlValue(keyHashValue, index, control);
+
+			const SizeType bucketCount = GetBucketCount();
+
+			// Linear probing
+			KeyEqual equal;
+			const SizeType bucketMask = bucketCount - 1;
+			const ControlMask control16{control};
+			const ControlMask bucketEmpty{Math::Zero};
+			const ConstControlView allControlBytes = GetControlBytes();
+			const ConstKeyValueView keyValues = GetKeyValues();
+			for (;;)
+			{
+				// Read 16 control values
+				// (note that we added 15 bytes at the end of the control values that mirror the first 15 bytes)
+				Assert(index + 16 <= allControlBytes.GetSize());
+				const ControlMask controlBytes{Math::Vectorization::LoadUnaligned, &allControlBytes[index]};
+
+				// Check for the control value we're looking for
+				// Note that when deleting we can create empty buckets instead of deleted buckets.
+				// This means we must unconditionally check all buckets in this batch for equality
+				// (also beyond the first empty bucket).
+				uint32 controlEqual = uint32((controlBytes == control16).GetMask());
+
+				// Index within the 16 buckets
+				SizeType localIndex = index;
+
+				// Loop while there's still buckets to process
+				while (controlEqual != 0)
+				{
+					// Get the first equal bucket
+					const uint32 firstEqual = Memory::GetNumberOfTrailingZeros(controlEqual);
+
+					// Skip to the bucket
+					localIndex += firstEqual;
+
+					// Make sure that our index is not beyond the end of the table
+					localIndex &= bucketMask;
+
+					// We found a bucket with same control value
+					const KeyValue& keyValue = keyValues[localIndex];
+					if (equal(HashTableDetail::GetKey(keyValue), key))
+					{
+						// Element found
+						return localIndex;
+					}
+
+					// Skip past this bucket
+					controlEqual >>= firstEqual + 1;
+					localIndex++;
+				}
+
+				// Check for empty buckets
+				const uint32 controlEmpty = uint32((controlBytes == bucketEmpty).GetMask());
+				if (controlEmpty != 0)
+				{
+					// An empty bucket was found, we didn't find the element
+					return bucketCount;
+				}
+
+				// Move to next batch of 16 buckets
+				index = (index + 16) & bucketMask;
+			}
+		}
+
 		void AllocateTable(const SizeType bucketCapacity)
 		{
 			Assert(m_allocator.GetData() == nullptr);
@@ -238,6 +318,50 @@ namespace ngine
 			}
 		}
 	protected:
+		//! Number of keys FindMany hashes and prefetches ahead of probing them
+		inline static constexpr SizeType FindManyBatchSize = 16;
+
+		template<typename SearchedKeyType, typename Callback>
+		void FindManyInternal(const ArrayView<const SearchedKeyType, SizeType> keys, Callback&& callback)
+		{
+			const SizeType keyCount = keys.GetSize();
+			if (IsEmpty())
+			{
+				for (SizeType keyIndex = 0; keyIndex < keyCount; ++keyIndex)
+				{
+					callback(keyIndex, nullptr);
+				}
+				return;
+			}
+
+			const SizeType bucketCount = GetBucketCount();
+			const ConstControlView allControlBytes = GetControlBytes();
+			const KeyValueView keyValues = GetKeyValues();
+			uint64 keyHashValues[FindManyBatchSize];
+			for (SizeType batchIndex = 0; batchIndex < keyCount; batchIndex += FindManyBatchSize)
+			{
+				const SizeType batchSize = Math::Min(FindManyBatchSize, SizeType(keyCount - batchIndex));
+				for (SizeType localIndex = 0; localIndex < batchSize; ++localIndex)
+				{
+					const uint64 keyHashValue = HashType{}(keys[batchIndex + localIndex]);
+					keyHashValues[localIndex] = keyHashValue;
+
+					SizeType index;
+					uint8 control;
+					GetBucketIndexAndControlValue(keyHashValue, index, control);
+					Memory::PrefetchLine<Memory::PrefetchType::Read, Memory::PrefetchLocality::KeepInAllPossibleCacheLevels>(&allControlBytes[index]);
+					Memory::PrefetchLine<Memory::PrefetchType::Read, Memory::PrefetchLocality::KeepInAllPossibleCacheLevels>(&keyValues[index]);
+				}
+
+				for (SizeType localIndex = 0; localIndex < batchSize; ++localIndex)
+				{
+					const SizeType keyIndex = batchIndex + localIndex;
+					const SizeType bucketIndex = FindBucketIndex(keys[keyIndex], keyHashValues[localIndex]);
+					callback(keyIndex, bucketIndex != bucketCount ? &keyValues[bucketIndex] : nullptr);
+				}
+			}
+		}
+
 		template<bool InsertAfterGrow = false>
 		bool InsertKey(const Key& key, const uint64 keyHashValue, SizeType& indexOut)
 		{
@@ -703,78 +827,7 @@ namespace ngine
 		template<typename SearchedKeyType = Key>
 		[[nodiscard]] iterator Find(const SearchedKeyType& key, const uint64 keyHashValue) LIFETIME_BOUND
 		{
-			// Check if we have any data
-			if (IsEmpty())
-			{
-				return end();
-			}
-
-			// Split hash into index and control value
-			SizeType index;
-			uint8 control;
-			GetBucketIndexAndControlValue(keyHashValue, index, control);
-
-			const SizeType bucketCount = GetBucketCount();
-
-			// Linear probing
-			KeyEqual equal;
-			const SizeType bucketMask = bucketCount - 1;
-			const ControlMask control16{control};
-			const ControlMask bucketEmpty{Math::Zero};
-			const ControlView allControlBytes = GetControlBytes();
-			const KeyValueView keyValues = GetKeyValues();
-			for (;;)
-			{
-				// Read 16 control values
-				// (note that we added 15 bytes at the end of the control values that mirror the first 15 bytes)
-				Assert(index + 16 <= allControlBytes.GetSize());
-				const ControlMask controlBytes{Math::Vectorization::LoadUnaligned, &allControlBytes[index]};
-
-				// Check for the control value we're looking for
-				// Note that when deleting we can create empty buckets instead of deleted buckets.
-				// This means we must unconditionally check all buckets in this batch for equality
-				// (also beyond the first empty bucket).
-				uint32 controlEqual = uint32((controlBytes == control16).GetMask());
-
-				// Index within the 16 buckets
-				SizeType localIndex = index;
-
-				// Loop while there's still buckets to process
-				while (controlEqual != 0)
-				{
-					// Get the first equal bucket
-					const uint32 firstEqual = Memory::GetNumberOfTrailingZeros(controlEqual);
-
-					// Skip to the bucket
-					localIndex += firstEqual;
-
-					// Make sure that our index is not beyond the end of the table
-					localIndex &= bucketMask;
-
-					// We found a bucket with same control value
-					const KeyValue& keyValue = keyValues[localIndex];
-					if (equal(HashTableDetail::GetKey(keyValue), key))
-					{
-						// Element found
-						return iterator(*this, localIndex);
-					}
-
-					// Skip past this bucket
-					controlEqual >>= firstEqual + 1;
-					localIndex++;
-				}
-
-				// Check for empty buckets
-				const uint32 controlEmpty = uint32((controlBytes == bucketEmpty).GetMask());
-				if (controlEmpty != 0)
-				{
-					// An empty bucket was found, we didn't find the element
-					return end();
-				}
-
-				// Move to next batch of 16 buckets
-				index = (index + 16) & bucketMask;
-			}
+			return iterator(*this, FindBucketIndex(key, keyHashValue));
 		}
 		template<typename SearchedKeyType = Key>
 		[[nodiscard]] iterator Find(const SearchedKeyType& key) LIFETIME_BOUND
@@ -794,6 +847,32 @@ namespace ngine
 			return Find<SearchedKeyType>(key, keyHashValue);
 		}
 
+		/// Finds a batch of keys, writing a pointer to the element of each key or nullptr if it was not found
+		/// The keys are hashed and the control bytes and buckets they start probing at are prefetched a batch at a time before probing,
+		/// so that the cache misses of the batch overlap instead of being paid one key at a time.
+		void FindMany(const ArrayView<const Key, SizeType> keys, const ArrayView<KeyValue*, SizeType> elementsOut)
+		{
+			Assert(elementsOut.GetSize() >= keys.GetSize());
+			FindManyInternal(
+				keys,
+				[elementsOut](const SizeType keyIndex, KeyValue* pElement)
+				{
+					elementsOut[keyIndex] = pElement;
+				}
+			);
+		}
+		void FindMany(const ArrayView<const Key, SizeType> keys, const ArrayView<const KeyValue*, SizeType> elementsOut) const
+		{
+			Assert(elementsOut.GetSize() >= keys.GetSize());
+			const_cast<THashTable&>(*this).FindManyInternal(
+				keys,
+				[elementsOut](const SizeType keyIndex, const KeyValue* pElement)
+				{
+					elementsOut[keyIndex] = pElement;
+				}
+			);
+		}
+
 		template<typename SearchedKeyType = Key>
 		[[nodiscard]] bool Contains(const SearchedKeyType& key, const uint64 keyHashValue) const
 		{
@@ -23,23 +23,8 @@ POP_MSVC_WARNINGS
 
 namespace ngine
 {
-	namespace Internal
-	{
-		template<typename Type>
-		struct DefaultLessCheck
-		{
-			using is_transparent = void;
-
-			template<typename LeftType, typename RightType>
-			bool operator()(const LeftType& leftType, const RightType& rightType) const
-			{
-				return leftType < rightType;
-			}
-		};
-	}
-
-	template<typename _KeyType, typename _ValueType, typename Compare = Internal::DefaultLessCheck<_KeyType>>
-	struct Orderedmap
+	template<typename _KeyType, typename _ValueType, typename Compare = Memory::Internal::DefaultLessCheck<_KeyType>>
+	struct OrderedMap
 	{
 		using KeyType = _KeyType;
 		using ValueType = _ValueType;
@@ -104,42 +89,36 @@ namespace ngine
 
 		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator Find(const KeyType& key) LIFETIME_BOUND
 		{
-			HashType hash;
-			return m_map.find(key, hash(key));
+			return m_map.find(key);
 		}
 		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator Find(const KeyType& key) const LIFETIME_BOUND
 		{
-			HashType hash;
-			return m_map.find(key, hash(key));
+			return m_map.find(key);
 		}
 		[[nodiscard]] FORCE_INLINE PURE_STATICS bool Contains(const KeyType& key) const
 		{
-			HashType hash;
-			return m_map.find(key, hash(key)) != m_map.end();
+			return m_map.find(key) != m_map.end();
 		}
 
 		template<typename Type>
 		inline static constexpr bool TIsTransparent = absl::container_internal::IsTransparent<Type>::value;
 
-		inline static constexpr bool IsTransparent = TIsTransparent<HashType> && TIsTransparent<EqualityType>;
+		inline static constexpr bool IsTransparent = TIsTransparent<Compare>;
 
 		template<typename KeyComparableType, bool Enable = IsTransparent, typename = EnableIf<Enable>>
 		[[nodiscard]] FORCE_INLINE PURE_STATICS iterator Find(const KeyComparableType key) LIFETIME_BOUND
 		{
-			HashType hash;
-			return m_map.template find<KeyComparableType>(key, hash(key));
+			return m_map.template find<KeyComparableType>(key);
 		}
 		template<typename KeyComparableType, bool Enable = IsTransparent, typename = EnableIf<Enable>>
 		[[nodiscard]] FORCE_INLINE PURE_STATICS const_iterator Find(const KeyComparableType key) const LIFETIME_BOUND
 		{
-			HashType hash;
-			return m_map.template find<KeyComparableType>(key, hash(key));
+			return m_map.template find<KeyComparableType>(key);
 		}
 		template<typename KeyComparableType, bool Enable = IsTransparent, typename = EnableIf<Enable>>
 		[[nodiscard]] FORCE_INLINE PURE_STATICS bool Contains(const KeyComparableType key) const
 		{
-			HashType hash;
-			return m_map.template find<KeyComparableType>(key, hash(key)) != m_map.end();
+			return m_map.template find<KeyComparableType>(key) != m_map.end();
 		}
 
 		FORCE_INLINE iterator Emplace(KeyType&& key, ValueType&& value) LIFETIME_BOUND
@@ -167,13 +146,11 @@ namespace ngine
 		}
 		FORCE_INLINE const_iterator Remove(const_iterator it)
 		{
-			m_map.erase(it);
-			return it++;
+			return m_map.erase(it);
 		}
 		FORCE_INLINE iterator Remove(iterator it)
 		{
-			m_map.erase(it);
-			return ++it;
+			return m_map.erase(it);
 		}
 		FORCE_INLINE void Reserve(const uint32 size)
 		{
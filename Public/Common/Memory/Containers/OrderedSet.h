@@ -30,22 +30,7 @@ POP_MSVC_WARNINGS
 
 namespace ngine
 {
-	namespace Internal
-	{
-		template<typename Type>
-		struct DefaultLessCheck
-		{
-			using is_transparent = void;
-
-			template<typename LeftType, typename RightType>
-			bool operator()(const LeftType& leftType, const RightType& rightType) const
-			{
-				return leftType < rightType;
-			}
-		};
-	}
-
-	template<typename _KeyType, typename Compare = Internal::DefaultLessCheck<_KeyType>>
+	template<typename _KeyType, typename Compare = Memory::Internal::DefaultLessCheck<_KeyType>>
 	struct OrderedSet
 	{
 		using KeyType = _KeyType;
@@ -159,8 +144,7 @@ namespace ngine
 		}
 		FORCE_INLINE const_iterator Remove(const_iterator it)
 		{
-			m_set.erase(it);
-			return it++;
+			return m_set.erase(it);
 		}
 		FORCE_INLINE void Merge(const SetType& otherMap)
 		{
@@ -35,6 +35,15 @@ namespace ngine
 		bool UTF16ToUTF32(const TStringView<char32_t> destination, const TStringView<const char16_t> source) noexcept;
 		bool UTF32ToUTF8(const TStringView<UTF8CharType> destination, const TStringView<const char32_t> source) noexcept;
 		bool UTF32ToUTF16(const TStringView<char16_t> destination, const TStringView<const char32_t> source) noexcept;
+
+		//! Returns the number of code units a string converts to, so that destinations can be sized exactly
+		//! Invalid sequences are converted to and counted as the U+FFFD replacement character.
+		[[nodiscard]] PURE_STATICS size GetUTF16Length(const TStringView<const UTF8CharType> source) noexcept;
+		[[nodiscard]] PURE_STATICS size GetUTF32Length(const TStringView<const UTF8CharType> source) noexcept;
+		[[nodiscard]] PURE_STATICS size GetUTF8Length(const TStringView<const char16_t> source) noexcept;
+		[[nodiscard]] PURE_STATICS size GetUTF32Length(const TStringView<const char16_t> source) noexcept;
+		[[nodiscard]] PURE_STATICS size GetUTF8Length(const TStringView<const char32_t> source) noexcept;
+		[[nodiscard]] PURE_STATICS size GetUTF16Length(const TStringView<const char32_t> source) noexcept;
 		UnicodeString FromModifiedUTF8(const TStringView<const char> source) noexcept;
 	}
 
@@ -111,7 +120,7 @@ namespace ngine
 				(TypeTraits::IsSame<CharType__, wchar_t> && (sizeof(wchar_t) == sizeof(char16_t) || sizeof(wchar_t) == sizeof(char32_t))) ||
 				TypeTraits::IsSame<CharType__, char16_t> || TypeTraits::IsSame<CharType__, char32_t>>>
 		explicit TString(const TStringView<const UTF8CharType, SizeType> charString) noexcept
-			: TString(Memory::ConstructWithSize, Memory::Uninitialized, charString.GetSize())
+			: TString(Memory::ConstructWithSize, Memory::Uninitialized, GetConvertedSize(charString))
 		{
 			if constexpr (TypeTraits::IsSame<CharType__, char16_t> || (TypeTraits::IsSame<CharType__, wchar_t> && sizeof(wchar_t) == sizeof(char16_t)))
 			{
@@ -129,7 +138,7 @@ namespace ngine
 				sizeof(wchar_t) == sizeof(char16_t) || sizeof(wchar_t) == sizeof(char32_t)
 			)>>
 		explicit TString(const TStringView<const wchar_t, SizeType> charString) noexcept
-			: TString(Memory::ConstructWithSize, Memory::Uninitialized, charString.GetSize())
+			: TString(Memory::ConstructWithSize, Memory::Uninitialized, GetConvertedSize(charString))
 		{
 			if constexpr (TypeTraits::IsSame<CharType__, UTF8CharType>)
 			{
@@ -162,7 +171,7 @@ namespace ngine
 				TypeTraits::IsSame<CharType__, UTF8CharType> || (TypeTraits::IsSame<CharType__, wchar_t> && sizeof(wchar_t) == sizeof(char16_t)) ||
 				TypeTraits::IsSame<CharType__, char32_t>>>
 		explicit TString(const TStringView<const char16_t, SizeType> charString) noexcept
-			: TString(Memory::ConstructWithSize, Memory::Uninitialized, charString.GetSize())
+			: TString(Memory::ConstructWithSize, Memory::Uninitialized, GetConvertedSize(charString))
 		{
 			if constexpr (TypeTraits::IsSame<CharType__, UTF8CharType>)
 			{
@@ -184,7 +193,7 @@ namespace ngine
 			typename CharType__ = CharType,
 			typename = EnableIf<TypeTraits::IsSame<CharType__, UTF8CharType> || TypeTraits::IsSame<CharType__, char16_t>>>
 		explicit TString(const TStringView<const char32_t, SizeType> charString) noexcept
-			: TString(Memory::ConstructWithSize, Memory::Uninitialized, charString.GetSize())
+			: TString(Memory::ConstructWithSize, Memory::Uninitialized, GetConvertedSize(charString))
 		{
 			if constexpr (TypeTraits::IsSame<CharType__, UTF8CharType>)
 			{
@@ -484,7 +493,8 @@ namespace ngine
 		template<typename SourceCharType, typename OtherSizeType, bool CanResize = SupportResize, typename = EnableIf<CanResize>>
 		TString& operator+=(const TStringView<SourceCharType, OtherSizeType> other) noexcept LIFETIME_BOUND
 		{
-			BaseType::ReserveOrAssert(GetSize() + (SizeType)other.GetSize() + 1, Memory::ReserveExponential);
+			const SizeType appendedSize = GetConvertedSize(other);
+			BaseType::ReserveOrAssert(GetSize() + appendedSize + 1, Memory::ReserveExponential);
 
 			if constexpr (TypeTraits::IsSame<TypeTraits::WithoutConst<SourceCharType>, CharType>)
 			{
@@ -502,36 +512,58 @@ namespace ngine
 			}
 			else if constexpr (TypeTraits::IsSame<CharType, UTF8CharType> && TypeTraits::IsSame<TypeTraits::WithoutConst<SourceCharType>, wchar_t>)
 			{
-				Internal::UTF16ToUTF8(
-					TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), other.GetSize()},
-					TStringView<const char16_t, uint32>{reinterpret_cast<const char16_t*>(other.GetData()), other.GetSize()}
-				);
+				if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+				{
+					Internal::UTF16ToUTF8(
+						TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), appendedSize},
+						TStringView<const char16_t, uint32>{reinterpret_cast<const char16_t*>(other.GetData()), other.GetSize()}
+					);
+				}
+				else
+				{
+					Internal::UTF32ToUTF8(
+						TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), appendedSize},
+						TStringView<const char32_t, uint32>{reinterpret_cast<const char32_t*>(other.GetData()), other.GetSize()}
+					);
+				}
 			}
 			else if constexpr (TypeTraits::IsSame<CharType, UTF8CharType> && TypeTraits::IsSame<TypeTraits::WithoutConst<SourceCharType>, char16_t>)
 			{
 				Internal::UTF16ToUTF8(
-					TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), other.GetSize()},
+					TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), appendedSize},
 					TStringView<const char16_t, uint32>{reinterpret_cast<const char16_t*>(other.GetData()), other.GetSize()}
 				);
 			}
 			else if constexpr (TypeTraits::IsSame<CharType, UTF8CharType> && TypeTraits::IsSame<TypeTraits::WithoutConst<SourceCharType>, char32_t>)
 			{
 				Internal::UTF32ToUTF8(
-					TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), other.GetSize()},
+					TStringView<UTF8CharType>{BaseType::GetData() + GetSize(), appendedSize},
 					TStringView<const char32_t, uint32>{reinterpret_cast<const char32_t*>(other.GetData()), other.GetSize()}
 				);
 			}
-			else if constexpr ((TypeTraits::IsSame<CharType, wchar_t> || TypeTraits::IsSame<CharType, UTF8CharType>)&&TypeTraits::
-			                     IsSame<TypeTraits::WithoutConst<SourceCharType>, UTF8CharType>)
+			else if constexpr (TypeTraits::IsSame<CharType, wchar_t> && TypeTraits::IsSame<TypeTraits::WithoutConst<SourceCharType>, UTF8CharType>)
 			{
-				Internal::UTF8ToUTF16(TStringView<char16_t>{reinterpret_cast<char16_t*>(BaseType::GetData()) + GetSize(), other.GetSize()}, other);
+				if constexpr (sizeof(wchar_t) == sizeof(char16_t))
+				{
+					Internal::UTF8ToUTF16(
+						TStringView<char16_t>{reinterpret_cast<char16_t*>(BaseType::GetData()) + GetSize(), appendedSize},
+						other
+					);
+				}
+				else
+				{
+					Internal::UTF8ToUTF32(
+						TStringView<char32_t>{reinterpret_cast<char32_t*>(BaseType::GetData()) + GetSize(), appendedSize},
+						other
+					);
+				}
 			}
 			else
 			{
 				static_unreachable("Conversion not supported");
 			}
 
-			BaseType::m_size = GetSizeWithNullTerminator() + (SizeType)other.GetSize();
+			BaseType::m_size = GetSizeWithNullTerminator() + appendedSize;
 
 			SetNullTerminator();
 
@@ -750,6 +782,52 @@ namespace ngine
 		{
 			return Math::Max(BaseType::m_size, (SizeType)1);
 		}
+
+		//! Returns the number of characters a string in another encoding converts to
+		template<typename SourceCharType, typename SourceSizeType>
+		[[nodiscard]] PURE_STATICS static SizeType GetConvertedSize(const TStringView<SourceCharType, SourceSizeType> source) noexcept
+		{
+			if constexpr (sizeof(SourceCharType) == sizeof(CharType))
+			{
+				return (SizeType)source.GetSize();
+			}
+			else if constexpr (sizeof(SourceCharType) == sizeof(UTF8CharType))
+			{
+				const TStringView<const UTF8CharType> utf8Source{reinterpret_cast<const UTF8CharType*>(source.GetData()), source.GetSize()};
+				if constexpr (sizeof(CharType) == sizeof(char16_t))
+				{
+					return (SizeType)Internal::GetUTF16Length(utf8Source);
+				}
+				else
+				{
+					return (SizeType)Internal::GetUTF32Length(utf8Source);
+				}
+			}
+			else if constexpr (sizeof(SourceCharType) == sizeof(char16_t))
+			{
+				const TStringView<const char16_t> utf16Source{reinterpret_cast<const char16_t*>(source.GetData()), source.GetSize()};
+				if constexpr (sizeof(CharType) == sizeof(UTF8CharType))
+				{
+					return (SizeType)Internal::GetUTF8Length(utf16Source);
+				}
+				else
+				{
+					return (SizeType)Internal::GetUTF32Length(utf16Source);
+				}
+			}
+			else
+			{
+				const TStringView<const char32_t> utf32Source{reinterpret_cast<const char32_t*>(source.GetData()), source.GetSize()};
+				if constexpr (sizeof(CharType) == sizeof(UTF8CharType))
+				{
+					return (SizeType)Internal::GetUTF8Length(utf32Source);
+				}
+				else
+				{
+					return (SizeType)Internal::GetUTF16Length(utf32Source);
+				}
+			}
+		}
 	protected:
 		FORCE_INLINE void SetNullTerminator()
 		{
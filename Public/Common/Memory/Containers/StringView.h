@@ -297,6 +297,17 @@ namespace ngine
 			return InvalidPosition;
 		}
 
+		//! Finds the first character that is any of the specified characters, for example either path separator
+		[[nodiscard]] FORCE_INLINE PURE_STATICS SizeType FindFirstOfAny(const ConstView characters, const SizeType offset = 0) const noexcept
+		{
+			const auto it = GetSubstringFrom(offset).ConstView::BaseType::FindFirstOfAny((ConstArrayView)characters);
+			if (it.IsValid())
+			{
+				return static_cast<SizeType>(it.Get() - begin());
+			}
+			return InvalidPosition;
+		}
+
 		[[nodiscard]] FORCE_INLINE PURE_STATICS constexpr ConstView
 		FindFirstRange(const ConstView value, const SizeType offset = 0) const noexcept
 		{
@@ -2,6 +2,7 @@
 
 #include <Common/Platform/Pure.h>
 #include <Common/Math/Hash.h>
+#include <Common/Math/Min.h>
 #include <Common/Memory/New.h>
 #include <Common/Memory/Pair.h>
 #include <Common/Memory/Containers/HashTable.h>
@@ -215,6 +216,45 @@ namespace ngine
 #endif
 		}
 
+		//! Finds a batch of keys, writing a pointer to the value of each key or nullptr if it was not found
+		//! The probe locations of several keys are prefetched before any of them is probed, overlapping the cache misses of large maps.
+		void FindMany(const ArrayView<const KeyType, uint32> keys, const ArrayView<ValueType*, uint32> valuesOut)
+		{
+			Assert(valuesOut.GetSize() >= keys.GetSize());
+#if ENABLE_HASH_TABLE_UNORDERED_MAP
+			BaseType::FindManyInternal(
+				keys,
+				[valuesOut](const uint32 keyIndex, PairType* pPair)
+				{
+					valuesOut[keyIndex] = pPair != nullptr ? &pPair->second : nullptr;
+				}
+			);
+#else
+			HashType hash;
+			constexpr uint32 batchSize = 16;
+			size keyHashValues[batchSize];
+			for (uint32 batchIndex = 0, keyCount = keys.GetSize(); batchIndex < keyCount; batchIndex += batchSize)
+			{
+				const uint32 batchKeyCount = Math::Min(batchSize, keyCount - batchIndex);
+				for (uint32 localIndex = 0; localIndex < batchKeyCount; ++localIndex)
+				{
+					keyHashValues[localIndex] = hash(keys[batchIndex + localIndex]);
+					m_map.prefetch_hash(keyHashValues[localIndex]);
+				}
+				for (uint32 localIndex = 0; localIndex < batchKeyCount; ++localIndex)
+				{
+					const typename MapType::iterator it = m_map.find(keys[batchIndex + localIndex], keyHashValues[localIndex]);
+					valuesOut[batchIndex + localIndex] = it != m_map.end() ? &it->second : nullptr;
+				}
+			}
+#endif
+		}
+		void FindMany(const ArrayView<const KeyType, uint32> keys, const ArrayView<const ValueType*, uint32> valuesOut) const
+		{
+			const ArrayView<ValueType*, uint32> mutableValuesOut{const_cast<ValueType**>(valuesOut.GetData()), valuesOut.GetSize()};
+			const_cast<UnorderedMap&>(*this).FindMany(keys, mutableValuesOut);
+		}
+
 		//! Emplaces a key and its value into the map, assuming that the key does not already exist.
 		FORCE_INLINE iterator Emplace(KeyType&& key, ValueType&& value) LIFETIME_BOUND
 		{
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <Common/Math/CoreNumericTypes.h>
+#include <Common/Platform/Pure.h>
+#include <Common/TypeTraits/IsIntegral.h>
+#include <Common/TypeTraits/IsEnum.h>
+#include <Common/TypeTraits/IsSame.h>
+#include <Common/TypeTraits/WithoutConst.h>
+#include <Common/Memory/GetIntegerType.h>
+
+namespace ngine::Memory::VectorizedSearch
+{
+	//! Search kernels used by ArrayView and StringView for element types that can be compared by their bytes
+	//! Elements are compared 16 bytes at a time with Math::Vectorization::Packed<uint8, 16>, on platforms where the byte mask is native.
+	//! The kernels are not inlined, so views with fewer elements than this keep using the scalar loops in ArrayView.
+	inline static constexpr size MinimumElementCount = 16;
+
+	//! Whether searching for ComparableType in a view of ElementType can be done by comparing bytes instead of invoking operator==
+	template<typename ElementType, typename ComparableType>
+	inline static constexpr bool IsSupported =
+		(TypeTraits::IsIntegral<TypeTraits::WithoutConst<ElementType>> || TypeTraits::IsEnum<TypeTraits::WithoutConst<ElementType>>) &&
+		TypeTraits::IsSame<TypeTraits::WithoutConst<ElementType>, TypeTraits::WithoutConst<ComparableType>> &&
+		(sizeof(ElementType) == 1 || sizeof(ElementType) == 2 || sizeof(ElementType) == 4 || sizeof(ElementType) == 8);
+
+	//! The integer type the kernels operate on for an element type
+	template<typename ElementType>
+	using SearchType = UnsignedIntegerType<sizeof(ElementType) * 8>;
+
+	//! Finds the first element equal to value
+	//! @returns the index of the element, or count if there is none
+	template<typename Type>
+	[[nodiscard]] PURE_STATICS size FindFirst(const void* pElements, const size count, const Type value) noexcept;
+	//! Finds the last element equal to value
+	//! @returns the index of the element, or count if there is none
+	template<typename Type>
+	[[nodiscard]] PURE_STATICS size FindLast(const void* pElements, const size count, const Type value) noexcept;
+
+	//! Finds the first occurrence of the range of rangeCount elements
+	//! Candidates are found by matching the first and last element of the range for a whole vector of start positions at once.
+	//! @returns the index the range starts at, or count if it was not found
+	template<typename Type>
+	[[nodiscard]] PURE_STATICS size
+	FindFirstRange(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+	//! Finds the last occurrence of the range of rangeCount elements
+	//! @returns the index the range starts at, or count if it was not found
+	template<typename Type>
+	[[nodiscard]] PURE_STATICS size
+	FindLastRange(const void* pElements, const size count, const void* pRange, const size rangeCount) noexcept;
+
+	//! Finds the first byte that is equal to any of the specified values
+	//! Small sets are compared vectorized, larger ones are looked up in a 256-bit table per byte.
+	//! @returns the index of the byte, or count if there is none
+	[[nodiscard]] PURE_STATICS size
+	FindFirstOfAny(const uint8* pElements, const size count, const uint8* pValues, const size valueCount) noexcept;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <Common/Platform/ForceInline.h>
+#include <Common/Assert/Assert.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Math/PowerOfTwo.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/AtomicPtr.h>
+
+namespace ngine
+{
+	//! Bounded Chase-Lev work stealing deque
+	//! The owning thread pushes and pops from the bottom (LIFO), while any other thread can steal from the top (FIFO).
+	//! Push, Pop and Steal are lock-free, only Pop and Steal contend when a single element remains.
+	template<typename ContainedType, uint32 Capacity>
+	struct TWorkStealingQueue;
+
+	template<typename ContainedType, uint32 Capacity>
+	struct TWorkStealingQueue<ContainedType*, Capacity>
+	{
+		static_assert(Math::IsPowerOfTwo(Capacity), "Work stealing queue capacity must be a power of two");
+		inline static constexpr uint32 IndexMask = Capacity - 1u;
+
+		using SizeType = uint32;
+
+		TWorkStealingQueue() = default;
+		TWorkStealingQueue(const TWorkStealingQueue&) = delete;
+		TWorkStealingQueue& operator=(const TWorkStealingQueue&) = delete;
+		TWorkStealingQueue(TWorkStealingQueue&&) = delete;
+		TWorkStealingQueue& operator=(TWorkStealingQueue&&) = delete;
+
+		//! Pushes an element to the bottom of the queue
+		//! Must only be called from the owning thread
+		//! @returns false if the queue was full
+		[[nodiscard]] FORCE_INLINE bool Push(ContainedType* pElement)
+		{
+			Assert(pElement != nullptr);
+			const int64 bottom = m_bottom.Load();
+			const int64 top = m_top.Load();
+			if (UNLIKELY(bottom - top >= (int64)Capacity))
+			{
+				return false;
+			}
+
+			m_elements[(uint32)bottom & IndexMask] = pElement;
+			m_bottom = bottom + 1;
+			return true;
+		}
+
+		//! Pops the most recently pushed element from the bottom of the queue
+		//! Must only be called from the owning thread
+		[[nodiscard]] FORCE_INLINE ContainedType* Pop()
+		{
+			const int64 bottom = m_bottom.Load() - 1;
+			m_bottom = bottom;
+			int64 top = m_top.Load();
+			if (top <= bottom)
+			{
+				ContainedType* pElement = m_elements[(uint32)bottom & IndexMask];
+				if (top == bottom)
+				{
+					// Last element, race against thieves
+					if (!m_top.CompareExchangeStrong(top, top + 1))
+					{
+						pElement = nullptr;
+					}
+					m_bottom = bottom + 1;
+				}
+				return pElement;
+			}
+			else
+			{
+				m_bottom = bottom + 1;
+				return nullptr;
+			}
+		}
+
+		//! Steals the oldest element from the top of the queue
+		//! Can be called from any thread
+		//! @returns nullptr if the queue was empty or another thread won the race for the element
+		[[nodiscard]] FORCE_INLINE ContainedType* Steal()
+		{
+			int64 top = m_top.Load();
+			const int64 bottom = m_bottom.Load();
+			if (top < bottom)
+			{
+				ContainedType* pElement = m_elements[(uint32)top & IndexMask];
+				if (m_top.CompareExchangeStrong(top, top + 1))
+				{
+					return pElement;
+				}
+			}
+			return nullptr;
+		}
+
+		//! Steals the oldest element from the top of the queue if it passes the filter
+		//! Can be called from any thread
+		//! The filter must only inspect the pointer value, the element may already have been popped by another thread
+		//! Once maximumRejectionCount steal attempts in a row were rejected, the next attempt steals the top element regardless of the filter.
+		//! This keeps an element that most thieves reject from blocking all elements behind it until the owner gets to it.
+		template<typename Filter>
+		[[nodiscard]] FORCE_INLINE ContainedType* StealIf(Filter&& filter, const uint32 maximumRejectionCount)
+		{
+			int64 top = m_top.Load();
+			const int64 bottom = m_bottom.Load();
+			if (top < bottom)
+			{
+				ContainedType* pElement = m_elements[(uint32)top & IndexMask];
+				if (!filter(pElement) && m_rejectedStealCount.FetchAdd(1u) < maximumRejectionCount)
+				{
+					return nullptr;
+				}
+				if (m_top.CompareExchangeStrong(top, top + 1))
+				{
+					m_rejectedStealCount = 0u;
+					return pElement;
+				}
+			}
+			return nullptr;
+		}
+
+		//! Gets the approximate number of elements in the queue, may be outdated as soon as it is returned
+		[[nodiscard]] FORCE_INLINE SizeType GetSize() const
+		{
+			const int64 bottom = m_bottom.Load();
+			const int64 top = m_top.Load();
+			return (SizeType)(bottom > top ? bottom - top : 0);
+		}
+		[[nodiscard]] FORCE_INLINE bool IsEmpty() const
+		{
+			return GetSize() == 0;
+		}
+		[[nodiscard]] FORCE_INLINE bool HasElements() const
+		{
+			return GetSize() > 0;
+		}
+		[[nodiscard]] FORCE_INLINE static constexpr SizeType GetCapacity()
+		{
+			return Capacity;
+		}
+	protected:
+		// Top and bottom are kept on separate cache lines, as thieves only contend on the top
+		alignas(64) Threading::Atomic<int64> m_top{0};
+		//! Number of consecutive steal attempts that were rejected by their filter, see StealIf
+		Threading::Atomic<uint32> m_rejectedStealCount{0u};
+		alignas(64) Threading::Atomic<int64> m_bottom{0};
+		alignas(64) Array<Threading::Atomic<ContainedType*>, Capacity> m_elements;
+	};
+}
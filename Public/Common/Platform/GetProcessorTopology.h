@@ -0,0 +1,57 @@
+#pragma once
+
+#include <Common/Platform/LogicalProcessorMask.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Containers/FlatVector.h>
+#include <Common/Memory/Containers/StringView.h>
+
+namespace ngine::Platform
+{
+	//! Describes which logical processors share a last level cache and a NUMA node
+	//! Runners placed within the same domain avoid cross-socket traffic and thrashing each other's caches
+	struct ProcessorTopology
+	{
+		struct LogicalProcessor
+		{
+			//! OS index of the processor
+			uint16 m_index;
+			//! Compact index of the group of processors sharing a last level cache
+			uint16 m_cacheDomainIndex;
+			//! Compact index of the NUMA node the processor belongs to
+			uint16 m_numaNodeIndex;
+		};
+		using LogicalProcessors = FlatVector<LogicalProcessor, MaximumLogicalProcessorCount>;
+
+		//! Logical processors ordered by OS index
+		LogicalProcessors m_logicalProcessors;
+		uint16 m_cacheDomainCount{1};
+		uint16 m_numaNodeCount{1};
+
+		[[nodiscard]] bool HasMultipleLocalityDomains() const
+		{
+			return (m_cacheDomainCount > 1) | (m_numaNodeCount > 1);
+		}
+
+		[[nodiscard]] LogicalProcessorMask GetCacheDomainProcessorMask(const uint16 cacheDomainIndex) const
+		{
+			LogicalProcessorMask mask;
+			for (const LogicalProcessor& processor : m_logicalProcessors)
+			{
+				if (processor.m_cacheDomainIndex == cacheDomainIndex)
+				{
+					mask.Set(processor.m_index);
+				}
+			}
+			return mask;
+		}
+	};
+
+	namespace Internal
+	{
+		//! Parses a processor list in the Linux sysfs format, for example "0-3,8,10-11"
+		[[nodiscard]] extern LogicalProcessorMask ParseLogicalProcessorList(ConstStringView list);
+	}
+
+	//! Gets the processor topology of this machine, detected once on first use
+	[[nodiscard]] extern const ProcessorTopology& GetProcessorTopology();
+}
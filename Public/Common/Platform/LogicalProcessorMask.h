@@ -0,0 +1,11 @@
+#pragma once
+
+#include <Common/Memory/Bitset.h>
+
+namespace ngine::Platform
+{
+	//! Maximum number of logical processors that can be addressed, matches the default Linux CPU_SETSIZE
+	inline static constexpr uint16 MaximumLogicalProcessorCount = 1024;
+	//! One bit per logical processor, indexed by the OS processor index
+	using LogicalProcessorMask = Bitset<MaximumLogicalProcessorCount>;
+}
@@ -3,6 +3,7 @@
 #include "ForwardDeclarations/Type.h"
 
 #include <Common/Memory/Containers/UnorderedMap.h>
+#include <Common/Memory/Optional.h>
 #include <Common/Guid.h>
 #include <Common/Reflection/TypeDefinition.h>
 #include <Common/Reflection/FunctionFlags.h>
@@ -12,6 +13,9 @@
 #include <Common/Platform/Pure.h>
 #include <Common/Memory/CallbackResult.h>
 #include <Common/Threading/Mutexes/SharedMutex.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Threading/AtomicBool.h>
+#include <Common/Threading/SnapshotPointer.h>
 #include <Common/System/SystemType.h>
 #include <Common/EnumFlags.h>
 #include <Common/Storage/ForwardDeclarations/IdentifierMask.h>
@@ -35,6 +39,10 @@ namespace ngine::Reflection
 		Scripting::VM::DynamicFunction m_function;
 		EnumFlags<FunctionFlags> m_flags;
 		Guid m_owningTypeGuid;
+		//! Definition the function was registered with, set for functions only
+		Optional<const FunctionInfo*> m_pFunctionInfo;
+		//! Definition the event was registered with, set for events only
+		Optional<const EventInfo*> m_pEventInfo;
 	};
 }
 
@@ -42,7 +50,7 @@ namespace ngine
 {
 	extern template struct UnorderedMap<Guid, const Reflection::TypeInterface*, Guid::Hash>;
 	extern template struct UnorderedMap<Guid, Reflection::TypeDefinition, Guid::Hash>;
-	extern template struct UnorderedMap<Guid, Reflection::FunctionData, Guid::Hash>;
+	extern template struct UnorderedMap<Guid, Scripting::FunctionIdentifier, Guid::Hash>;
 }
 
 namespace ngine::Reflection
@@ -107,6 +115,11 @@ namespace ngine::Reflection
 		void DeregisterDynamicGlobalFunction();
 
 		[[nodiscard]] PURE_STATICS const FunctionData& FindFunction(const Guid guid) const;
+		//! Resolves a registered function without any lookup or locking
+		[[nodiscard]] PURE_STATICS const FunctionData& FindFunction(const FunctionIdentifier identifier) const
+		{
+			return m_functionData[identifier];
+		}
 		[[nodiscard]] PURE_STATICS Optional<const FunctionInfo*> FindGlobalFunctionDefinition(const Guid guid) const;
 		[[nodiscard]] PURE_STATICS Optional<const FunctionInfo*> FindTypeFunctionDefinition(const Guid guid) const;
 		[[nodiscard]] PURE_STATICS Optional<const FunctionInfo*> FindFunctionDefinition(const Guid guid) const;
@@ -132,6 +145,10 @@ namespace ngine::Reflection
 		{
 			return FindFunction(guid);
 		}
+		[[nodiscard]] PURE_STATICS const FunctionData& FindEvent(const FunctionIdentifier identifier) const
+		{
+			return m_functionData[identifier];
+		}
 		[[nodiscard]] PURE_STATICS Optional<const EventInfo*> FindGlobalEventDefinition(const Guid guid) const;
 		[[nodiscard]] PURE_STATICS Optional<const EventInfo*> FindTypeEventDefinition(const Guid guid) const;
 		[[nodiscard]] PURE_STATICS Optional<const EventInfo*> FindEventDefinition(const Guid guid) const;
@@ -154,24 +171,61 @@ namespace ngine::Reflection
 
 		using IterateTypeInterfacesCallback = ngine::Function<Memory::CallbackResult(const TypeInterface&), 32>;
 		void IterateTypeInterfaces(IterateTypeInterfacesCallback&& callback) const;
+
+		//! Publishes immutable copies of the type, type definition and function lookup tables
+		//! Guid lookups then read the latest copy without locking, avoiding contention on the shared mutexes.
+		//! Every later registration or deregistration copies the tables again, so this is intended to be enabled
+		//! once the bulk of registration is done, for example after plugins were loaded.
+		//! Results of FindTypeDefinition remain valid until the next registration change has been published and readers drained.
+		void EnableSnapshotLookups();
+		[[nodiscard]] bool IsUsingSnapshotLookups() const
+		{
+			return m_isSnapshotLookupEnabled;
+		}
+	protected:
+		//! Stores the function's data and assigns it an identifier, expects m_functionMutex to be locked
+		FunctionIdentifier EmplaceFunction(const Guid guid, FunctionData&& functionData);
+		//! Removes the function's guid lookup and clears its data unless snapshot lookups are enabled, expects m_functionMutex to be locked
+		void RemoveFunction(const Guid guid);
+		[[nodiscard]] PURE_STATICS Optional<const FunctionData*> FindFunctionData(const Guid guid) const;
+
+		//! Publishes a new lookup snapshot if snapshot lookups are enabled, expects no registry mutex to be locked
+		void UpdateLookupSnapshot();
+		void PublishLookupSnapshot();
 	protected:
 		mutable Threading::SharedMutex m_typeMutex;
 		using TypeContainer = UnorderedMap<Guid, const TypeInterface*, Guid::Hash>;
 		TypeContainer m_types;
 		mutable Threading::SharedMutex m_typeDefinitionMutex;
-		UnorderedMap<Guid, TypeDefinition, Guid::Hash> m_typeDefinitions;
+		using TypeDefinitionContainer = UnorderedMap<Guid, TypeDefinition, Guid::Hash>;
+		TypeDefinitionContainer m_typeDefinitions;
 
 		mutable Threading::SharedMutex m_functionMutex;
-		using FunctionContainer = UnorderedMap<Guid, FunctionData, Guid::Hash>;
+		//! Identifiers of the registered functions and events
+		using FunctionContainer = UnorderedMap<Guid, FunctionIdentifier, Guid::Hash>;
 		FunctionContainer m_functions;
 		using GlobalFunctionContainer = UnorderedMap<Guid, const FunctionInfo*, Guid::Hash>;
 		GlobalFunctionContainer m_globalFunctions;
 		TSaltedIdentifierStorage<FunctionIdentifier> m_functionIdentifiers;
 		using FunctionLookupContainer = TIdentifierArray<Guid, FunctionIdentifier>;
 		FunctionLookupContainer m_functionGuids{Memory::Zeroed};
-		UnorderedMap<Guid, FunctionIdentifier, Guid::Hash> m_functionIdentifierLookupMap;
+		//! Registration data of each function and event, indexed by identifier
+		TIdentifierArray<FunctionData, FunctionIdentifier> m_functionData;
 
 		using GlobalEventContainer = UnorderedMap<Guid, const EventInfo*, Guid::Hash>;
 		GlobalEventContainer m_globalEvents;
+
+		//! Immutable copy of the guid lookup tables, see EnableSnapshotLookups
+		struct LookupSnapshot
+		{
+			TypeContainer m_types;
+			TypeDefinitionContainer m_typeDefinitions;
+			FunctionContainer m_functions;
+		};
+		Threading::Atomic<bool> m_isSnapshotLookupEnabled{false};
+		//! Serializes publication of snapshots
+		Threading::Mutex m_lookupSnapshotMutex;
+		using LookupSnapshotPointer = Threading::TSnapshotPointer<LookupSnapshot>;
+		LookupSnapshotPointer m_lookupSnapshot;
 	};
 }
@@ -226,6 +226,6 @@ namespace ngine::Reflection
 	inline void Registry::DeregisterDynamicGlobalEvent()
 	{
 		constexpr auto& event = ReflectedEvent<Event>::Event;
-		DeregisterDynamicGlobalFunction(event.GetGuid());
+		DeregisterDynamicGlobalEvent(event.GetGuid());
 	}
 }
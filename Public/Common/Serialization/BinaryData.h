@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Common/Serialization/Common.h>
+#include <Common/Serialization/SavingFlags.h>
+#include <Common/Memory/Containers/ForwardDeclarations/ByteView.h>
+#include <Common/Memory/Containers/ForwardDeclarations/String.h>
+#include <Common/Memory/Containers/ForwardDeclarations/StringView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/EnumFlags.h>
+
+namespace ngine::Serialization
+{
+	//! Compact, schema-less binary encoding of serialized data, used for cooked data that is never read by humans
+	//! Decoding builds the same document JSON parsing would, so all Reader and Writer serialization works unchanged.
+	//!
+	//! Layout, all integers are unsigned LEB128 unless noted otherwise:
+	//! - Header: BinaryDataMagic followed by the format version byte
+	//! - Key table: key count, then each object member name once as length and UTF-8 bytes
+	//! - Root value, each value starts with a BinaryValueType byte:
+	//!   - Integer: zigzag encoded signed value
+	//!   - UnsignedInteger: value that does not fit a signed 64-bit integer
+	//!   - Double: 8 bytes, little endian IEEE 754
+	//!   - String: length and UTF-8 bytes
+	//!   - Array: element count followed by the elements
+	//!   - Object: member count followed by pairs of key table index and value
+	enum class BinaryValueType : uint8
+	{
+		Null,
+		False,
+		True,
+		Integer,
+		UnsignedInteger,
+		Double,
+		String,
+		Array,
+		Object
+	};
+
+	//! Starts with a byte that can't begin UTF-8 text, so binary data is never mistaken for JSON
+	inline static constexpr ByteType BinaryDataMagic[] = {0xF5, 'N', 'B', 'D'};
+	inline static constexpr uint8 BinaryDataVersion = 1;
+
+	[[nodiscard]] bool IsBinaryData(const ConstByteView data);
+
+	//! Replaces the document's contents with the decoded binary data
+	//! @returns false and leaves the document null if the data is not valid
+	[[nodiscard]] bool DecodeBinaryData(const ConstByteView data, Document& document);
+	[[nodiscard]] Vector<ByteType, size> EncodeBinaryData(const Value& value);
+
+	//! Converts JSON text to binary data, returns an empty vector if the JSON could not be parsed
+	[[nodiscard]] Vector<ByteType, size> ConvertJsonToBinaryData(const ConstStringView json);
+	//! Converts binary data to JSON text, returns an empty string if the binary data is not valid
+	[[nodiscard]] String ConvertBinaryDataToJson(const ConstByteView data, const EnumFlags<SavingFlags> flags = {});
+}
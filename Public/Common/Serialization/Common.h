@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Common/Memory/Allocators/Allocate.h>
+#include <Common/Memory/Allocators/Arena.h>
 #include <Common/IO/rapidjson.h>
 #include <Common/Memory/Containers/ContainerCommon.h>
 
@@ -12,6 +13,19 @@ namespace ngine::Serialization
 		{
 		public:
 			inline static constexpr bool kNeedFree = true;
+
+			RapidJsonAllocator() = default;
+			//! Allocates all values from the arena, they are never freed individually but released with the arena
+			RapidJsonAllocator(Memory::Arena& arena)
+				: m_pArena(&arena)
+			{
+			}
+
+			[[nodiscard]] bool NeedsFree() const
+			{
+				return m_pArena == nullptr;
+			}
+
 			void* Malloc(size_t size)
 			{
 				if (size == 0)
@@ -19,10 +33,19 @@ namespace ngine::Serialization
 					return nullptr;
 				}
 
+				if (m_pArena != nullptr)
+				{
+					return m_pArena->Allocate(size);
+				}
 				return Memory::Allocate(size);
 			}
-			void* Realloc(void* originalPtr, [[maybe_unused]] size_t originalSize, size_t newSize)
+			void* Realloc(void* originalPtr, size_t originalSize, size_t newSize)
 			{
+				if (m_pArena != nullptr)
+				{
+					return newSize != 0 ? m_pArena->Reallocate(originalPtr, originalSize, newSize) : nullptr;
+				}
+
 				if (newSize == 0)
 				{
 					Free(originalPtr);
@@ -40,6 +63,8 @@ namespace ngine::Serialization
 			{
 				Memory::Deallocate(ptr);
 			}
+		protected:
+			Memory::Arena* m_pArena{nullptr};
 		};
 	}
 }
@@ -20,7 +20,7 @@ namespace ngine::Serialization
 	template<typename T, typename... Args, typename = EnableIf<Internal::CanRead<T, Args...>>>
 	[[nodiscard]] static inline bool DeserializeFromBuffer(const ConstStringView jsonData, T& element, Args&... args)
 	{
-		const Data serializedData(jsonData);
+		const Data serializedData(jsonData, ReadOnly);
 		if (UNLIKELY(!serializedData.IsValid()))
 		{
 			return false;
@@ -32,7 +32,7 @@ namespace ngine::Serialization
 	template<typename T, typename... Args, typename = EnableIf<Internal::CanRead<T, Args...>>>
 	[[nodiscard]] static inline bool DeserializeFromDisk(const IO::FileView jsonFile, T& element, Args&... args)
 	{
-		const Data serializedData(jsonFile);
+		const Data serializedData(jsonFile, ReadOnly);
 		if (UNLIKELY(!serializedData.IsValid()))
 		{
 			return false;
@@ -44,7 +44,7 @@ namespace ngine::Serialization
 	template<typename T, typename... Args, typename = EnableIf<Internal::CanRead<T, Args...>>>
 	[[nodiscard]] static inline bool DeserializeFromDisk(const IO::ConstZeroTerminatedPathView filePath, T& element, Args&... args)
 	{
-		Data serializedData(filePath);
+		const Data serializedData(filePath, ReadOnly);
 		if (UNLIKELY(!serializedData.IsValid()))
 		{
 			return false;
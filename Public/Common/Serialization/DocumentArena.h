@@ -0,0 +1,44 @@
+#pragma once
+
+#include <Common/Serialization/Common.h>
+#include <Common/Memory/Allocators/Arena.h>
+#include <Common/Memory/UniquePtr.h>
+
+namespace ngine::Serialization
+{
+	//! Arena backing all values of a read-only document, released as a whole instead of freeing each value and string
+	//! Parsing fills the arena front to back, so building the document only touches the global allocator for new blocks.
+	//! Released arenas are kept in a per-thread cache and reused by the next document, along with their blocks.
+	struct DocumentArena
+	{
+		inline static constexpr size BlockSize = 16 * 1024;
+
+		DocumentArena()
+			: m_arena(BlockSize)
+			, m_allocator(m_arena)
+		{
+		}
+		DocumentArena(const DocumentArena&) = delete;
+		DocumentArena& operator=(const DocumentArena&) = delete;
+		DocumentArena(DocumentArena&&) = delete;
+		DocumentArena& operator=(DocumentArena&&) = delete;
+
+		//! Returns a cached arena of the calling thread, or a new one if none is cached
+		[[nodiscard]] static UniquePtr<DocumentArena> Acquire();
+		//! Resets the arena and caches it for reuse on the calling thread
+		//! Documents using the arena must have been destroyed or moved away from it
+		static void Release(UniquePtr<DocumentArena>&& pArena);
+
+		[[nodiscard]] Internal::RapidJsonAllocator& GetAllocator()
+		{
+			return m_allocator;
+		}
+		[[nodiscard]] size GetReservedSize() const
+		{
+			return m_arena.GetReservedSize();
+		}
+	protected:
+		Memory::Arena m_arena;
+		Internal::RapidJsonAllocator m_allocator;
+	};
+}
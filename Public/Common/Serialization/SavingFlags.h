@@ -8,7 +8,10 @@ namespace ngine::Serialization
 	{
 		//! Whether the serialized data is intended to be read by a human
 		//! Implies that formatting should be applied.
-		HumanReadable = 1 << 0
+		HumanReadable = 1 << 0,
+		//! Whether to save in the compact binary format instead of JSON, see BinaryData.h
+		//! Binary data is loaded transparently by Data, formatting flags are ignored.
+		Binary = 1 << 1
 	};
 	ENUM_FLAG_OPERATORS(SavingFlags);
 }
@@ -1,19 +1,38 @@
 #pragma once
 
 #include "SavingFlags.h"
+#include "BinaryData.h"
 
 #include <Common/Serialization/ForwardDeclarations/SerializedData.h>
 #include <Common/Serialization/Common.h>
 #include <Common/Serialization/Context.h>
+#include <Common/Serialization/DocumentArena.h>
 #include <Common/EnumFlags.h>
 #include <Common/Memory/Containers/StringBase.h>
 #include <Common/Memory/Containers/Vector.h>
 #include <Common/EnumFlags.h>
 #include <Common/IO/File.h>
+#include <Common/IO/MappedFile.h>
 #include <Common/IO/ForwardDeclarations/ZeroTerminatedPathView.h>
 
 namespace ngine::Serialization
 {
+	//! Indicates that JSON text should be parsed in-situ, decoding strings in place in a buffer owned by the data
+	enum class ParseInSituType : uint8
+	{
+		ParseInSitu
+	};
+	//! Indicates that JSON text should be parsed in-situ, decoding strings in place in a buffer owned by the data
+	inline static constexpr ParseInSituType ParseInSitu = ParseInSituType::ParseInSitu;
+
+	//! Indicates that the data will only be read, allowing its document to be allocated from a DocumentArena
+	enum class ReadOnlyType : uint8
+	{
+		ReadOnly
+	};
+	//! Indicates that the data will only be read, allowing its document to be allocated from a DocumentArena
+	inline static constexpr ReadOnlyType ReadOnly = ReadOnlyType::ReadOnly;
+
 	struct Data
 	{
 		Data(const EnumFlags<ContextFlags> contextFlags = {})
@@ -23,36 +42,61 @@ namespace ngine::Serialization
 		}
 
 		Data(const IO::ConstZeroTerminatedPathView filePath)
-			: Data(IO::File(filePath, IO::AccessModeFlags::ReadBinary, IO::SharingFlags::DisallowWrite))
+			: m_contextFlags(ContextFlags::FromDisk)
 		{
+			ParsePath(filePath);
 		}
 
 		Data(const IO::FileView jsonFile)
 			: m_contextFlags(ContextFlags::FromDisk)
 		{
-			if (jsonFile.IsValid())
-			{
-				const uint32 size = static_cast<uint32>(jsonFile.GetSize());
-				FixedSizeVector<char, uint32> jsonContents(Memory::ConstructWithSize, Memory::Zeroed, size);
-				if (LIKELY(jsonFile.ReadIntoView(jsonContents.GetView())))
-				{
-					m_document.Parse(jsonContents.GetData(), jsonContents.GetSize());
-				}
-				else
-				{
-					m_document = Document(rapidjson::Type::kNullType);
-				}
-			}
-			else
-			{
-				m_document = Document(rapidjson::Type::kNullType);
-			}
+			ParseFile(jsonFile);
+		}
+
+		//! Reads the file into a buffer kept alive by the data and parses it in place, strings reference the buffer instead of being copied
+		//! Mapped files are read-only and not zero terminated, so the file is read instead of mapped
+		Data(const IO::ConstZeroTerminatedPathView filePath, const ParseInSituType)
+			: m_contextFlags(ContextFlags::FromDisk)
+		{
+			ParseFileInSitu(IO::File(filePath, IO::AccessModeFlags::ReadBinary, IO::SharingFlags::DisallowWrite));
+		}
+
+		Data(const IO::FileView jsonFile, const ParseInSituType)
+			: m_contextFlags(ContextFlags::FromDisk)
+		{
+			ParseFileInSitu(jsonFile);
 		}
 
 		Data(const ConstStringView jsonData)
 			: m_contextFlags(ContextFlags::FromBuffer)
 		{
-			m_document.Parse(jsonData.GetData(), jsonData.GetSize());
+			Parse(jsonData.GetData(), jsonData.GetSize());
+		}
+
+		//! Allocates the document from an arena that is released as a whole with the data, instead of allocating each value and string
+		//! The document must not be modified
+		Data(const IO::ConstZeroTerminatedPathView filePath, const ReadOnlyType)
+			: m_pArena(DocumentArena::Acquire())
+			, m_document(&m_pArena->GetAllocator())
+			, m_contextFlags(ContextFlags::FromDisk)
+		{
+			ParsePath(filePath);
+		}
+
+		Data(const IO::FileView jsonFile, const ReadOnlyType)
+			: m_pArena(DocumentArena::Acquire())
+			, m_document(&m_pArena->GetAllocator())
+			, m_contextFlags(ContextFlags::FromDisk)
+		{
+			ParseFile(jsonFile);
+		}
+
+		Data(const ConstStringView jsonData, const ReadOnlyType)
+			: m_pArena(DocumentArena::Acquire())
+			, m_document(&m_pArena->GetAllocator())
+			, m_contextFlags(ContextFlags::FromBuffer)
+		{
+			Parse(jsonData.GetData(), jsonData.GetSize());
 		}
 
 		Data(const rapidjson::Type type, const EnumFlags<ContextFlags> contextFlags = {})
@@ -74,12 +118,47 @@ namespace ngine::Serialization
 		{
 		}
 
-		explicit Data(const Data& other) = default;
-		Data& operator=(const Data& other) = default;
+		//! Copies are allocated by their own document, they never need the in-situ buffer or arena of the source
+		explicit Data(const Data& other)
+			: m_document(rapidjson::Type::kNullType)
+			, m_contextFlags(other.m_contextFlags)
+		{
+			m_document.CopyFrom(other.m_document, m_document.GetAllocator());
+		}
+		Data& operator=(const Data& other)
+		{
+			if (this != &other)
+			{
+				ReleaseArena();
+				m_document.CopyFrom(other.m_document, m_document.GetAllocator());
+				m_contextFlags = other.m_contextFlags;
+				m_inSituBuffer = FixedSizeVector<char, size>();
+			}
+			return *this;
+		}
 		Data(Data&& other) = default;
-		Data& operator=(Data&& other) = default;
+		Data& operator=(Data&& other)
+		{
+			ReleaseArena();
+			m_pArena = Move(other.m_pArena);
+			m_document = Move(other.m_document);
+			m_contextFlags = other.m_contextFlags;
+			m_inSituBuffer = Move(other.m_inSituBuffer);
+			return *this;
+		}
+		~Data()
+		{
+			ReleaseArena();
+		}
+
+		[[nodiscard]] bool IsReadOnly() const
+		{
+			return m_pArena.IsValid();
+		}
+
 		[[nodiscard]] Document& GetDocument() LIFETIME_BOUND
 		{
+			Assert(!IsReadOnly(), "Read-only data must not be modified");
 			return m_document;
 		}
 		[[nodiscard]] bool IsValid() const
@@ -118,7 +197,12 @@ namespace ngine::Serialization
 		template<typename StringType>
 		StringType SaveToBuffer(const EnumFlags<SavingFlags> flags) const
 		{
-			if (flags.IsSet(SavingFlags::HumanReadable))
+			if (flags.IsSet(SavingFlags::Binary))
+			{
+				const Vector<ByteType, size> binaryData = EncodeBinaryData(m_document);
+				return StringType{reinterpret_cast<const char*>(binaryData.GetData()), (uint32)binaryData.GetSize()};
+			}
+			else if (flags.IsSet(SavingFlags::HumanReadable))
 			{
 				using StringBufferType = rapidjson::GenericStringBuffer<rapidjson::UTF8<>, Internal::RapidJsonAllocator>;
 				using PrettyWriterType =
@@ -159,7 +243,17 @@ namespace ngine::Serialization
 
 		[[nodiscard]] bool SaveToFile(const IO::ConstZeroTerminatedPathView filePath, const EnumFlags<SavingFlags> flags) const
 		{
-			if (flags.IsSet(SavingFlags::HumanReadable))
+			if (flags.IsSet(SavingFlags::Binary))
+			{
+				const Vector<ByteType, size> binaryData = EncodeBinaryData(m_document);
+				const IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+				if (UNLIKELY(!file.IsValid()))
+				{
+					return false;
+				}
+				return file.Write(binaryData.GetView()) == binaryData.GetSize();
+			}
+			else if (flags.IsSet(SavingFlags::HumanReadable))
 			{
 				using StringBufferType = rapidjson::GenericStringBuffer<rapidjson::UTF8<>, Internal::RapidJsonAllocator>;
 				using PrettyWriterType =
@@ -174,7 +268,100 @@ namespace ngine::Serialization
 			}
 		}
 	protected:
+		void ParsePath(const IO::ConstZeroTerminatedPathView filePath)
+		{
+			// Parse straight from the mapped file, avoids copying the whole file into a temporary buffer first
+			if (const IO::MappedFile mappedFile(filePath, IO::MappedFile::AccessPattern::Sequential); mappedFile.IsValid())
+			{
+				const ConstByteView contents = mappedFile.GetView();
+				Parse(reinterpret_cast<const char*>(contents.GetData()), contents.GetDataSize());
+			}
+			else
+			{
+				// Not a regular file, for example packaged assets
+				ParseFile(IO::File(filePath, IO::AccessModeFlags::ReadBinary, IO::SharingFlags::DisallowWrite));
+			}
+		}
+
+		//! Returns the arena to the cache of the calling thread, once the document no longer uses it
+		void ReleaseArena()
+		{
+			if (m_pArena.IsValid())
+			{
+				m_document = Document(rapidjson::Type::kNullType);
+				DocumentArena::Release(Move(m_pArena));
+			}
+		}
+
+		//! Parses JSON text, or decodes binary data when the contents start with BinaryDataMagic
+		void Parse(const char* pData, const size dataSize)
+		{
+			const ConstByteView contents{reinterpret_cast<const ByteType*>(pData), dataSize};
+			if (IsBinaryData(contents))
+			{
+				[[maybe_unused]] const bool wasDecoded = DecodeBinaryData(contents, m_document);
+			}
+			else
+			{
+				m_document.Parse(pData, dataSize);
+			}
+		}
+
+		void ParseFile(const IO::FileView jsonFile)
+		{
+			if (jsonFile.IsValid())
+			{
+				const uint32 size = static_cast<uint32>(jsonFile.GetSize());
+				FixedSizeVector<char, uint32> jsonContents(Memory::ConstructWithSize, Memory::Uninitialized, size);
+				if (LIKELY(jsonFile.ReadIntoView(jsonContents.GetView())))
+				{
+					Parse(jsonContents.GetData(), jsonContents.GetSize());
+				}
+				else
+				{
+					m_document = Document(rapidjson::Type::kNullType);
+				}
+			}
+			else
+			{
+				m_document = Document(rapidjson::Type::kNullType);
+			}
+		}
+
+		void ParseFileInSitu(const IO::FileView jsonFile)
+		{
+			if (jsonFile.IsValid())
+			{
+				const size fileSize = static_cast<size>(jsonFile.GetSize());
+				// Reserve space for the terminator the in-situ parser stops at
+				m_inSituBuffer = FixedSizeVector<char, size>(Memory::ConstructWithSize, Memory::Uninitialized, fileSize + 1);
+				if (LIKELY(jsonFile.ReadIntoView(m_inSituBuffer.GetSubView(0, fileSize))))
+				{
+					m_inSituBuffer[fileSize] = '\0';
+
+					const ConstByteView contents{reinterpret_cast<const ByteType*>(m_inSituBuffer.GetData()), fileSize};
+					if (IsBinaryData(contents))
+					{
+						// Decoded values own their strings, the buffer is not needed
+						[[maybe_unused]] const bool wasDecoded = DecodeBinaryData(contents, m_document);
+						m_inSituBuffer = FixedSizeVector<char, size>();
+					}
+					else
+					{
+						m_document.ParseInsitu(m_inSituBuffer.GetData());
+					}
+					return;
+				}
+				m_inSituBuffer = FixedSizeVector<char, size>();
+			}
+			m_document = Document(rapidjson::Type::kNullType);
+		}
+	protected:
+		//! Arena the values of read-only documents are allocated from, declared first as the document must be destroyed before it
+		UniquePtr<DocumentArena> m_pArena;
 		Document m_document;
 		EnumFlags<ContextFlags> m_contextFlags;
+		//! Source text of in-situ parsed documents, which strings of the document point into
+		FixedSizeVector<char, size> m_inSituBuffer;
 	};
 }
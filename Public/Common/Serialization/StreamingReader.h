@@ -0,0 +1,36 @@
+#pragma once
+
+#include <Common/Serialization/ForwardDeclarations/Reader.h>
+#include <Common/Serialization/Context.h>
+#include <Common/Memory/Containers/ForwardDeclarations/ByteView.h>
+#include <Common/Memory/Containers/ForwardDeclarations/StringView.h>
+#include <Common/IO/ForwardDeclarations/ZeroTerminatedPathView.h>
+#include <Common/Function/Function.h>
+#include <Common/EnumFlags.h>
+
+namespace ngine::Serialization
+{
+	//! Streaming deserialization of a large top-level object or array, such as the asset map of a .nassetdb file
+	//! The JSON text is parsed with SAX events and only the value currently passed to the callback is built into a document,
+	//! so memory use is bound by the largest member or element instead of the whole file.
+	//! Binary data is decoded into a full document first, and then iterated the same way.
+
+	//! Invoked for each member of the top-level object, return false to stop streaming
+	//! The reader is only valid for the duration of the call
+	using StreamMemberCallback = Function<bool(const ConstStringView name, const Reader reader), 24>;
+	//! Invoked for each element of the top-level array, return false to stop streaming
+	//! The reader is only valid for the duration of the call
+	using StreamElementCallback = Function<bool(const Reader reader), 24>;
+
+	//! @returns false if the data could not be parsed or the top-level value is not an object, stopping early is not a failure
+	[[nodiscard]] bool StreamObjectMembers(
+		const ConstByteView data, const StreamMemberCallback& callback, const EnumFlags<ContextFlags> contextFlags = ContextFlags::FromBuffer
+	);
+	[[nodiscard]] bool StreamObjectMembers(const IO::ConstZeroTerminatedPathView filePath, const StreamMemberCallback& callback);
+
+	//! @returns false if the data could not be parsed or the top-level value is not an array, stopping early is not a failure
+	[[nodiscard]] bool StreamArrayElements(
+		const ConstByteView data, const StreamElementCallback& callback, const EnumFlags<ContextFlags> contextFlags = ContextFlags::FromBuffer
+	);
+	[[nodiscard]] bool StreamArrayElements(const IO::ConstZeroTerminatedPathView filePath, const StreamElementCallback& callback);
+}
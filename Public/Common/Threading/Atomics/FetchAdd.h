@@ -58,6 +58,20 @@ namespace ngine::Threading::Atomics
 		return __atomic_fetch_add(&storedValue, value, __ATOMIC_SEQ_CST);
 #else
 		return reinterpret_cast<std::atomic<Type>&>(storedValue).fetch_add(value);
+#endif
+	}
+
+	//! Adds without ordering guarantees, for counters that are only aggregated and don't publish other data
+	template<typename Type>
+	FORCE_INLINE Type FetchAddRelaxed(Type& storedValue, const Type value)
+	{
+#if COMPILER_MSVC
+		// MSVC only exposes relaxed interlocked operations on ARM
+		return FetchAdd(storedValue, value);
+#elif COMPILER_CLANG || COMPILER_GCC
+		return __atomic_fetch_add(&storedValue, value, __ATOMIC_RELAXED);
+#else
+		return reinterpret_cast<std::atomic<Type>&>(storedValue).fetch_add(value, std::memory_order_relaxed);
 #endif
 	}
 }
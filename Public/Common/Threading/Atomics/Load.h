@@ -78,6 +78,20 @@ namespace ngine::Threading::Atomics
 #endif
 	}
 
+	//! Loads without ordering guarantees, for counters that are only aggregated and don't publish other data
+	template<typename Type>
+	[[nodiscard]] FORCE_INLINE NO_DEBUG Type LoadRelaxed(const Type& value)
+	{
+#if COMPILER_MSVC
+		// Volatile loads don't emit fences on MSVC
+		return Load(value);
+#elif COMPILER_CLANG || COMPILER_GCC
+		return __atomic_load_n(&value, __ATOMIC_RELAXED);
+#else
+		return reinterpret_cast<const std::atomic<Type>&>(value).load(std::memory_order_relaxed);
+#endif
+	}
+
 	template<typename Type>
 	[[nodiscard]] FORCE_INLINE NO_DEBUG Type* Load(Type* const & value)
 	{
@@ -4,6 +4,21 @@
 
 #if COMPILER_MSVC
 #include "Exchange.h"
+
+extern "C"
+{
+	void __iso_volatile_store8(char volatile *, char);
+	void __iso_volatile_store16(short volatile *, short);
+	void __iso_volatile_store32(int volatile *, int);
+	void __iso_volatile_store64(__int64 volatile *, __int64);
+};
+
+#pragma intrinsic(__iso_volatile_store8)
+#pragma intrinsic(__iso_volatile_store16)
+#pragma intrinsic(__iso_volatile_store32)
+#if PLATFORM_64BIT
+#pragma intrinsic(__iso_volatile_store64)
+#endif // PLATFORM_64BIT
 #elif !COMPILER_CLANG && !COMPILER_GCC
 #include <atomic>
 #endif
@@ -19,6 +34,38 @@ namespace ngine::Threading::Atomics
 		__atomic_store_n(&target, value, __ATOMIC_SEQ_CST);
 #else
 		reinterpret_cast<std::atomic<Type>&>(target).store(value);
+#endif
+	}
+
+	//! Stores without ordering guarantees, for counters that are only aggregated and don't publish other data
+	template<typename Type>
+	FORCE_INLINE NO_DEBUG void StoreRelaxed(Type& target, const Type& value)
+	{
+#if COMPILER_MSVC
+		if constexpr (sizeof(Type) == 1)
+		{
+			__iso_volatile_store8(reinterpret_cast<volatile char*>(&target), static_cast<char>(value));
+		}
+		else if constexpr (sizeof(Type) == 2)
+		{
+			__iso_volatile_store16(reinterpret_cast<volatile short*>(&target), static_cast<short>(value));
+		}
+		else if constexpr (sizeof(Type) == 4)
+		{
+			__iso_volatile_store32(reinterpret_cast<volatile int*>(&target), static_cast<int>(value));
+		}
+		else if constexpr (sizeof(Type) == 8)
+		{
+			__iso_volatile_store64(reinterpret_cast<volatile __int64*>(&target), static_cast<__int64>(value));
+		}
+		else
+		{
+			static_unreachable("Unsupported type size!");
+		}
+#elif COMPILER_CLANG || COMPILER_GCC
+		__atomic_store_n(&target, value, __ATOMIC_RELAXED);
+#else
+		reinterpret_cast<std::atomic<Type>&>(target).store(value, std::memory_order_relaxed);
 #endif
 	}
 }
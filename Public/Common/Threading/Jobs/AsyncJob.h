@@ -3,6 +3,7 @@
 #include "Job.h"
 #include "JobManager.h"
 #include "CallbackResult.h"
+#include "JobRunnerMemoryPool.h"
 
 #include <Common/Time/Duration.h>
 #include <Common/TypeTraits/ReturnType.h>
@@ -14,7 +15,7 @@
 
 namespace ngine::Threading
 {
-	struct AsyncCallbackJobBase : public Threading::Job
+	struct AsyncCallbackJobBase : public Threading::Job, public JobRunnerPoolAllocated
 	{
 		AsyncCallbackJobBase(const Priority priority, [[maybe_unused]] const ConstStringView name = {})
 			: Job(priority)
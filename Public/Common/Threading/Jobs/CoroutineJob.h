@@ -0,0 +1,284 @@
+#pragma once
+
+#include <Common/Platform/CppVersion.h>
+
+#if CPP_VERSION >= 20 && __has_include(<coroutine>)
+#define HAS_COROUTINE_JOBS 1
+#else
+#define HAS_COROUTINE_JOBS 0
+#endif
+
+#if HAS_COROUTINE_JOBS
+#include "Job.h"
+#include "JobBatch.h"
+#include "JobRunnerThread.h"
+#include "JobRunnerMemoryPool.h"
+#include "IntermediateStage.h"
+
+#include <Common/TypeTraits/IsSame.h>
+
+#include <coroutine>
+
+namespace ngine::Threading
+{
+	//! Return type of coroutines that run as a job
+	//! The coroutine starts suspended and runs when the job is queued, either directly or as part of a batch
+	//! Awaiting jobs, batches or stages suspends the coroutine without blocking the runner, it resumes once the awaited work finished
+	//! The frame is allocated from the pool of the runner that created it, and destroyed when the coroutine finishes
+	//! Subsequent stages of the job are executed after the coroutine finished
+	//! Coroutines must take a JobPriority argument, which is used as the initial priority of the job
+	struct CoroutineJob
+	{
+		struct promise_type;
+		using Handle = std::coroutine_handle<promise_type>;
+
+		struct promise_type final : public Job
+		{
+			template<typename... ArgumentTypes>
+			promise_type(const ArgumentTypes&... arguments)
+				: Job(GetInitialPriority(arguments...))
+			{
+			}
+
+			[[nodiscard]] RESTRICTED_RETURN static void* operator new(const size frameSize) noexcept
+			{
+				return JobRunnerMemoryPool::AllocateFromCurrent(frameSize);
+			}
+			static void operator delete(void* pFrame, const size frameSize) noexcept
+			{
+				JobRunnerMemoryPool::DeallocateFromCurrent(pFrame, frameSize);
+			}
+
+			[[nodiscard]] static CoroutineJob get_return_object_on_allocation_failure() noexcept
+			{
+				return CoroutineJob{};
+			}
+			[[nodiscard]] CoroutineJob get_return_object() noexcept
+			{
+				return CoroutineJob{*this};
+			}
+			[[nodiscard]] std::suspend_always initial_suspend() const noexcept
+			{
+				return {};
+			}
+			[[nodiscard]] std::suspend_always final_suspend() const noexcept
+			{
+				return {};
+			}
+			void return_void() const noexcept
+			{
+			}
+			void unhandled_exception() const noexcept
+			{
+				ExpectUnreachable();
+			}
+
+			//! Changes the priority the coroutine is resumed with, must only be called while suspended
+			void SetResumePriority(const Priority priority)
+			{
+				SetPriority(priority);
+			}
+
+			//! Signaled once by the awaited work and once by the runner after the coroutine suspended
+			//! The last signal queues the job again, as the job can't be queued while it is still executing
+			void SignalSuspensionEvent(JobRunnerThread& thread)
+			{
+				if (m_remainingSuspensionEventCount.FetchSubtract(1) == 1)
+				{
+					m_remainingSuspensionEventCount = 2;
+					Queue(thread);
+				}
+			}
+
+#if STAGE_DEPENDENCY_PROFILING
+			[[nodiscard]] virtual ConstZeroTerminatedStringView GetDebugName() const override
+			{
+				return "Coroutine Job";
+			}
+#endif
+		protected:
+			template<typename... ArgumentTypes>
+			[[nodiscard]] static Priority GetInitialPriority(const ArgumentTypes&... arguments)
+			{
+				static_assert((TypeTraits::IsSame<ArgumentTypes, Priority> || ...), "Coroutine jobs must take a JobPriority argument!");
+
+				Priority priority{};
+				bool foundPriority = false;
+				(
+					[&priority, &foundPriority, &arguments]()
+					{
+						if constexpr (TypeTraits::IsSame<ArgumentTypes, Priority>)
+						{
+							if (!foundPriority)
+							{
+								priority = arguments;
+								foundPriority = true;
+							}
+						}
+					}(),
+					...
+				);
+				return priority;
+			}
+
+			virtual Result OnExecute(JobRunnerThread&) override
+			{
+				Handle::from_promise(*this).resume();
+				// Either finished or suspended, in both cases we continue once the runner cleared the executing state
+				return Result::AwaitExternalFinish;
+			}
+
+			virtual void OnAwaitExternalFinish(JobRunnerThread& thread) override
+			{
+				if (Handle::from_promise(*this).done())
+				{
+					SignalExecutionFinishedAndDestroying(thread);
+				}
+				else
+				{
+					SignalSuspensionEvent(thread);
+				}
+			}
+
+			virtual void OnFinishedExecution(JobRunnerThread&) override
+			{
+				Assert(!HasSubsequentTasks());
+				Handle::from_promise(*this).destroy();
+			}
+		protected:
+			Threading::Atomic<uint8> m_remainingSuspensionEventCount{2};
+		};
+
+		CoroutineJob() = default;
+
+		[[nodiscard]] bool IsValid() const
+		{
+			return m_pPromise != nullptr;
+		}
+
+		//! Gets the job that runs the coroutine, used to queue it or to add it to a batch
+		//! Only valid until the coroutine finished
+		[[nodiscard]] Job& GetJob() const
+		{
+			Assert(IsValid());
+			return *m_pPromise;
+		}
+	protected:
+		CoroutineJob(promise_type& promise)
+			: m_pPromise(&promise)
+		{
+		}
+	protected:
+		promise_type* m_pPromise = nullptr;
+	};
+
+	namespace Internal
+	{
+		//! Resumes a suspended coroutine once the awaited stage finished
+		//! Lives inside the coroutine frame, so awaiting doesn't allocate a continuation job
+		struct CoroutineResumeStage final : public IntermediateStage
+		{
+			virtual void OnDependenciesResolved(JobRunnerThread& thread) override
+			{
+				m_pPromise->SignalSuspensionEvent(thread);
+			}
+
+			CoroutineJob::promise_type* m_pPromise = nullptr;
+		};
+
+		struct StageAwaiter
+		{
+			StageAwaiter(StageBase& awaitedStage, const JobBatch startBatch, const JobPriority resumePriority)
+				: m_awaitedStage(awaitedStage)
+				, m_startBatch(startBatch)
+				, m_resumePriority(resumePriority)
+			{
+			}
+			StageAwaiter(const StageAwaiter&) = delete;
+			StageAwaiter& operator=(const StageAwaiter&) = delete;
+			StageAwaiter(StageAwaiter&&) = delete;
+			StageAwaiter& operator=(StageAwaiter&&) = delete;
+
+			[[nodiscard]] bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			void await_suspend(const CoroutineJob::Handle handle)
+			{
+				CoroutineJob::promise_type& promise = handle.promise();
+				promise.SetResumePriority(m_resumePriority);
+				m_resumeStage.m_pPromise = &promise;
+				m_awaitedStage.AddSubsequentStage(m_resumeStage);
+
+				JobRunnerThread& thread = *JobRunnerThread::GetCurrent();
+				if (m_startBatch.IsValid())
+				{
+					thread.Queue(m_startBatch);
+				}
+			}
+
+			void await_resume()
+			{
+				// Stages destroyed on completion have already unlinked us, others keep us around until removed
+				if (m_resumeStage.HasDependencies())
+				{
+					m_awaitedStage.RemoveSubsequentStage(m_resumeStage, JobRunnerThread::GetCurrent(), StageBase::RemovalFlags{});
+				}
+			}
+		protected:
+			StageBase& m_awaitedStage;
+			JobBatch m_startBatch;
+			JobPriority m_resumePriority;
+			CoroutineResumeStage m_resumeStage;
+		};
+
+		struct PriorityAwaiter
+		{
+			[[nodiscard]] bool await_ready() const noexcept
+			{
+				return false;
+			}
+
+			void await_suspend(const CoroutineJob::Handle handle) const
+			{
+				CoroutineJob::promise_type& promise = handle.promise();
+				promise.SetResumePriority(m_resumePriority);
+				promise.SignalSuspensionEvent(*JobRunnerThread::GetCurrent());
+			}
+
+			void await_resume() const noexcept
+			{
+			}
+
+			JobPriority m_resumePriority;
+		};
+	}
+
+	//! Queues the job and suspends the coroutine until it finished, resuming with the specified priority
+	[[nodiscard]] inline Internal::StageAwaiter Await(Job& job, const JobPriority resumePriority)
+	{
+		return Internal::StageAwaiter{job, JobBatch{&job}, resumePriority};
+	}
+
+	//! Queues the batch and suspends the coroutine until its finish stage executed, resuming with the specified priority
+	[[nodiscard]] inline Internal::StageAwaiter Await(const JobBatch& jobBatch, const JobPriority resumePriority)
+	{
+		Assert(jobBatch.IsValid());
+		return Internal::StageAwaiter{jobBatch.GetFinishedStage(), jobBatch, resumePriority};
+	}
+
+	//! Suspends the coroutine until a stage that was already queued executes, resuming with the specified priority
+	//! The stage must not have finished before the coroutine starts awaiting it
+	[[nodiscard]] inline Internal::StageAwaiter AwaitStage(StageBase& stage, const JobPriority resumePriority)
+	{
+		return Internal::StageAwaiter{stage, JobBatch{}, resumePriority};
+	}
+
+	//! Suspends the coroutine and queues it again with a new priority
+	[[nodiscard]] inline Internal::PriorityAwaiter SwitchPriority(const JobPriority priority)
+	{
+		return Internal::PriorityAwaiter{priority};
+	}
+}
+#endif
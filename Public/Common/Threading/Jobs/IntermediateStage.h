@@ -1,6 +1,7 @@
 #pragma once
 
 #include "StageBase.h"
+#include "JobRunnerMemoryPool.h"
 
 #include <Common/Threading/Mutexes/ConditionVariable.h>
 
@@ -40,7 +41,7 @@ namespace ngine::Threading
 		}
 	};
 
-	struct DynamicIntermediateStage final : public IntermediateStage
+	struct DynamicIntermediateStage final : public IntermediateStage, public JobRunnerPoolAllocated
 	{
 		using IntermediateStage::IntermediateStage;
 
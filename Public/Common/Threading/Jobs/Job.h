@@ -10,6 +10,8 @@
 #include <Common/AtomicEnumFlags.h>
 #include <Common/Threading/AtomicEnum.h>
 #include <Common/Threading/AtomicInteger.h>
+#include <Common/Memory/Allocators/MemoryUsage.h>
+#include <Common/Memory/UniquePtr.h>
 
 namespace ngine::Threading
 {
@@ -24,6 +26,18 @@ namespace ngine::Threading
 	};
 	ENUM_FLAG_OPERATORS(JobStateFlags);
 
+	//! Indicates how close to the queuing runner a job should stay when other runners steal work
+	//! Useful for jobs that operate on data that is likely to still be in the queuing runner's cache
+	enum class JobLocalityHint : uint8
+	{
+		//! Any runner may steal the job
+		None,
+		//! Only runners on the same NUMA node may steal the job
+		SharedNumaNode,
+		//! Only runners sharing the last level cache may steal the job
+		SharedCache
+	};
+
 	//! Represents a step of the work that needs to be done for a scene in a given frame
 	//! An example of a stage can be component type update, a render stage, or
 	//! Stages can depend on each other, so that a dependee only runs when it's dependencies are ready
@@ -34,11 +48,16 @@ namespace ngine::Threading
 		using Priority = JobPriority;
 		using Result = CallbackResult;
 		using StateFlags = JobStateFlags;
+		using LocalityHint = JobLocalityHint;
 
-		Job(const Priority priority, const JobRunnerMask allowedJobRunnerMask = Math::NumericLimits<JobRunnerMask>::Max)
+		Job(const Priority priority)
+			: m_priority(priority)
+		{
+		}
+		Job(const Priority priority, const JobRunnerMask& allowedJobRunnerMask)
 			: m_priority(priority)
-			, m_allowedJobRunnerMask(allowedJobRunnerMask)
 		{
+			SetAllowedJobRunnerMask(allowedJobRunnerMask);
 		}
 		Job(const Job&) = delete;
 		Job& operator=(const Job&) = delete;
@@ -90,9 +109,67 @@ namespace ngine::Threading
 		{
 			return m_priority;
 		}
+		//! Gets the runners the job is allowed to execute on, all runners unless it opted in for explicit runner selection
 		[[nodiscard]] PURE_STATICS JobRunnerMask GetAllowedJobRunnerMask() const
 		{
-			return m_allowedJobRunnerMask;
+			switch (m_runnerAffinity)
+			{
+				case RunnerAffinity::Any:
+					return JobRunnerMask{Memory::SetAll};
+				case RunnerAffinity::Exclusive:
+				{
+					JobRunnerMask mask;
+					mask.Set(m_exclusiveRunnerIndex);
+					return mask;
+				}
+				case RunnerAffinity::Custom:
+					return *m_pCustomRunnerMask;
+			}
+			ExpectUnreachable();
+		}
+		//! Whether the job has not opted in for explicit runner selection
+		[[nodiscard]] PURE_STATICS bool CanRunOnAnyRunner() const
+		{
+			return m_runnerAffinity == RunnerAffinity::Any;
+		}
+		[[nodiscard]] PURE_STATICS bool CanRunOnRunner(const uint8 runnerIndex) const
+		{
+			switch (m_runnerAffinity)
+			{
+				case RunnerAffinity::Any:
+					return true;
+				case RunnerAffinity::Exclusive:
+					return m_exclusiveRunnerIndex == runnerIndex;
+				case RunnerAffinity::Custom:
+					return m_pCustomRunnerMask->IsSet(runnerIndex);
+			}
+			ExpectUnreachable();
+		}
+		[[nodiscard]] PURE_STATICS bool IsExclusiveToRunner(const uint8 runnerIndex) const
+		{
+			return (m_runnerAffinity == RunnerAffinity::Exclusive) & (m_exclusiveRunnerIndex == runnerIndex);
+		}
+
+		[[nodiscard]] PURE_STATICS LocalityHint GetLocalityHint() const
+		{
+			return m_localityHint;
+		}
+		//! Restricts which runners may steal this job when work stealing is enabled
+		void SetLocalityHint(const LocalityHint hint)
+		{
+			Assert(!IsQueued(), "Job locality must not be changed while queued!");
+			m_localityHint = hint;
+		}
+
+		//! Tag that allocations made while executing the job are attributed to
+		//! Defaults to the tag active on the thread that created the job, see Memory::UsageTagScope
+		[[nodiscard]] PURE_STATICS Memory::UsageTag GetUsageTag() const
+		{
+			return m_usageTag;
+		}
+		void SetUsageTag(const Memory::UsageTag tag)
+		{
+			m_usageTag = tag;
 		}
 
 		[[nodiscard]] PURE_STATICS bool IsLowPriorityPerformanceJob() const
@@ -124,14 +201,25 @@ namespace ngine::Threading
 			Assert(!IsQueued(), "Job priority must not be changed while queued!");
 			m_priority = priority;
 		}
-		void SetAllowedJobRunnerMask(const JobRunnerMask mask)
-		{
-			m_allowedJobRunnerMask = mask;
-		}
+		void SetAllowedJobRunnerMask(const JobRunnerMask& mask);
 		void SetExclusiveToThread(JobRunnerThread& thread);
 	private:
+		//! Which runners the job may execute on, the full mask is only stored for the rare custom case
+		enum class RunnerAffinity : uint8
+		{
+			Any,
+			Exclusive,
+			Custom
+		};
+
 		Atomic<Priority> m_priority;
 		AtomicEnumFlags<StateFlags> m_stateFlags;
-		Atomic<JobRunnerMask> m_allowedJobRunnerMask{Math::NumericLimits<JobRunnerMask>::Max};
+		RunnerAffinity m_runnerAffinity = RunnerAffinity::Any;
+		uint8 m_exclusiveRunnerIndex = 0;
+		LocalityHint m_localityHint = LocalityHint::None;
+		Memory::UsageTag m_usageTag = Memory::GetCurrentUsageTag();
+		//! Allowed runners when m_runnerAffinity is Custom
+		//! Stored out of line, so that jobs that can run anywhere or on a single runner don't carry a mask for every possible runner
+		UniquePtr<JobRunnerMask> m_pCustomRunnerMask;
 	};
 }
@@ -16,6 +16,11 @@
 
 #include "JobPriority.h"
 
+namespace ngine::Platform
+{
+	struct ProcessorTopology;
+}
+
 namespace ngine::Threading
 {
 	struct Job;
@@ -23,10 +28,19 @@ namespace ngine::Threading
 	struct JobRunnerThread;
 
 	//! Work sharing based job system
+	//! Can optionally run in work stealing mode, see SchedulingMode.
 	struct JobManager
 	{
 		inline static constexpr System::Type SystemType = System::Type::JobManager;
 
+		enum class SchedulingMode : uint8
+		{
+			//! Runners actively push queued jobs to idle runners
+			WorkSharing,
+			//! Runners publish shareable jobs in a lock-free per-runner deque, idle runners steal from other runners' deques
+			WorkStealing
+		};
+
 		JobManager();
 		JobManager(const JobManager&) = delete;
 		JobManager& operator=(const JobManager&) = delete;
@@ -51,6 +65,22 @@ namespace ngine::Threading
 			);
 		}
 
+		//! Selects how work is distributed across runners
+		//! Must be called before starting the runners
+		void SetSchedulingMode(const SchedulingMode mode)
+		{
+			Assert(m_jobThreads.IsEmpty(), "Scheduling mode must be set before starting runners");
+			m_schedulingMode = mode;
+		}
+		[[nodiscard]] PURE_STATICS SchedulingMode GetSchedulingMode() const
+		{
+			return m_schedulingMode;
+		}
+		[[nodiscard]] PURE_STATICS bool IsWorkStealingEnabled() const
+		{
+			return m_schedulingMode == SchedulingMode::WorkStealing;
+		}
+
 		using ConstJobThreadView = ArrayView<ReferenceWrapper<const JobRunnerThread>, uint8>;
 		using JobThreadView = ArrayView<ReferenceWrapper<JobRunnerThread>, uint8>;
 
@@ -71,35 +101,31 @@ namespace ngine::Threading
 
 		bool MarkThreadAsIdle(const uint8 threadIndex)
 		{
-			const JobRunnerMask threadMask = 1ull << threadIndex;
-			const JobRunnerMask previousMask = m_idleThreadMask.FetchOr(threadMask);
-			return (previousMask & threadMask) == 0;
+			return m_idleThreadMask.Set(threadIndex);
 		}
 		bool ClearThreadIdleFlag(const uint8 threadIndex)
 		{
-			const JobRunnerMask threadMask = 1ull << threadIndex;
-			const JobRunnerMask previousMask = m_idleThreadMask.FetchAnd(~threadMask);
-			return (previousMask & threadMask) != 0;
+			return m_idleThreadMask.Clear(threadIndex);
 		}
 		[[nodiscard]] bool IsThreadIdle(const uint8 threadIndex) const
 		{
-			return m_idleThreadMask & (1ull << threadIndex);
+			return m_idleThreadMask.IsSet(threadIndex);
 		}
 
-		[[nodiscard]] JobRunnerMask GetPerformanceHighPriorityThreadMask() const
+		[[nodiscard]] const JobRunnerMask& GetPerformanceHighPriorityThreadMask() const
 		{
 			return m_performanceHighPriorityThreadMask;
 		}
-		[[nodiscard]] JobRunnerMask GetPerformanceLowPriorityThreadMask() const
+		[[nodiscard]] const JobRunnerMask& GetPerformanceLowPriorityThreadMask() const
 		{
 			return m_performanceLowPriorityThreadMask;
 		}
-		[[nodiscard]] JobRunnerMask GetEfficiencyThreadMask() const
+		[[nodiscard]] const JobRunnerMask& GetEfficiencyThreadMask() const
 		{
 			return m_efficiencyThreadMask;
 		}
 
-		[[nodiscard]] PURE_STATICS JobRunnerMask GetPreferredRunnerMask(JobPriority jobPriority)
+		[[nodiscard]] PURE_STATICS const JobRunnerMask& GetPreferredRunnerMask(JobPriority jobPriority)
 		{
 			// Job did not filter for any specific runners, select based on priority
 			const bool isHighPriorityPerformanceJob = jobPriority < JobPriority::FirstUserVisibleBackground;
@@ -109,58 +135,64 @@ namespace ngine::Threading
 			                                    : (isLowPriorityPerformanceJob ? m_performanceLowPriorityThreadMask : m_efficiencyThreadMask);
 		}
 
-		[[nodiscard]] JobRunnerMask StealIdleThreads(uint8 maxCount, const JobRunnerMask allowedMask)
+		[[nodiscard]] JobRunnerMask StealIdleThreads(uint8 maxCount, const JobRunnerMask& allowedMask)
 		{
+			JobRunnerMask stolenIdleThreadMask;
 			if (maxCount == 0)
 			{
-				return 0;
+				return stolenIdleThreadMask;
 			}
 
-			JobRunnerMask stolenIdleThreadMask = 0u;
-			JobRunnerMask iteratedMask = m_idleThreadMask & allowedMask;
-			for (const uint8 threadIndex : Memory::GetSetBitsIterator(iteratedMask))
+			// Only visit the blocks that contain runners, a single block for up to 64 runners
+			for (uint8 blockIndex = 0; blockIndex < m_usedRunnerMaskBlockCount; ++blockIndex)
 			{
-				const JobRunnerMask threadMask = 1ull << threadIndex;
-
-				JobRunnerMask storedMask = iteratedMask | (m_idleThreadMask & ~allowedMask);
-
-				if (m_idleThreadMask.CompareExchangeStrong(storedMask, storedMask & ~threadMask))
+				const JobRunnerMaskBlock allowedBlock = allowedMask.GetBlock(blockIndex);
+				JobRunnerMaskBlock idleBlock = m_idleThreadMask.LoadBlock(blockIndex);
+				JobRunnerMaskBlock iteratedBlock = idleBlock & allowedBlock;
+				for (const uint8 blockBitIndex : Memory::GetSetBitsIterator(iteratedBlock))
 				{
-					stolenIdleThreadMask |= threadMask;
-					iteratedMask &= ~threadMask;
-					maxCount--;
-					if (maxCount == 0)
+					const JobRunnerMaskBlock threadBit = JobRunnerMaskBlock(1ull << blockBitIndex);
+
+					JobRunnerMaskBlock storedBlock = iteratedBlock | (idleBlock & ~allowedBlock);
+					if (m_idleThreadMask.CompareExchangeBlock(blockIndex, storedBlock, storedBlock & ~threadBit))
 					{
+						stolenIdleThreadMask.Set(uint16(blockIndex * JobRunnerMaskBitsPerBlock + blockBitIndex));
+						iteratedBlock &= ~threadBit;
+						idleBlock &= ~threadBit;
+						maxCount--;
+						if (maxCount == 0)
+						{
+							return stolenIdleThreadMask;
+						}
+					}
+					else
+					{
+						// Mask changed, settle for what we got so far
 						return stolenIdleThreadMask;
 					}
 				}
-				else
-				{
-					// Mask changed, settle for what we got so far
-					return stolenIdleThreadMask;
-				}
 			}
 
 			return stolenIdleThreadMask;
 		}
-		[[nodiscard]] Optional<uint8> StealFirstIdleThread(const JobRunnerMask allowedMask)
+		[[nodiscard]] Optional<uint8> StealFirstIdleThread(const JobRunnerMask& allowedMask)
 		{
 			const JobRunnerMask mask = StealIdleThreads(1, allowedMask);
-			const uint8 index = (uint8)Memory::GetNumberOfTrailingZeros(mask);
-			return Optional<uint8>(index, mask != 0);
+			const auto index = mask.GetFirstSetIndex();
+			return Optional<uint8>((uint8)*index, index.IsValid());
 		}
-		[[nodiscard]] void ReturnStolenIdleThreads(const JobRunnerMask mask)
+		void ReturnStolenIdleThreads(const JobRunnerMask& mask)
 		{
 			m_idleThreadMask |= mask;
 		}
 
 		[[nodiscard]] bool AreAllRunnersIdle() const
 		{
-			return Memory::GetNumberOfSetBits(m_idleThreadMask) == m_jobThreads.GetSize();
+			return m_idleThreadMask.GetNumberOfSetBits() == m_jobThreads.GetSize();
 		}
 		[[nodiscard]] uint8 GetNumberOfIdleThreads() const
 		{
-			return (uint8)Memory::GetNumberOfSetBits(m_idleThreadMask);
+			return (uint8)m_idleThreadMask.GetNumberOfSetBits();
 		}
 
 		[[nodiscard]] TimerHandle ScheduleAsyncJob(const Time::Durationf delay, Job& job);
@@ -195,19 +227,28 @@ namespace ngine::Threading
 
 		virtual void CreateJobRunners(const uint16 count);
 		virtual void DestroyJobRunners();
+
+		//! Assigns runners to processors so that consecutive runners share a NUMA node and last level cache
+		void AssignRunnerLocality(const Platform::ProcessorTopology& topology);
+		//! Restricts runner threads to the processors sharing their last level cache
+		void PinRunnersToCacheDomains(const Platform::ProcessorTopology& topology);
 	protected:
 		void* m_pJobThreadData = nullptr;
-		// Currently limited by Windows API
-		inline static constexpr uint8 MaximumRunnerCount = 64;
+		inline static constexpr uint8 MaximumRunnerCount = MaximumJobRunnerCount;
 		using JobThreads = FlatVector<ReferenceWrapper<JobRunnerThread>, MaximumRunnerCount>;
 		JobThreads m_jobThreads;
 		Array<JobRunnerThread*, MaximumRunnerCount> m_jobThreadIdLookup = {};
-		Threading::Atomic<JobRunnerMask> m_idleThreadMask = 0;
+		AtomicJobRunnerMask m_idleThreadMask;
+		//! Number of mask blocks that contain at least one runner
+		uint8 m_usedRunnerMaskBlockCount = 0;
 		// Mask indicating which threads low priority and potentially slow tasks can run on
 		// This is also used to indicate the opposite, very high priority tasks will not be allowed on low priority threads
-		JobRunnerMask m_performanceLowPriorityThreadMask = 0;
-		JobRunnerMask m_performanceHighPriorityThreadMask = 0;
-		JobRunnerMask m_efficiencyThreadMask = 0;
+		JobRunnerMask m_performanceLowPriorityThreadMask;
+		JobRunnerMask m_performanceHighPriorityThreadMask;
+		JobRunnerMask m_efficiencyThreadMask;
+		//! Last level cache domain index of each runner's processor, see Platform::ProcessorTopology
+		Array<uint16, MaximumRunnerCount> m_runnerCacheDomainIndices{Memory::Zeroed};
+		SchedulingMode m_schedulingMode = SchedulingMode::WorkSharing;
 		//! Number of tasks that are currently executing outside of the job system
 		//! For example used by OS-level timer scheduling
 		Threading::Atomic<uint64> m_externalTaskCounter = 0;
@@ -1,6 +1,17 @@
 #pragma once
 
+#include <Common/Memory/Bitset.h>
+#include <Common/Memory/AtomicBitset.h>
+
 namespace ngine::Threading
 {
-	using JobRunnerMask = uint64;
+	//! Maximum number of job runners
+	//! Runner indices are stored as uint8, with the maximum value reserved as invalid
+	inline static constexpr uint8 MaximumJobRunnerCount = 255;
+
+	//! One bit per job runner, stored as 64-bit blocks so that testing a single runner is a single load
+	using JobRunnerMask = Bitset<256>;
+	using AtomicJobRunnerMask = AtomicBitset<256>;
+	inline static constexpr uint8 JobRunnerMaskBitsPerBlock = JobRunnerMask::BitsPerBlock;
+	using JobRunnerMaskBlock = typename JobRunnerMask::RawBlockType;
 }
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <Common/Memory/Allocators/Allocate.h>
+#include <Common/Memory/Containers/Array.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Threading/AtomicPtr.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Platform/Pure.h>
+#include <Common/Platform/Likely.h>
+
+#include <new>
+
+namespace ngine::Threading
+{
+	//! Caches size classed blocks for short lived allocations made by a job runner
+	//! Used for callback jobs, intermediate stages and coroutine frames
+	//! Blocks freed on the owning runner go straight back into its free lists
+	//! Blocks freed from other threads are pushed onto a lock-free list that the owner reclaims when its own list runs dry
+	//! Both lists are capped per size class, blocks beyond that go back to the global allocator.
+	//! Runners get their pool from Acquire, such pools live until the process exits so blocks can outlive the runner that allocated them.
+	//! A released pool is adopted by the next runner that is created.
+	struct JobRunnerMemoryPool
+	{
+		inline static constexpr uint8 SizeClassCount = 6;
+		inline static constexpr size MinimumBlockSize = 128;
+		inline static constexpr size MaximumBlockSize = MinimumBlockSize << (SizeClassCount - 1);
+		//! Maximum size cached by each of the local and remote free lists of a size class
+		inline static constexpr size MaximumCachedSizePerSizeClass = 64 * 1024;
+
+		JobRunnerMemoryPool() = default;
+		JobRunnerMemoryPool(const JobRunnerMemoryPool&) = delete;
+		JobRunnerMemoryPool& operator=(const JobRunnerMemoryPool&) = delete;
+		JobRunnerMemoryPool(JobRunnerMemoryPool&&) = delete;
+		JobRunnerMemoryPool& operator=(JobRunnerMemoryPool&&) = delete;
+		~JobRunnerMemoryPool()
+		{
+			ReleaseCachedBlocks();
+		}
+
+		//! Returns a pool released by a previous runner, or creates a new one
+		[[nodiscard]] static JobRunnerMemoryPool& Acquire();
+		//! Releases the cached blocks and makes the pool available to the next runner
+		//! Blocks still in use can be freed afterwards, the pool is never destroyed.
+		static void Release(JobRunnerMemoryPool& pool);
+
+		//! Returns all cached blocks to the global allocator
+		void ReleaseCachedBlocks()
+		{
+			for (uint8 sizeClass = 0; sizeClass < SizeClassCount; ++sizeClass)
+			{
+				ReleaseBlocks(m_freeBlocks[sizeClass]);
+				m_freeBlocks[sizeClass] = nullptr;
+				m_freeBlockCounts[sizeClass] = 0;
+				ReleaseBlocks(m_remotelyFreedBlocks[sizeClass].Exchange(nullptr));
+				m_remotelyFreedBlockCounts[sizeClass] = 0;
+			}
+		}
+
+		//! Pool of the job runner executing on this thread, invalid on other threads
+		[[nodiscard]] PURE_STATICS static Optional<JobRunnerMemoryPool*>& GetCurrent()
+		{
+			static thread_local Optional<JobRunnerMemoryPool*> pPool = nullptr;
+			return pPool;
+		}
+
+		//! Allocates a block, using the pool of the runner we are executing on when there is one
+		//! Must be released with Deallocate, passing the same size
+		[[nodiscard]] RESTRICTED_RETURN static void*
+		Allocate(const Optional<JobRunnerMemoryPool*> pCurrentPool, const size requestedSize) noexcept
+		{
+			const size blockSize = requestedSize + sizeof(BlockHeader);
+			BlockHeader* pBlock;
+			if (pCurrentPool.IsValid() && blockSize <= MaximumBlockSize)
+			{
+				pBlock = pCurrentPool->AllocateBlock(GetSizeClass(blockSize));
+			}
+			else
+			{
+				pBlock = static_cast<BlockHeader*>(Memory::Allocate(blockSize));
+				if (LIKELY(pBlock != nullptr))
+				{
+					pBlock->m_pOwner = nullptr;
+				}
+			}
+			return pBlock != nullptr ? pBlock + 1 : nullptr;
+		}
+
+		//! Releases a block returned by Allocate from any thread
+		static void Deallocate(const Optional<JobRunnerMemoryPool*> pCurrentPool, void* pData, const size requestedSize) noexcept
+		{
+			BlockHeader* pBlock = static_cast<BlockHeader*>(pData) - 1;
+			if (pBlock->m_pOwner == nullptr)
+			{
+				Memory::Deallocate(pBlock);
+				return;
+			}
+
+			const uint8 sizeClass = GetSizeClass(requestedSize + sizeof(BlockHeader));
+			const uint16 maximumCachedBlockCount = GetMaximumCachedBlockCount(sizeClass);
+			JobRunnerMemoryPool& owner = *pBlock->m_pOwner;
+			if (&owner == pCurrentPool.Get())
+			{
+				if (owner.m_freeBlockCounts[sizeClass] >= maximumCachedBlockCount)
+				{
+					Memory::Deallocate(pBlock);
+					return;
+				}
+
+				pBlock->m_pNext = owner.m_freeBlocks[sizeClass];
+				owner.m_freeBlocks[sizeClass] = pBlock;
+				owner.m_freeBlockCounts[sizeClass]++;
+			}
+			else
+			{
+				// The count is only an estimate, it is reset when the owner reclaims the list
+				if (owner.m_remotelyFreedBlockCounts[sizeClass].Load() >= maximumCachedBlockCount)
+				{
+					Memory::Deallocate(pBlock);
+					return;
+				}
+
+				// Only pushes happen concurrently and the owner detaches the full list, so the stack can't suffer from ABA
+				Threading::Atomic<BlockHeader*>& remotelyFreedBlocks = owner.m_remotelyFreedBlocks[sizeClass];
+				BlockHeader* pHead = remotelyFreedBlocks.Load();
+				do
+				{
+					pBlock->m_pNext = pHead;
+				} while (!remotelyFreedBlocks.CompareExchangeWeak(pHead, pBlock));
+				owner.m_remotelyFreedBlockCounts[sizeClass]++;
+			}
+		}
+
+		//! Allocates from the pool of the runner executing on this thread, or from the global allocator on other threads
+		[[nodiscard]] RESTRICTED_RETURN static void* AllocateFromCurrent(const size requestedSize) noexcept
+		{
+			return Allocate(GetCurrent(), requestedSize);
+		}
+		static void DeallocateFromCurrent(void* pData, const size requestedSize) noexcept
+		{
+			Deallocate(GetCurrent(), pData, requestedSize);
+		}
+	protected:
+		struct alignas(16) BlockHeader
+		{
+			JobRunnerMemoryPool* m_pOwner;
+			BlockHeader* m_pNext;
+		};
+
+		[[nodiscard]] PURE_STATICS static uint8 GetSizeClass(const size blockSize)
+		{
+			uint8 sizeClass = 0;
+			while ((MinimumBlockSize << sizeClass) < blockSize)
+			{
+				sizeClass++;
+			}
+			return sizeClass;
+		}
+
+		[[nodiscard]] PURE_STATICS static uint16 GetMaximumCachedBlockCount(const uint8 sizeClass)
+		{
+			return uint16(MaximumCachedSizePerSizeClass / (MinimumBlockSize << sizeClass));
+		}
+
+		[[nodiscard]] BlockHeader* AllocateBlock(const uint8 sizeClass)
+		{
+			BlockHeader* pBlock = m_freeBlocks[sizeClass];
+			if (pBlock == nullptr)
+			{
+				pBlock = ReclaimRemotelyFreedBlocks(sizeClass);
+				if (pBlock == nullptr)
+				{
+					pBlock = static_cast<BlockHeader*>(Memory::Allocate(MinimumBlockSize << sizeClass));
+					if (UNLIKELY(pBlock == nullptr))
+					{
+						return nullptr;
+					}
+					pBlock->m_pOwner = this;
+					return pBlock;
+				}
+			}
+
+			m_freeBlocks[sizeClass] = pBlock->m_pNext;
+			m_freeBlockCounts[sizeClass]--;
+			return pBlock;
+		}
+
+		//! Moves the blocks freed by other threads into the local free list, releasing those beyond the cap
+		[[nodiscard]] BlockHeader* ReclaimRemotelyFreedBlocks(const uint8 sizeClass)
+		{
+			BlockHeader* pFirstBlock = m_remotelyFreedBlocks[sizeClass].Exchange(nullptr);
+			m_remotelyFreedBlockCounts[sizeClass] = 0;
+
+			const uint16 maximumCachedBlockCount = GetMaximumCachedBlockCount(sizeClass);
+			uint16 blockCount = 0;
+			BlockHeader* pLastBlock = nullptr;
+			BlockHeader* pBlock = pFirstBlock;
+			while (pBlock != nullptr && blockCount < maximumCachedBlockCount)
+			{
+				pLastBlock = pBlock;
+				pBlock = pBlock->m_pNext;
+				blockCount++;
+			}
+			if (pLastBlock != nullptr)
+			{
+				pLastBlock->m_pNext = nullptr;
+			}
+			ReleaseBlocks(pBlock);
+
+			m_freeBlocks[sizeClass] = pFirstBlock;
+			m_freeBlockCounts[sizeClass] = blockCount;
+			return pFirstBlock;
+		}
+
+		static void ReleaseBlocks(BlockHeader* pBlock)
+		{
+			while (pBlock != nullptr)
+			{
+				BlockHeader* pNext = pBlock->m_pNext;
+				Memory::Deallocate(pBlock);
+				pBlock = pNext;
+			}
+		}
+	protected:
+		Array<BlockHeader*, SizeClassCount> m_freeBlocks{Memory::Zeroed};
+		Array<uint16, SizeClassCount> m_freeBlockCounts{Memory::Zeroed};
+		Array<Threading::Atomic<BlockHeader*>, SizeClassCount> m_remotelyFreedBlocks{Memory::Zeroed};
+		Array<Threading::Atomic<uint16>, SizeClassCount> m_remotelyFreedBlockCounts{Memory::Zeroed};
+
+		//! Next pool waiting to be adopted by a runner, see Release
+		JobRunnerMemoryPool* m_pNextReleasedPool{nullptr};
+	};
+
+	//! Base for objects that are frequently created and destroyed by jobs
+	//! Routes their allocations through the pool of the runner creating them instead of the global allocator
+	//! Types using this must have a virtual destructor when deleted through a base pointer, so the correct size is released
+	struct JobRunnerPoolAllocated
+	{
+		[[nodiscard]] RESTRICTED_RETURN static void* operator new(const size objectSize) noexcept
+		{
+			return JobRunnerMemoryPool::AllocateFromCurrent(objectSize);
+		}
+		static void operator delete(void* pObject, const size objectSize) noexcept
+		{
+			JobRunnerMemoryPool::DeallocateFromCurrent(pObject, objectSize);
+		}
+
+		//! Blocks are only aligned to 16 bytes, over-aligned types use the global allocator
+		[[nodiscard]] RESTRICTED_RETURN static void* operator new(const size objectSize, const std::align_val_t alignment) noexcept
+		{
+			return Memory::AllocateAligned(objectSize, static_cast<size>(alignment));
+		}
+		static void operator delete(void* pObject, const size, const std::align_val_t alignment) noexcept
+		{
+			Memory::DeallocateAligned(pObject, static_cast<size>(alignment));
+		}
+	};
+}
@@ -5,11 +5,12 @@
 #include <Common/Memory/ReferenceWrapper.h>
 #include <Common/Memory/Containers/Vector.h>
 #include <Common/Memory/UniqueRef.h>
-#include <Common/Memory/Allocators/Pool.h>
 #include <Common/Memory/DynamicBitset.h>
+#include <Common/Memory/Containers/WorkStealingQueue.h>
 #include <Common/Threading/AtomicInteger.h>
 #include <Common/Threading/Thread.h>
 #include <Common/Threading/Jobs/JobBatch.h>
+#include <Common/Threading/Jobs/JobRunnerMemoryPool.h>
 
 #if USE_PRIORITY_QUEUE
 #include <Common/Memory/Containers/PriorityQueue.h>
@@ -40,8 +41,10 @@ namespace ngine::Threading
 			HasJobsInLocalExclusiveQueue = 1 << 7,
 			HasJobsInThreadSafeQueue = 1 << 8,
 			HasJobsInThreadSafeExclusiveQueue = 1 << 9,
+			//! Indicates that the stealable queues may contain jobs, cleared by the owner once it fails to pop
+			HasJobsInStealableQueues = 1 << 11,
 			HasAnyJobsInQueues = HasJobsInLocalQueue | HasJobsInLocalExclusiveQueue | HasJobsInThreadSafeQueue |
-			                     HasJobsInThreadSafeExclusiveQueue,
+			                     HasJobsInThreadSafeExclusiveQueue | HasJobsInStealableQueues,
 			HasAnyJobsInThreadSafeQueues = HasJobsInThreadSafeQueue | HasJobsInThreadSafeExclusiveQueue,
 			HasNextJob = 1 << 10,
 			HasWork = HasAnyJobsInQueues | HasNextJob
@@ -56,6 +59,30 @@ namespace ngine::Threading
 
 		using ExclusiveJobQueue = Vector<ReferenceWrapper<Job>, uint16>;
 		using ThreadSafeQueue = Vector<ReferenceWrapper<Job>, uint16>;
+
+		//! Jobs published for stealing when the job manager runs in work stealing mode
+		//! Split per runner category so that thieves only touch jobs they are allowed to run
+		enum class StealableQueueType : uint8
+		{
+			HighPriorityPerformance,
+			LowPriorityPerformance,
+			Efficiency,
+			Count
+		};
+		inline static constexpr uint32 StealableQueueCapacity = 1024;
+		//! Number of thieves that may reject a job due to its locality hint before it can be stolen by any runner
+		//! Bounds how long a hinted job at the top of a queue can block the jobs behind it
+		inline static constexpr uint32 MaximumStealRejectionCount = 32;
+		using StealableQueue = TWorkStealingQueue<Job*, StealableQueueCapacity>;
+
+		//! Other runners grouped by how far away they are from this runner, thieves visit closer runners first
+		enum class LocalityDistance : uint8
+		{
+			SharedCache,
+			SharedNumaNode,
+			Remote,
+			Count
+		};
 	public:
 		using ThreadIndexType = uint8;
 
@@ -104,6 +131,12 @@ namespace ngine::Threading
 			return m_threadId;
 		}
 
+		//! Pool for short lived allocations made on this runner, see JobRunnerPoolAllocated
+		[[nodiscard]] PURE_STATICS JobRunnerMemoryPool& GetMemoryPool()
+		{
+			return m_memoryPool;
+		}
+
 		[[nodiscard]] PURE_STATICS JobManager& GetJobManager() const
 		{
 			return m_manager;
@@ -138,6 +171,10 @@ namespace ngine::Threading
 			return m_flags.IsSet(Flags::CanRunEfficiencyJobs);
 		}
 
+		//! Sets which runners share this runner's last level cache and NUMA node
+		//! Used to prefer nearby runners when stealing work
+		void SetLocalityRunnerMasks(const JobRunnerMask& sharedCacheRunnerMask, const JobRunnerMask& sharedNumaNodeRunnerMask);
+
 		template<typename Callback>
 		void QueueCallbackFromThread(const JobPriority priority, Callback&& callback, const ConstStringView name = {});
 		template<typename Callback>
@@ -161,99 +198,6 @@ namespace ngine::Threading
 				jobBatch.GetStartStage().SignalExecutionFinishedAndDestroying(*this);
 			}
 		}
-
-#define ENABLE_THREAD_MEMORY_POOL 0
-#if ENABLE_THREAD_MEMORY_POOL
-		inline static constexpr size PoolSize = 1024 * 1024 * 1;
-
-		template<size Size, size Alignment>
-		using MemoryPool = Memory::FixedPool<Size, Size / Alignment, Alignment>;
-
-		//! Allocates memory from the thread only pool
-		//! Allocations and frees of this memory are only allowed from this thread
-		template<size Alignment>
-		[[nodiscard]] RESTRICTED_RETURN void* Allocate(size)
-		{
-			static_unreachable("Memory pool with specified alignment is not implemented!");
-		}
-
-		template<>
-		[[nodiscard]] RESTRICTED_RETURN void* Allocate<8>(const size requestedSize)
-		{
-			return m_memoryPool8.Allocate(requestedSize);
-		}
-
-		template<>
-		[[nodiscard]] RESTRICTED_RETURN void* Allocate<16>(const size requestedSize)
-		{
-			return m_memoryPool16.Allocate(requestedSize);
-		}
-
-		//! Deallocates memory back into the thread only pool
-		//! Allocations and frees of this memory are only allowed from this thread
-		template<size Alignment>
-		[[nodiscard]] void Deallocate(void*)
-		{
-			static_unreachable("Memory pool with specified alignment is not implemented!");
-		}
-
-		template<>
-		[[nodiscard]] void Deallocate<8>(void* const pPointer)
-		{
-			m_memoryPool8.Deallocate(pPointer);
-		}
-
-		template<>
-		[[nodiscard]] void Deallocate<16>(void* const pPointer)
-		{
-			m_memoryPool16.Deallocate(pPointer);
-		}
-
-		//! Allocates memory from the thread only pool
-		//! Allocations are only allowed from this thread
-		template<size Alignment>
-		[[nodiscard]] RESTRICTED_RETURN void* AllocateThreadSafe(size)
-		{
-			static_unreachable("Memory pool with specified alignment is not implemented!");
-		}
-
-		template<>
-		[[nodiscard]] RESTRICTED_RETURN void* AllocateThreadSafe<8>(const size requestedSize)
-		{
-			// TODO: Deeper integration into memory pool to only lock where possible
-			Threading::UniqueLock lock(m_memoryPool8Mutex);
-			return m_threadSafeMemoryPool8.Allocate(requestedSize);
-		}
-
-		template<>
-		[[nodiscard]] RESTRICTED_RETURN void* AllocateThreadSafe<16>(const size requestedSize)
-		{
-			Threading::UniqueLock lock(m_memoryPool16Mutex);
-			return m_threadSafeMemoryPool16.Allocate(requestedSize);
-		}
-
-		//! Deallocates memory back into the thread only pool
-		//! Deallocations are allowed from any thread
-		template<size Alignment>
-		[[nodiscard]] void DeallocateThreadSafe(void*)
-		{
-			static_unreachable("Memory pool with specified alignment is not implemented!");
-		}
-
-		template<>
-		[[nodiscard]] void DeallocateThreadSafe<8>(void* const pPointer)
-		{
-			Threading::UniqueLock lock(m_memoryPool8Mutex);
-			m_threadSafeMemoryPool8.Deallocate(pPointer);
-		}
-
-		template<>
-		[[nodiscard]] void DeallocateThreadSafe<16>(void* const pPointer)
-		{
-			Threading::UniqueLock lock(m_memoryPool16Mutex);
-			m_threadSafeMemoryPool16.Deallocate(pPointer);
-		}
-#endif
 	protected:
 		bool TrySetNextJob(Job& job);
 		void ShareJobsWithIdleThreads(JobView& jobs, const uint16 totalExistingJobCount) const;
@@ -271,6 +215,28 @@ namespace ngine::Threading
 
 		static void QueueOnIdealRunner(JobManager& manager, Job& job);
 
+		[[nodiscard]] static StealableQueueType GetStealableQueueType(const Job& job);
+		[[nodiscard]] JobRunnerMask GetStealableQueueRunnerMask(const StealableQueueType queueType) const;
+		[[nodiscard]] bool CanStealFromQueue(const StealableQueueType queueType) const;
+		//! Publishes a job to the stealable queues, waking an idle runner that can steal it
+		[[nodiscard]] bool PushStealableJob(Job& job);
+		//! Moves trivially shareable jobs from the local queue into the stealable queues
+		void PublishStealableJobs();
+		[[nodiscard]] Job* PopStealableJob();
+		//! Steals a job from this runner's queue, respecting the job's locality hint relative to the thief
+		[[nodiscard]] Job* StealJob(const StealableQueueType queueType, const LocalityDistance thiefDistance);
+		//! Attempts to steal a job from another runner and set it as our next job
+		[[nodiscard]] bool TryStealJobFromOtherRunners();
+		[[nodiscard]] bool TryStealJobFromRunners(const JobRunnerMask& victimMask, const LocalityDistance distance);
+		void WakeIdleRunnersForStealing(const StealableQueueType queueType, uint8 maximumCount, const LocalityDistance maximumDistance);
+
+		//! Stealable queue entries carry the job's locality hint in the unused low bits of the pointer
+		//! This lets thieves filter entries without dereferencing a job that may already have been popped and executed
+		[[nodiscard]] static Job* MakeStealableQueueEntry(Job& job);
+		[[nodiscard]] static Job& GetStealableQueueEntryJob(Job* pEntry);
+		[[nodiscard]] static bool CanStealQueueEntry(Job* pEntry, const LocalityDistance thiefDistance);
+		[[nodiscard]] static LocalityDistance GetMaximumStealDistance(const JobLocalityHint hint);
+
 		struct ThreadSafeQueueView final : public ThreadSafeQueue::View
 		{
 			ThreadSafeQueueView(
@@ -308,9 +274,19 @@ namespace ngine::Threading
 			return GetThreadSafeQueueSize() > 0;
 		}
 
+		[[nodiscard]] uint16 GetStealableQueueSize() const
+		{
+			uint32 count = 0;
+			for (const StealableQueue& queue : m_stealableQueues)
+			{
+				count += queue.GetSize();
+			}
+			return (uint16)count;
+		}
+
 		[[nodiscard]] uint16 GetQueuedJobCount()
 		{
-			return GetThreadSafeQueueSize() + m_queue.GetSize() + m_exclusiveQueue.GetSize() + (m_pNextJob != nullptr);
+			return GetThreadSafeQueueSize() + m_queue.GetSize() + m_exclusiveQueue.GetSize() + (m_pNextJob != nullptr) + GetStealableQueueSize();
 		}
 
 		void SetDefaultPriority();
@@ -341,14 +317,12 @@ namespace ngine::Threading
 
 		mutable DynamicBitset<uint16> m_triviallyShareableJobs;
 
-#if ENABLE_THREAD_MEMORY_POOL
-		MemoryPool<PoolSize, 8> m_memoryPool8;
-		MemoryPool<PoolSize, 16> m_memoryPool16;
-		MemoryPool<PoolSize, 8> m_threadSafeMemoryPool8;
-		Threading::Mutex m_memoryPool8Mutex;
-		MemoryPool<PoolSize, 16> m_threadSafeMemoryPool16;
-		Threading::Mutex m_memoryPool16Mutex;
-#endif
+		Array<StealableQueue, (uint8)StealableQueueType::Count> m_stealableQueues;
+		//! Runners per locality distance, may include this runner
+		Array<JobRunnerMask, (uint8)LocalityDistance::Count> m_localityRunnerMasks;
+
+		//! Outlives the runner, as blocks allocated by its jobs can be freed after it was destroyed
+		JobRunnerMemoryPool& m_memoryPool{JobRunnerMemoryPool::Acquire()};
 	};
 
 	ENUM_FLAG_OPERATORS(JobRunnerThread::Flags);
@@ -0,0 +1,367 @@
+#pragma once
+
+#include "Job.h"
+#include "JobBatch.h"
+#include "JobManager.h"
+#include "JobRunnerThread.h"
+#include "IntermediateStage.h"
+#include "AsyncJob.h"
+
+#include <Common/Memory/Containers/ArrayView.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Threading/Mutexes/Mutex.h>
+#include <Common/Math/Min.h>
+#include <Common/Math/Max.h>
+#include <Common/TypeTraits/WithoutReference.h>
+
+namespace ngine::Threading
+{
+	namespace Internal
+	{
+		//! Finish stage of a data-parallel batch
+		//! Owns the state shared between chunks, and destroys itself once all chunks have finished
+		template<typename StateType>
+		struct ParallelStage final : public IntermediateStage, public JobRunnerPoolAllocated
+		{
+			template<typename... Args>
+			ParallelStage(Args&&... args)
+				: m_state{Forward<Args>(args)...}
+			{
+			}
+
+			virtual void OnDependenciesResolved(Threading::JobRunnerThread& thread) override
+			{
+				m_state.OnFinished();
+				SignalExecutionFinishedAndDestroying(thread);
+			}
+
+			virtual void OnFinishedExecution(JobRunnerThread&) override
+			{
+				Assert(!HasSubsequentTasks());
+				delete this;
+			}
+
+			StateType m_state;
+		};
+
+		//! Processes a range of a data-parallel batch
+		//! Uses lazy binary splitting: the range is processed in minimum sized chunks, and the remaining half is only split off into a new
+		//! job when another runner is idle and can pick it up. This keeps the job count low when the runners are already saturated.
+		template<typename StateType, typename SizeType>
+		struct ParallelRangeJob final : public Job, public JobRunnerPoolAllocated
+		{
+			using StageType = ParallelStage<StateType>;
+
+			ParallelRangeJob(const Priority priority, StageType& stage, const SizeType begin, const SizeType end)
+				: Job(priority)
+				, m_stage(stage)
+				, m_begin(begin)
+				, m_end(end)
+			{
+			}
+
+			virtual Result OnExecute(JobRunnerThread& thread) override
+			{
+				StateType& state = m_stage.m_state;
+				const JobManager& jobManager = thread.GetJobManager();
+				const SizeType minimumChunkSize = state.GetMinimumChunkSize();
+				typename StateType::LocalType local = state.CreateLocal();
+
+				while (m_begin < m_end)
+				{
+					const SizeType remainingCount = m_end - m_begin;
+					if (remainingCount >= minimumChunkSize * 2 && jobManager.GetNumberOfIdleThreads() > 0)
+					{
+						const SizeType splitIndex = m_begin + remainingCount / 2;
+						ParallelRangeJob& splitJob = *new ParallelRangeJob(GetPriority(), m_stage, splitIndex, m_end);
+						// Must be added before we finish, otherwise the stage could resolve early
+						splitJob.AddSubsequentStage(m_stage);
+						splitJob.Queue(thread);
+						m_end = splitIndex;
+						continue;
+					}
+
+					const SizeType count = Math::Min(remainingCount, minimumChunkSize);
+					state.ExecuteChunk(local, m_begin, count);
+					m_begin += count;
+				}
+
+				state.OnRangeFinished(Move(local));
+				return Result::FinishedAndDelete;
+			}
+		protected:
+			StageType& m_stage;
+			SizeType m_begin;
+			SizeType m_end;
+		};
+
+		template<typename ElementType, typename SizeType, typename Callback>
+		struct ParallelForState
+		{
+			struct LocalType
+			{
+			};
+
+			[[nodiscard]] SizeType GetMinimumChunkSize() const
+			{
+				return m_minimumChunkSize;
+			}
+			[[nodiscard]] LocalType CreateLocal() const
+			{
+				return {};
+			}
+			void ExecuteChunk(LocalType&, const SizeType index, const SizeType count)
+			{
+				m_callback(m_view.GetSubView(index, count));
+			}
+			void OnRangeFinished(LocalType&&)
+			{
+			}
+			void OnFinished()
+			{
+			}
+
+			ArrayView<ElementType, SizeType> m_view;
+			Callback m_callback;
+			SizeType m_minimumChunkSize;
+		};
+
+		template<
+			typename ElementType,
+			typename SizeType,
+			typename ResultType,
+			typename ReduceCallback,
+			typename CombineCallback,
+			typename FinishedCallback>
+		struct ParallelReduceState
+		{
+			using LocalType = ResultType;
+
+			[[nodiscard]] SizeType GetMinimumChunkSize() const
+			{
+				return m_minimumChunkSize;
+			}
+			[[nodiscard]] LocalType CreateLocal() const
+			{
+				return m_identity;
+			}
+			void ExecuteChunk(LocalType& local, const SizeType index, const SizeType count)
+			{
+				local = m_combine(Move(local), m_reduce(m_view.GetSubView(index, count)));
+			}
+			void OnRangeFinished(LocalType&& local)
+			{
+				// Only contended once per range job, not per chunk
+				Threading::UniqueLock lock(m_resultMutex);
+				m_result = m_combine(Move(m_result), Forward<LocalType>(local));
+			}
+			void OnFinished()
+			{
+				m_finished(Move(m_result));
+			}
+
+			ArrayView<ElementType, SizeType> m_view;
+			ResultType m_identity;
+			ReduceCallback m_reduce;
+			CombineCallback m_combine;
+			FinishedCallback m_finished;
+			SizeType m_minimumChunkSize;
+
+			Threading::Mutex m_resultMutex;
+			ResultType m_result{m_identity};
+		};
+
+		template<typename ElementType, typename SizeType, typename CombineCallback>
+		struct ParallelScanState
+		{
+			using ChunkIndexType = uint16;
+
+			[[nodiscard]] ArrayView<const ElementType, SizeType> GetInputChunk(const ChunkIndexType chunkIndex) const
+			{
+				const SizeType index = Math::Min(SizeType(chunkIndex * m_chunkSize), m_input.GetSize());
+				return m_input.GetSubView(index, Math::Min(m_chunkSize, SizeType(m_input.GetSize() - index)));
+			}
+
+			//! First pass, calculates the sum of each chunk
+			void ReduceChunk(const ChunkIndexType chunkIndex)
+			{
+				ElementType total = m_identity;
+				for (const ElementType& element : GetInputChunk(chunkIndex))
+				{
+					total = m_combine(total, element);
+				}
+				m_chunkOffsets[chunkIndex] = Move(total);
+			}
+			//! Turns the chunk sums into the exclusive prefix of each chunk
+			void CalculateChunkOffsets()
+			{
+				ElementType runningTotal = m_identity;
+				for (ElementType& chunkOffset : m_chunkOffsets)
+				{
+					ElementType chunkTotal = Move(chunkOffset);
+					chunkOffset = runningTotal;
+					runningTotal = m_combine(runningTotal, chunkTotal);
+				}
+			}
+			//! Second pass, writes the inclusive scan of each chunk starting at its offset
+			void ScanChunk(const ChunkIndexType chunkIndex)
+			{
+				const ArrayView<const ElementType, SizeType> inputChunk = GetInputChunk(chunkIndex);
+				const SizeType outputIndex = SizeType(inputChunk.begin() - m_input.begin());
+				ElementType runningTotal = m_chunkOffsets[chunkIndex];
+				for (SizeType index = 0, count = inputChunk.GetSize(); index < count; ++index)
+				{
+					runningTotal = m_combine(runningTotal, inputChunk[index]);
+					m_output[outputIndex + index] = runningTotal;
+				}
+			}
+			void OnFinished()
+			{
+			}
+
+			ArrayView<const ElementType, SizeType> m_input;
+			ArrayView<ElementType, SizeType> m_output;
+			ElementType m_identity;
+			CombineCallback m_combine;
+			SizeType m_chunkSize;
+			FixedSizeVector<ElementType, ChunkIndexType> m_chunkOffsets;
+		};
+	}
+
+	//! Creates a batch that invokes the callback for sub views of the specified view in parallel
+	//! The callback receives views of at least minimumChunkSize elements, except for the last chunk: callback(ArrayView<ElementType> chunk)
+	//! Ranges are split lazily while other runners are idle, so no job is allocated per element
+	//! The returned batch must be queued, the view must stay valid until the batch's finished stage executes
+	template<typename ElementType, typename SizeType, typename Callback>
+	[[nodiscard]] inline JobBatch ParallelFor(
+		const ArrayView<ElementType, SizeType> view, Callback&& callback, const JobPriority priority, const SizeType minimumChunkSize = 1
+	)
+	{
+		Assert(minimumChunkSize > 0);
+		// Callbacks are stored by value, the stage outlives this call
+		using State = Internal::ParallelForState<ElementType, SizeType, TypeTraits::WithoutReference<Callback>>;
+		using Stage = Internal::ParallelStage<State>;
+		Stage& stage = *new Stage(view, Forward<Callback>(callback), minimumChunkSize);
+
+		Job& job = *new Internal::ParallelRangeJob<State, SizeType>(priority, stage, 0, view.GetSize());
+		return JobBatch(job, stage);
+	}
+
+	//! Creates a batch that reduces the specified view in parallel
+	//! reduce(ArrayView<ElementType> chunk) -> ResultType is called per chunk
+	//! combine(ResultType&& left, ResultType&& right) -> ResultType merges partial results, and must be associative and commutative
+	//! finished(ResultType&& result) is called with the final result before the batch's finished stage resolves
+	template<
+		typename ElementType,
+		typename SizeType,
+		typename ResultType,
+		typename ReduceCallback,
+		typename CombineCallback,
+		typename FinishedCallback>
+	[[nodiscard]] inline JobBatch ParallelReduce(
+		const ArrayView<ElementType, SizeType> view,
+		ResultType identity,
+		ReduceCallback&& reduce,
+		CombineCallback&& combine,
+		FinishedCallback&& finished,
+		const JobPriority priority,
+		const SizeType minimumChunkSize = 1
+	)
+	{
+		Assert(minimumChunkSize > 0);
+		using State = Internal::ParallelReduceState<
+			ElementType,
+			SizeType,
+			ResultType,
+			TypeTraits::WithoutReference<ReduceCallback>,
+			TypeTraits::WithoutReference<CombineCallback>,
+			TypeTraits::WithoutReference<FinishedCallback>>;
+		using Stage = Internal::ParallelStage<State>;
+		Stage& stage = *new Stage(
+			view,
+			Move(identity),
+			Forward<ReduceCallback>(reduce),
+			Forward<CombineCallback>(combine),
+			Forward<FinishedCallback>(finished),
+			minimumChunkSize
+		);
+
+		Job& job = *new Internal::ParallelRangeJob<State, SizeType>(priority, stage, 0, view.GetSize());
+		return JobBatch(job, stage);
+	}
+
+	//! Creates a batch that writes the inclusive scan of input into output in parallel
+	//! combine(const ElementType& left, const ElementType& right) -> ElementType must be associative
+	//! Runs in two passes over fixed chunks: chunk sums are computed in parallel, prefixed serially, and then each chunk is scanned in
+	//! parallel
+	template<typename ElementType, typename SizeType, typename CombineCallback>
+	[[nodiscard]] inline JobBatch ParallelScan(
+		const ArrayView<const ElementType, SizeType> input,
+		const ArrayView<ElementType, SizeType> output,
+		ElementType identity,
+		CombineCallback&& combine,
+		const JobPriority priority,
+		const SizeType minimumChunkSize = 1024
+	)
+	{
+		Assert(minimumChunkSize > 0);
+		Assert(output.GetSize() >= input.GetSize());
+		using State = Internal::ParallelScanState<ElementType, SizeType, TypeTraits::WithoutReference<CombineCallback>>;
+		using ChunkIndexType = typename State::ChunkIndexType;
+		using Stage = Internal::ParallelStage<State>;
+
+		// Bound the chunk count, the offsets are prefixed serially between the two passes
+		constexpr ChunkIndexType MaximumChunkCount = 256;
+		// Integer division rounding up, floating point loses precision for large inputs and could leave trailing elements uncovered
+		const auto divideRoundingUp = [](const SizeType dividend, const SizeType divisor) -> SizeType
+		{
+			return SizeType(dividend / divisor + SizeType(dividend % divisor != 0));
+		};
+		const ChunkIndexType chunkCount =
+			(ChunkIndexType)Math::Max(Math::Min(divideRoundingUp(input.GetSize(), minimumChunkSize), (SizeType)MaximumChunkCount), (SizeType)1u);
+		const SizeType chunkSize = Math::Max(divideRoundingUp(input.GetSize(), (SizeType)chunkCount), (SizeType)1u);
+
+		Stage& stage = *new Stage(
+			input,
+			output,
+			identity,
+			Forward<CombineCallback>(combine),
+			chunkSize,
+			FixedSizeVector<ElementType, ChunkIndexType>(Memory::ConstructWithSize, Memory::InitializeAll, chunkCount, identity)
+		);
+		State& state = stage.m_state;
+
+		IntermediateStage& startStage = CreateIntermediateStage();
+		Job& offsetsJob = CreateCallback(
+			[&state](JobRunnerThread&)
+			{
+				state.CalculateChunkOffsets();
+			},
+			priority
+		);
+		for (ChunkIndexType chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+		{
+			Job& reduceJob = CreateCallback(
+				[&state, chunkIndex](JobRunnerThread&)
+				{
+					state.ReduceChunk(chunkIndex);
+				},
+				priority
+			);
+			startStage.AddSubsequentStage(reduceJob);
+			reduceJob.AddSubsequentStage(offsetsJob);
+
+			Job& scanJob = CreateCallback(
+				[&state, chunkIndex](JobRunnerThread&)
+				{
+					state.ScanChunk(chunkIndex);
+				},
+				priority
+			);
+			offsetsJob.AddSubsequentStage(scanJob);
+			scanJob.AddSubsequentStage(stage);
+		}
+
+		return JobBatch(JobBatch::ManualDependencies, startStage, stage);
+	}
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <Common/Assert/Assert.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/Memory/Optional.h>
+#include <Common/Platform/ForceInline.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/AtomicPtr.h>
+
+namespace ngine::Threading
+{
+	namespace Internal
+	{
+		//! Readers of all snapshot pointers announce themselves in one of these slots, each on its own cache line
+		//! Threads are spread over the slots round robin, so readers on different threads rarely share a cache line
+		inline static constexpr uint8 SnapshotReaderSlotCount = 64;
+		using SnapshotReaderSlotMask = uint64;
+		inline static constexpr SnapshotReaderSlotMask AllSnapshotReaderSlotsMask = ~SnapshotReaderSlotMask(0);
+
+		//! Returns the reader count of the slot assigned to the calling thread
+		[[nodiscard]] Atomic<uint32>& GetSnapshotReaderSlot();
+		//! Returns the mask with the bits of slots that currently have no readers cleared
+		[[nodiscard]] SnapshotReaderSlotMask ClearIdleSnapshotReaderSlots(SnapshotReaderSlotMask mask);
+	}
+
+	//! Snapshot that was replaced by a newer one, but may still be accessed by readers that acquired it earlier
+	//! It can be freed once every reader slot was observed without readers after it was replaced,
+	//! as any reader announcing itself afterwards can only acquire the newer snapshot.
+	struct RetiredSnapshot
+	{
+		using DeleteFunction = void (*)(void*);
+
+		RetiredSnapshot() = default;
+		RetiredSnapshot(void* pSnapshot, const DeleteFunction deleteFunction)
+			: m_pSnapshot(pSnapshot)
+			, m_deleteFunction(deleteFunction)
+		{
+		}
+		RetiredSnapshot(const RetiredSnapshot&) = delete;
+		RetiredSnapshot& operator=(const RetiredSnapshot&) = delete;
+		RetiredSnapshot(RetiredSnapshot&& other)
+			: m_pSnapshot(other.m_pSnapshot)
+			, m_deleteFunction(other.m_deleteFunction)
+			, m_pendingReaderSlotMask(other.m_pendingReaderSlotMask)
+		{
+			other.m_pSnapshot = nullptr;
+		}
+		RetiredSnapshot& operator=(RetiredSnapshot&&) = delete;
+		~RetiredSnapshot()
+		{
+			Assert(m_pSnapshot == nullptr, "Retired snapshot must be reclaimed before destruction");
+		}
+
+		[[nodiscard]] bool IsValid() const
+		{
+			return m_pSnapshot != nullptr;
+		}
+
+		//! Frees the snapshot if no reader can still be accessing it
+		//! @returns true if the snapshot was freed
+		[[nodiscard]] bool TryReclaim()
+		{
+			if (m_pSnapshot == nullptr)
+			{
+				return true;
+			}
+
+			m_pendingReaderSlotMask = Internal::ClearIdleSnapshotReaderSlots(m_pendingReaderSlotMask);
+			if (m_pendingReaderSlotMask != 0)
+			{
+				return false;
+			}
+
+			m_deleteFunction(m_pSnapshot);
+			m_pSnapshot = nullptr;
+			return true;
+		}
+	protected:
+		void* m_pSnapshot{nullptr};
+		DeleteFunction m_deleteFunction{nullptr};
+		Internal::SnapshotReaderSlotMask m_pendingReaderSlotMask{Internal::AllSnapshotReaderSlotsMask};
+	};
+
+	//! Frees the retired snapshot as soon as no reader can access it anymore
+	//! Reclamation is deferred to the job system while readers are still active, or waited on if no job manager exists.
+	void Reclaim(RetiredSnapshot&& snapshot);
+
+	//! Read-copy-update publication of an immutable object
+	//! Readers acquire the current snapshot with a single load and only write to their own reader slot, never taking a lock.
+	//! Writers build a complete copy and publish it, the replaced snapshot is freed once no reader can still be accessing it.
+	//! Suited for data that is read very frequently and changed rarely, as every change copies the whole object.
+	template<typename Type>
+	struct TSnapshotPointer
+	{
+		//! Keeps the snapshot that was current when the scope started alive until the scope ends
+		struct ReadScope
+		{
+			FORCE_INLINE ReadScope(const TSnapshotPointer& pointer)
+				: m_readerCount(Internal::GetSnapshotReaderSlot())
+			{
+				// Announce the reader before loading, so writers can't free the snapshot while we access it
+				++m_readerCount;
+				m_pSnapshot = pointer.m_pSnapshot.Load();
+			}
+			ReadScope(const ReadScope&) = delete;
+			ReadScope& operator=(const ReadScope&) = delete;
+			ReadScope(ReadScope&&) = delete;
+			ReadScope& operator=(ReadScope&&) = delete;
+			FORCE_INLINE ~ReadScope()
+			{
+				--m_readerCount;
+			}
+
+			[[nodiscard]] FORCE_INLINE bool IsValid() const
+			{
+				return m_pSnapshot != nullptr;
+			}
+			[[nodiscard]] FORCE_INLINE Optional<const Type*> Get() const
+			{
+				return m_pSnapshot;
+			}
+			[[nodiscard]] FORCE_INLINE const Type* operator->() const
+			{
+				Assert(m_pSnapshot != nullptr);
+				return m_pSnapshot;
+			}
+		protected:
+			Atomic<uint32>& m_readerCount;
+			const Type* m_pSnapshot;
+		};
+
+		TSnapshotPointer() = default;
+		TSnapshotPointer(const TSnapshotPointer&) = delete;
+		TSnapshotPointer& operator=(const TSnapshotPointer&) = delete;
+		TSnapshotPointer(TSnapshotPointer&&) = delete;
+		TSnapshotPointer& operator=(TSnapshotPointer&&) = delete;
+		//! Expects no readers to remain
+		~TSnapshotPointer()
+		{
+			delete m_pSnapshot.Load();
+		}
+
+		[[nodiscard]] FORCE_INLINE ReadScope Read() const
+		{
+			return ReadScope{*this};
+		}
+
+		[[nodiscard]] bool IsPublished() const
+		{
+			return m_pSnapshot.Load() != nullptr;
+		}
+
+		//! Replaces the current snapshot, concurrent writers must be serialized by the caller
+		//! @returns the replaced snapshot, which has to be passed to Reclaim
+		[[nodiscard]] RetiredSnapshot Publish(UniquePtr<Type>&& pSnapshot)
+		{
+			Type* pPreviousSnapshot = m_pSnapshot.Exchange(pSnapshot.StealOwnership());
+			if (pPreviousSnapshot == nullptr)
+			{
+				return {};
+			}
+			return RetiredSnapshot{
+				pPreviousSnapshot,
+				[](void* pSnapshot)
+				{
+					delete static_cast<Type*>(pSnapshot);
+				}
+			};
+		}
+	protected:
+		Atomic<Type*> m_pSnapshot;
+	};
+}
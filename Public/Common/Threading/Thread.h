@@ -4,6 +4,7 @@
 #include <Common/Assert/Assert.h>
 #include <Common/Memory/Containers/StringView.h>
 #include <Common/Math/Ratio.h>
+#include <Common/Platform/LogicalProcessorMask.h>
 
 #if USE_PTHREAD
 #include <pthread.h>
@@ -335,6 +336,10 @@ namespace ngine::Threading
 		void SetThreadName(const ConstNativeZeroTerminatedStringView name);
 		static void SetAffinityMask(const ThreadId id, const uint64 mask);
 		void SetAffinityMask(const uint64 mask);
+		//! Restricts the thread to the specified logical processors, supports more than 64 processors
+		//! On Windows the mask must not span multiple processor groups
+		static void SetAffinityMask(const ThreadId id, const Platform::LogicalProcessorMask& mask);
+		void SetAffinityMask(const Platform::LogicalProcessorMask& mask);
 
 		enum class Priority : uint8
 		{
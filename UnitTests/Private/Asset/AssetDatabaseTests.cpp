@@ -0,0 +1,581 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include "../Threading/ScopedJobManager.h"
+
+#include <Common/Asset/AssetDatabase.h>
+#include <Common/Asset/AssetDatabaseStamps.h>
+#include <Common/IO/File.h>
+#include <Common/IO/Path.h>
+#include <Common/Format/Guid.h>
+#include <Common/Memory/Containers/Format/String.h>
+#include <Common/Threading/Thread.h>
+
+namespace ngine::Tests
+{
+	//! Creates an empty directory for the test, removing leftovers of previous runs
+	[[nodiscard]] static IO::Path CreateTestDirectory(const IO::PathView name)
+	{
+		const IO::Path directory = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), name);
+		if (directory.Exists())
+		{
+			directory.EmptyDirectoryRecursively();
+			directory.RemoveDirectory();
+		}
+		EXPECT_TRUE(directory.CreateDirectories());
+		return directory;
+	}
+
+	static void RemoveTestDirectory(const IO::Path& directory)
+	{
+		directory.EmptyDirectoryRecursively();
+		EXPECT_TRUE(directory.RemoveDirectory());
+	}
+
+	static void WriteAssetFile(const IO::Path& filePath, const Guid assetGuid, const Guid assetTypeGuid)
+	{
+		String contents;
+		contents.Format("{{\"guid\": \"{}\", \"assetTypeGuid\": \"{}\"}}", assetGuid, assetTypeGuid);
+		IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+		EXPECT_TRUE(file.IsValid());
+		EXPECT_EQ(file.Write(contents.GetView()), contents.GetSize());
+	}
+
+	//! Registered entries are stored relative to the root directory, while loaded entries are absolute
+	[[nodiscard]] static IO::PathView GetRelativeEntryPath(const Asset::DatabaseEntry& entry, const IO::PathView rootDirectory)
+	{
+		if (rootDirectory.HasElements() && entry.m_path.IsRelativeTo(rootDirectory))
+		{
+			return entry.m_path.GetRelativeToParent(rootDirectory);
+		}
+		return entry.m_path.GetView();
+	}
+
+	static void
+	ExpectEqualDatabases(const Asset::Database& expected, const Asset::Database& actual, const IO::PathView rootDirectory = IO::PathView())
+	{
+		EXPECT_EQ(actual.GetAssetCount(), expected.GetAssetCount());
+		expected.IterateAssets(
+			[&actual, rootDirectory](const Guid assetGuid, const Asset::DatabaseEntry& expectedEntry)
+			{
+				const Optional<const Asset::DatabaseEntry*> pEntry = actual.GetAssetEntry(assetGuid);
+				EXPECT_TRUE(pEntry.IsValid());
+				if (pEntry.IsValid())
+				{
+					EXPECT_TRUE(GetRelativeEntryPath(*pEntry, rootDirectory) == GetRelativeEntryPath(expectedEntry, rootDirectory));
+					EXPECT_EQ(pEntry->m_assetTypeGuid, expectedEntry.m_assetTypeGuid);
+				}
+				return Memory::CallbackResult::Continue;
+			}
+		);
+	}
+
+	UNIT_TEST(AssetDatabase, IterateIndexedAssets)
+	{
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		constexpr Asset::TypeGuid textureTypeGuid = "0c41fbd3-0c55-4a3e-9f8a-93f4a2c6d8e1"_guid;
+		constexpr Guid componentTypeGuid = "b9d5f1a2-6e8c-4d1b-8a3f-7c2e9d4b5a60"_guid;
+		constexpr Tag::Guid tagGuid = "3e6f9a1c-2b4d-4e8f-9a7c-1d5b3f6e8a20"_guid;
+
+		const Guid firstMeshGuid = Guid::Generate();
+		const Guid secondMeshGuid = Guid::Generate();
+		const Guid textureGuid = Guid::Generate();
+
+		Asset::Database database;
+		database.RegisterAsset(
+			firstMeshGuid,
+			Asset::DatabaseEntry{
+				meshTypeGuid,
+				componentTypeGuid,
+				IO::Path(MAKE_PATH("FirstMesh.nasset")),
+				{},
+				{},
+				{},
+				Asset::DatabaseEntry::TagsStorage{tagGuid}
+			},
+			IO::PathView()
+		);
+		database.RegisterAsset(
+			secondMeshGuid,
+			Asset::DatabaseEntry{meshTypeGuid, {}, IO::Path(MAKE_PATH("SecondMesh.nasset"))},
+			IO::PathView()
+		);
+		database.RegisterAsset(
+			textureGuid,
+			Asset::DatabaseEntry{
+				textureTypeGuid,
+				{},
+				IO::Path(MAKE_PATH("Texture.nasset")),
+				{},
+				{},
+				{},
+				Asset::DatabaseEntry::TagsStorage{tagGuid}
+			},
+			IO::PathView()
+		);
+
+		EXPECT_EQ(database.GetAssetCountOfAssetType(meshTypeGuid), 2u);
+		EXPECT_EQ(database.GetAssetCountOfAssetType(textureTypeGuid), 1u);
+		EXPECT_EQ(database.GetAssetCountOfComponentType(componentTypeGuid), 1u);
+		EXPECT_EQ(database.GetAssetCountWithTag(tagGuid), 2u);
+
+		uint32 visitedCount{0};
+		database.IterateAssetsOfAssetType(
+			[&visitedCount, meshTypeGuid](const Guid, const Asset::DatabaseEntry& entry)
+			{
+				EXPECT_EQ(entry.m_assetTypeGuid, meshTypeGuid);
+				visitedCount++;
+				return Memory::CallbackResult::Continue;
+			},
+			meshTypeGuid
+		);
+		EXPECT_EQ(visitedCount, 2u);
+
+		// Replacing an entry moves it between indices
+		database.RegisterAsset(
+			secondMeshGuid,
+			Asset::DatabaseEntry{textureTypeGuid, {}, IO::Path(MAKE_PATH("SecondMesh.nasset"))},
+			IO::PathView()
+		);
+		EXPECT_EQ(database.GetAssetCountOfAssetType(meshTypeGuid), 1u);
+		EXPECT_EQ(database.GetAssetCountOfAssetType(textureTypeGuid), 2u);
+
+		database.RemoveAsset(textureGuid);
+		EXPECT_EQ(database.GetAssetCountOfAssetType(textureTypeGuid), 1u);
+		EXPECT_EQ(database.GetAssetCountWithTag(tagGuid), 1u);
+
+		visitedCount = 0;
+		database.IterateAssetsWithTag(
+			[&visitedCount, firstMeshGuid](const Guid assetGuid, const Asset::DatabaseEntry&)
+			{
+				EXPECT_EQ(assetGuid, firstMeshGuid);
+				visitedCount++;
+				return Memory::CallbackResult::Continue;
+			},
+			tagGuid
+		);
+		EXPECT_EQ(visitedCount, 1u);
+	}
+
+	UNIT_TEST(AssetDatabase, ModifyIndexedData)
+	{
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		constexpr Asset::TypeGuid textureTypeGuid = "0c41fbd3-0c55-4a3e-9f8a-93f4a2c6d8e1"_guid;
+		constexpr Tag::Guid tagGuid = "3e6f9a1c-2b4d-4e8f-9a7c-1d5b3f6e8a20"_guid;
+
+		const Guid firstGuid = Guid::Generate();
+		const Guid secondGuid = Guid::Generate();
+
+		Asset::Database database;
+		database.RegisterAsset(firstGuid, Asset::DatabaseEntry{meshTypeGuid, {}, IO::Path(MAKE_PATH("First.nasset"))}, IO::PathView());
+		database.RegisterAsset(secondGuid, Asset::DatabaseEntry{meshTypeGuid, {}, IO::Path(MAKE_PATH("Second.nasset"))}, IO::PathView());
+
+		EXPECT_TRUE(database.ModifyAssetEntry(
+			firstGuid,
+			[textureTypeGuid, tagGuid](Asset::DatabaseEntry& entry)
+			{
+				entry.m_assetTypeGuid = textureTypeGuid;
+				entry.m_tags.EmplaceBack(tagGuid);
+			}
+		));
+		EXPECT_EQ(database.GetAssetCountOfAssetType(meshTypeGuid), 1u);
+		EXPECT_EQ(database.GetAssetCountOfAssetType(textureTypeGuid), 1u);
+		EXPECT_EQ(database.GetAssetCountWithTag(tagGuid), 1u);
+		EXPECT_FALSE(database.ModifyAssetEntry(
+			Guid::Generate(),
+			[](Asset::DatabaseEntry&)
+			{
+			}
+		));
+
+		// Changes made in place are picked up once the indices are rebuilt
+		database.IterateAssets(
+			[tagGuid](const Guid, Asset::DatabaseEntry& entry)
+			{
+				entry.m_tags.EmplaceBackUnique(Tag::Guid(tagGuid));
+				return Memory::CallbackResult::Continue;
+			}
+		);
+		database.RebuildIndices();
+		EXPECT_EQ(database.GetAssetCountWithTag(tagGuid), 2u);
+
+		uint32 visitedCount{0};
+		database.IterateAssetsWithTag(
+			[&visitedCount](const Guid, const Asset::DatabaseEntry&)
+			{
+				visitedCount++;
+				return Memory::CallbackResult::Continue;
+			},
+			tagGuid
+		);
+		EXPECT_EQ(visitedCount, 2u);
+	}
+
+	UNIT_TEST(AssetDatabase, ParallelScanMatchesSerial)
+	{
+		constexpr Asset::TypeGuid assetTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		const IO::Path directory = CreateTestDirectory(MAKE_PATH("AssetDatabaseParallelScan"));
+
+		// Enough directories and files for the parallel discovery and parsing paths, nested deeper than the breadth first expansion
+		const IO::PathView directoryNames[] = {
+			MAKE_PATH("Directory0"),
+			MAKE_PATH("Directory1"),
+			MAKE_PATH("Directory2"),
+			MAKE_PATH("Directory3"),
+			MAKE_PATH("Directory4"),
+			MAKE_PATH("Directory5")
+		};
+		const IO::PathView fileNames[] = {MAKE_PATH("Asset0.nasset"), MAKE_PATH("Asset1.nasset"), MAKE_PATH("Asset2.nasset")};
+		for (const IO::PathView directoryName : directoryNames)
+		{
+			const IO::Path subdirectory = IO::Path::Combine(directory, directoryName);
+			const IO::Path nestedDirectory = IO::Path::Combine(subdirectory, MAKE_PATH("A"), MAKE_PATH("B"), MAKE_PATH("C"));
+			EXPECT_TRUE(nestedDirectory.CreateDirectories());
+			for (const IO::PathView fileName : fileNames)
+			{
+				WriteAssetFile(IO::Path::Combine(subdirectory, fileName), Guid::Generate(), assetTypeGuid);
+				WriteAssetFile(IO::Path::Combine(nestedDirectory, fileName), Guid::Generate(), assetTypeGuid);
+			}
+		}
+		constexpr uint32 uniqueAssetCount = 6 * 3 * 2;
+
+		// Duplicate guids must resolve to the same entry regardless of the order files were found and parsed in
+		const Guid duplicateGuid = Guid::Generate();
+		WriteAssetFile(IO::Path::Combine(directory, MAKE_PATH("Directory0"), MAKE_PATH("Duplicate.nasset")), duplicateGuid, assetTypeGuid);
+		WriteAssetFile(IO::Path::Combine(directory, MAKE_PATH("Directory3"), MAKE_PATH("Duplicate.nasset")), duplicateGuid, assetTypeGuid);
+
+		// Without a job manager, discovery and parsing run serially
+		Asset::Database serialDatabase;
+		EXPECT_FALSE(serialDatabase.RegisterAllAssetsInDirectory(directory, directory));
+		EXPECT_EQ(serialDatabase.GetAssetCount(), uniqueAssetCount + 1);
+
+		{
+			ScopedJobManager jobManager;
+
+			// Scanned from the main runner, which executes jobs while waiting
+			for (uint8 iteration = 0; iteration < 3; ++iteration)
+			{
+				Asset::Database parallelDatabase;
+				EXPECT_FALSE(parallelDatabase.RegisterAllAssetsInDirectory(directory, directory));
+				ExpectEqualDatabases(serialDatabase, parallelDatabase);
+			}
+
+			// Scanned from a thread that is not a job runner, which blocks until the batches finished
+			Asset::Database parallelDatabase;
+			Threading::Atomic<bool> isFinished{false};
+			bool success{true};
+			{
+				Threading::Thread scanThread(
+					[&parallelDatabase, &directory, &success, &isFinished]()
+					{
+						success = parallelDatabase.RegisterAllAssetsInDirectory(directory, directory);
+						isFinished = true;
+					}
+				);
+
+				Threading::JobRunnerThread& mainRunner = jobManager.GetMainRunner();
+				while (!isFinished)
+				{
+					if (!mainRunner.DoRunNextJob())
+					{
+						Threading::Sleep(0);
+					}
+				}
+			}
+			EXPECT_FALSE(success);
+			ExpectEqualDatabases(serialDatabase, parallelDatabase);
+		}
+
+		RemoveTestDirectory(directory);
+	}
+
+	//! Assets of a project, laid out like Generate expects them with the database saved next to the asset directory
+	struct TestAssetDirectory
+	{
+		TestAssetDirectory(const IO::PathView name)
+			: m_rootDirectory(CreateTestDirectory(name))
+			, m_assetDirectory(IO::Path::Combine(m_rootDirectory, MAKE_PATH("Assets")))
+			, m_databaseFile(IO::Path::Combine(m_rootDirectory, MAKE_PATH("Assets.nassetdb")))
+		{
+			EXPECT_TRUE(m_assetDirectory.CreateDirectories());
+		}
+		~TestAssetDirectory()
+		{
+			RemoveTestDirectory(m_rootDirectory);
+		}
+
+		[[nodiscard]] IO::Path GetPath(const IO::PathView relativePath) const
+		{
+			return IO::Path::Combine(m_assetDirectory, relativePath);
+		}
+
+		//! Checks the database against a full scan of the current directory contents
+		void ExpectMatchesFullScan(const Asset::Database& database) const
+		{
+			Asset::Database fullScanDatabase;
+			[[maybe_unused]] const bool registeredAll = fullScanDatabase.RegisterAllAssetsInDirectory(m_assetDirectory, m_rootDirectory);
+			ExpectEqualDatabases(fullScanDatabase, database, m_rootDirectory);
+		}
+
+		IO::Path m_rootDirectory;
+		IO::Path m_assetDirectory;
+		IO::Path m_databaseFile;
+	};
+
+	UNIT_TEST(AssetDatabase, UpdateAllAssetsInDirectory)
+	{
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		constexpr Asset::TypeGuid textureTypeGuid = "0c41fbd3-0c55-4a3e-9f8a-93f4a2c6d8e1"_guid;
+		const TestAssetDirectory assets(MAKE_PATH("AssetDatabaseUpdate"));
+
+		const Guid modifiedGuid = Guid::Generate();
+		const Guid deletedGuid = Guid::Generate();
+		const Guid renamedGuid = Guid::Generate();
+		const Guid nestedGuid = Guid::Generate();
+		EXPECT_TRUE(assets.GetPath(MAKE_PATH("Meshes/Nested")).CreateDirectories());
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Modified.nasset")), modifiedGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Deleted.nasset")), deletedGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Meshes/Renamed.nasset")), renamedGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Meshes/Nested/Nested.nasset")), nestedGuid, meshTypeGuid);
+
+		Asset::Database database;
+		Asset::DatabaseStamps stamps;
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_EQ(database.GetAssetCount(), 4u);
+		EXPECT_EQ(stamps.m_files.GetSize(), 4u);
+		EXPECT_EQ(stamps.m_directories.GetSize(), 3u);
+		assets.ExpectMatchesFullScan(database);
+
+		// Updating without changes keeps the database as is
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		assets.ExpectMatchesFullScan(database);
+
+		// Add, modify, delete and rename files
+		const Guid addedGuid = Guid::Generate();
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Meshes/Added.nasset")), addedGuid, textureTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Modified.nasset")), modifiedGuid, textureTypeGuid);
+		EXPECT_TRUE(assets.GetPath(MAKE_PATH("Deleted.nasset")).RemoveFile());
+		EXPECT_TRUE(assets.GetPath(MAKE_PATH("Meshes/Renamed.nasset")).MoveFileTo(assets.GetPath(MAKE_PATH("Meshes/Moved.nasset"))));
+
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_TRUE(database.HasAsset(addedGuid));
+		EXPECT_FALSE(database.HasAsset(deletedGuid));
+		EXPECT_EQ(database.GetAssetEntry(modifiedGuid)->m_assetTypeGuid, textureTypeGuid);
+		EXPECT_EQ(database.GetAssetCountOfAssetType(textureTypeGuid), 2u);
+		EXPECT_TRUE(database.HasAsset(renamedGuid));
+		EXPECT_TRUE(database.GetAssetEntry(renamedGuid)->m_path.GetView().EndsWith(MAKE_PATH("Moved.nasset")));
+		EXPECT_FALSE(stamps.m_files.Contains(assets.GetPath(MAKE_PATH("Deleted.nasset"))));
+		assets.ExpectMatchesFullScan(database);
+
+		// Deleting a directory removes all assets below it
+		const IO::Path meshesDirectory = assets.GetPath(MAKE_PATH("Meshes"));
+		meshesDirectory.EmptyDirectoryRecursively();
+		EXPECT_TRUE(meshesDirectory.RemoveDirectory());
+
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_FALSE(database.HasAsset(addedGuid));
+		EXPECT_FALSE(database.HasAsset(renamedGuid));
+		EXPECT_FALSE(database.HasAsset(nestedGuid));
+		EXPECT_EQ(database.GetAssetCount(), 1u);
+		EXPECT_EQ(stamps.m_files.GetSize(), 1u);
+		EXPECT_EQ(stamps.m_directories.GetSize(), 1u);
+		assets.ExpectMatchesFullScan(database);
+	}
+
+	UNIT_TEST(AssetDatabase, ApplyFileChange)
+	{
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		constexpr Asset::TypeGuid textureTypeGuid = "0c41fbd3-0c55-4a3e-9f8a-93f4a2c6d8e1"_guid;
+		const TestAssetDirectory assets(MAKE_PATH("AssetDatabaseFileChange"));
+
+		const Guid modifiedGuid = Guid::Generate();
+		const Guid deletedGuid = Guid::Generate();
+		const Guid renamedGuid = Guid::Generate();
+		const Guid directoryGuid = Guid::Generate();
+		EXPECT_TRUE(assets.GetPath(MAKE_PATH("Textures")).CreateDirectories());
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Modified.nasset")), modifiedGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Deleted.nasset")), deletedGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Renamed.nasset")), renamedGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Textures/Texture.nasset")), directoryGuid, textureTypeGuid);
+
+		Asset::Database database;
+		Asset::DatabaseStamps stamps;
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+
+		const Guid addedGuid = Guid::Generate();
+		const IO::Path addedFile = assets.GetPath(MAKE_PATH("Added.nasset"));
+		WriteAssetFile(addedFile, addedGuid, meshTypeGuid);
+		database.ApplyFileChange(addedFile, assets.m_rootDirectory, stamps);
+		EXPECT_TRUE(database.HasAsset(addedGuid));
+		EXPECT_TRUE(stamps.m_files.Contains(addedFile));
+
+		const IO::Path modifiedFile = assets.GetPath(MAKE_PATH("Modified.nasset"));
+		WriteAssetFile(modifiedFile, modifiedGuid, textureTypeGuid);
+		database.ApplyFileChange(modifiedFile, assets.m_rootDirectory, stamps);
+		EXPECT_EQ(database.GetAssetEntry(modifiedGuid)->m_assetTypeGuid, textureTypeGuid);
+
+		const IO::Path deletedFile = assets.GetPath(MAKE_PATH("Deleted.nasset"));
+		EXPECT_TRUE(deletedFile.RemoveFile());
+		database.ApplyFileChange(deletedFile, assets.m_rootDirectory, stamps);
+		EXPECT_FALSE(database.HasAsset(deletedGuid));
+		EXPECT_FALSE(stamps.m_files.Contains(deletedFile));
+
+		// Renames are reported as the removal of the old path followed by the addition of the new one
+		const IO::Path renamedFile = assets.GetPath(MAKE_PATH("Renamed.nasset"));
+		const IO::Path movedFile = assets.GetPath(MAKE_PATH("Moved.nasset"));
+		EXPECT_TRUE(renamedFile.MoveFileTo(movedFile));
+		database.ApplyFileChange(renamedFile, assets.m_rootDirectory, stamps);
+		database.ApplyFileChange(movedFile, assets.m_rootDirectory, stamps);
+		EXPECT_TRUE(database.HasAsset(renamedGuid));
+		EXPECT_TRUE(database.GetAssetEntry(renamedGuid)->m_path.GetView().EndsWith(MAKE_PATH("Moved.nasset")));
+		assets.ExpectMatchesFullScan(database);
+
+		const IO::Path texturesDirectory = assets.GetPath(MAKE_PATH("Textures"));
+		texturesDirectory.EmptyDirectoryRecursively();
+		EXPECT_TRUE(texturesDirectory.RemoveDirectory());
+		database.ApplyFileChange(texturesDirectory, assets.m_rootDirectory, stamps);
+		EXPECT_FALSE(database.HasAsset(directoryGuid));
+		EXPECT_FALSE(stamps.m_directories.Contains(texturesDirectory));
+		assets.ExpectMatchesFullScan(database);
+
+		// Changes applied one by one leave the stamps in a state that a later update agrees with
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		assets.ExpectMatchesFullScan(database);
+	}
+
+	UNIT_TEST(AssetDatabase, StampsRoundTrip)
+	{
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		const TestAssetDirectory assets(MAKE_PATH("AssetDatabaseStampsRoundTrip"));
+
+		EXPECT_TRUE(assets.GetPath(MAKE_PATH("Meshes")).CreateDirectories());
+		WriteAssetFile(assets.GetPath(MAKE_PATH("First.nasset")), Guid::Generate(), meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Meshes/Second.nasset")), Guid::Generate(), meshTypeGuid);
+
+		Asset::Database database;
+		Asset::DatabaseStamps stamps;
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_TRUE(database.Save(assets.m_databaseFile, Serialization::SavingFlags{}));
+		EXPECT_TRUE(stamps.Save(assets.m_databaseFile));
+
+		Asset::DatabaseStamps loadedStamps;
+		EXPECT_TRUE(loadedStamps.Load(assets.m_databaseFile));
+		EXPECT_EQ(loadedStamps.m_updateTime.GetSeconds(), stamps.m_updateTime.GetSeconds());
+		EXPECT_EQ(loadedStamps.m_files.GetSize(), stamps.m_files.GetSize());
+		for (const auto& filePair : stamps.m_files)
+		{
+			const Asset::DatabaseStamps::FileMap::const_iterator it = loadedStamps.m_files.Find(filePair.first);
+			EXPECT_TRUE(it != loadedStamps.m_files.end());
+			if (it != loadedStamps.m_files.end())
+			{
+				EXPECT_EQ(it->second.m_assetGuid, filePair.second.m_assetGuid);
+				EXPECT_EQ(it->second.m_modifiedTime.GetSeconds(), filePair.second.m_modifiedTime.GetSeconds());
+			}
+		}
+		EXPECT_EQ(loadedStamps.m_directories.GetSize(), stamps.m_directories.GetSize());
+		for (const auto& directoryPair : stamps.m_directories)
+		{
+			const Asset::DatabaseStamps::DirectoryMap::const_iterator it = loadedStamps.m_directories.Find(directoryPair.first);
+			EXPECT_TRUE(it != loadedStamps.m_directories.end());
+			if (it != loadedStamps.m_directories.end())
+			{
+				EXPECT_EQ(it->second.m_modifiedTime.GetSeconds(), directoryPair.second.m_modifiedTime.GetSeconds());
+				EXPECT_TRUE(it->second.m_fileNames.GetView() == directoryPair.second.m_fileNames.GetView());
+				EXPECT_TRUE(it->second.m_subdirectoryNames.GetView() == directoryPair.second.m_subdirectoryNames.GetView());
+			}
+		}
+
+		// The loaded database and stamps pick up changes made after saving
+		const Guid addedGuid = Guid::Generate();
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Meshes/Added.nasset")), addedGuid, meshTypeGuid);
+
+		Asset::Database loadedDatabase;
+		EXPECT_TRUE(loadedDatabase.Load(assets.m_databaseFile, assets.m_rootDirectory));
+		ExpectEqualDatabases(database, loadedDatabase, assets.m_rootDirectory);
+		EXPECT_TRUE(loadedDatabase.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, loadedStamps));
+		EXPECT_TRUE(loadedDatabase.HasAsset(addedGuid));
+		assets.ExpectMatchesFullScan(loadedDatabase);
+
+		// Missing stamps fail to load
+		Asset::DatabaseStamps missingStamps;
+		EXPECT_FALSE(missingStamps.Load(IO::Path::Combine(assets.m_rootDirectory, MAKE_PATH("Missing.nassetdb"))));
+	}
+
+	UNIT_TEST(AssetDatabase, SameSecondModificationIsNotTrusted)
+	{
+		const Time::Timestamp recordedTime = Time::Timestamp::FromSeconds(1000);
+		// Unchanged, and recorded before the previous update started
+		EXPECT_TRUE(Asset::DatabaseStamps::IsUnchanged(recordedTime, recordedTime, Time::Timestamp::FromSeconds(1001)));
+		// Modified within the second the previous update started, a later change in the same second would keep the time
+		EXPECT_FALSE(Asset::DatabaseStamps::IsUnchanged(recordedTime, recordedTime, Time::Timestamp::FromSeconds(1000)));
+		EXPECT_FALSE(Asset::DatabaseStamps::IsUnchanged(recordedTime, Time::Timestamp::FromSeconds(1002), Time::Timestamp::FromSeconds(1003)));
+		EXPECT_FALSE(Asset::DatabaseStamps::IsUnchanged(Time::Timestamp{}, Time::Timestamp{}, Time::Timestamp::FromSeconds(1001)));
+
+		// Rewriting a file right after an update usually keeps its modification time in seconds, it must still be parsed again
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		constexpr Asset::TypeGuid textureTypeGuid = "0c41fbd3-0c55-4a3e-9f8a-93f4a2c6d8e1"_guid;
+		const TestAssetDirectory assets(MAKE_PATH("AssetDatabaseSameSecond"));
+		const Guid assetGuid = Guid::Generate();
+		const IO::Path assetFile = assets.GetPath(MAKE_PATH("Asset.nasset"));
+		WriteAssetFile(assetFile, assetGuid, meshTypeGuid);
+
+		Asset::Database database;
+		Asset::DatabaseStamps stamps;
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_EQ(database.GetAssetEntry(assetGuid)->m_assetTypeGuid, meshTypeGuid);
+
+		WriteAssetFile(assetFile, assetGuid, textureTypeGuid);
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_EQ(database.GetAssetEntry(assetGuid)->m_assetTypeGuid, textureTypeGuid);
+		assets.ExpectMatchesFullScan(database);
+	}
+
+	UNIT_TEST(AssetDatabase, UpdateDetectsDuplicateGuids)
+	{
+		constexpr Asset::TypeGuid meshTypeGuid = "5a7e8e33-4bd1-4a88-8f62-2f1c6a2b1f10"_guid;
+		const TestAssetDirectory assets(MAKE_PATH("AssetDatabaseUpdateDuplicates"));
+
+		const Guid firstGuid = Guid::Generate();
+		const Guid secondGuid = Guid::Generate();
+		WriteAssetFile(assets.GetPath(MAKE_PATH("First.nasset")), firstGuid, meshTypeGuid);
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Second.nasset")), secondGuid, meshTypeGuid);
+
+		Asset::Database database;
+		Asset::DatabaseStamps stamps;
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+
+		// A file changing its guid to one owned by another file
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Second.nasset")), firstGuid, meshTypeGuid);
+		EXPECT_FALSE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_TRUE(database.HasAsset(firstGuid));
+		EXPECT_FALSE(database.HasAsset(secondGuid));
+
+		// A new file using a guid owned by another file
+		WriteAssetFile(assets.GetPath(MAKE_PATH("Third.nasset")), firstGuid, meshTypeGuid);
+		EXPECT_FALSE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_EQ(database.GetAssetCount(), 1u);
+		EXPECT_TRUE(database.GetAssetEntry(firstGuid)->m_path.GetView().EndsWith(MAKE_PATH("First.nasset")));
+
+		// Deleting a file that declared a duplicate guid leaves the owner registered
+		EXPECT_TRUE(assets.GetPath(MAKE_PATH("Second.nasset")).RemoveFile());
+		EXPECT_FALSE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_TRUE(database.HasAsset(firstGuid));
+		EXPECT_TRUE(database.GetAssetEntry(firstGuid)->m_path.GetView().EndsWith(MAKE_PATH("First.nasset")));
+
+		const IO::Path thirdFile = assets.GetPath(MAKE_PATH("Third.nasset"));
+		database.ApplyFileChange(thirdFile, assets.m_rootDirectory, stamps);
+		EXPECT_TRUE(database.GetAssetEntry(firstGuid)->m_path.GetView().EndsWith(MAKE_PATH("First.nasset")));
+
+		// Deleting the owner removes its asset, and the remaining file declaring the guid takes it over
+		const IO::Path firstFile = assets.GetPath(MAKE_PATH("First.nasset"));
+		EXPECT_TRUE(firstFile.RemoveFile());
+		database.ApplyFileChange(firstFile, assets.m_rootDirectory, stamps);
+		EXPECT_FALSE(database.HasAsset(firstGuid));
+
+		EXPECT_TRUE(database.UpdateAllAssetsInDirectory(assets.m_assetDirectory, assets.m_rootDirectory, stamps));
+		EXPECT_TRUE(database.HasAsset(firstGuid));
+		EXPECT_TRUE(database.GetAssetEntry(firstGuid)->m_path.GetView().EndsWith(MAKE_PATH("Third.nasset")));
+		assets.ExpectMatchesFullScan(database);
+	}
+}
@@ -0,0 +1,37 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Platform/GetProcessorTopology.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(ProcessorTopology, ParseLogicalProcessorList)
+	{
+		const Platform::LogicalProcessorMask mask = Platform::Internal::ParseLogicalProcessorList("0-3,8,10-11\n");
+		EXPECT_EQ(mask.GetNumberOfSetBits(), 7u);
+		EXPECT_TRUE(mask.IsSet(0));
+		EXPECT_TRUE(mask.IsSet(3));
+		EXPECT_FALSE(mask.IsSet(4));
+		EXPECT_TRUE(mask.IsSet(8));
+		EXPECT_FALSE(mask.IsSet(9));
+		EXPECT_TRUE(mask.IsSet(10));
+		EXPECT_TRUE(mask.IsSet(11));
+		EXPECT_FALSE(mask.IsSet(12));
+
+		EXPECT_TRUE(Platform::Internal::ParseLogicalProcessorList("").AreNoneSet());
+		EXPECT_TRUE(Platform::Internal::ParseLogicalProcessorList("\n").AreNoneSet());
+	}
+
+	UNIT_TEST(ProcessorTopology, GetProcessorTopology)
+	{
+		const Platform::ProcessorTopology& topology = Platform::GetProcessorTopology();
+		EXPECT_TRUE(topology.m_logicalProcessors.HasElements());
+		for (const Platform::ProcessorTopology::LogicalProcessor& processor : topology.m_logicalProcessors)
+		{
+			EXPECT_LT(processor.m_cacheDomainIndex, topology.m_cacheDomainCount);
+			EXPECT_LT(processor.m_numaNodeIndex, topology.m_numaNodeCount);
+			EXPECT_TRUE(topology.GetCacheDomainProcessorMask(processor.m_cacheDomainIndex).IsSet(processor.m_index));
+		}
+	}
+}
@@ -7,6 +7,9 @@
 #include <Common/Memory/Allocators/DynamicInlineStorageAllocator.h>
 #include <Common/Memory/Allocators/DynamicAllocator.h>
 #include <Common/Memory/Allocators/FixedAllocator.h>
+#include <Common/Memory/Allocators/ArenaAllocator.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Memory/Containers/String.h>
 
 namespace ngine::Memory
 {
@@ -14,6 +17,7 @@ namespace ngine::Memory
 	template struct FixedAllocator<int, 1>;
 	template struct DynamicAllocator<int, uint32, uint32>;
 	template struct DynamicInlineStorageAllocator<int, 1, uint32, uint32>;
+	template struct ArenaAllocator<int, uint32, uint32>;
 }
 
 namespace ngine::Tests
@@ -258,4 +262,73 @@ namespace ngine::Tests
 			EXPECT_EQ(allocator.GetData()[i], i);
 		}
 	}
+
+	UNIT_TEST(Arena, ScopedReset)
+	{
+		Memory::Arena arena(256);
+		void* pFirst = arena.Allocate(64);
+		EXPECT_NE(pFirst, nullptr);
+		EXPECT_TRUE(arena.Contains(pFirst));
+
+		void* pScoped;
+		{
+			Memory::Arena::Scope scope(arena);
+			pScoped = arena.Allocate(32);
+			// Larger than the block size, served from a dedicated block
+			void* pLarge = arena.Allocate(1024);
+			EXPECT_NE(pLarge, nullptr);
+			EXPECT_TRUE(arena.Contains(pLarge));
+		}
+		EXPECT_FALSE(arena.Contains(pScoped));
+		EXPECT_TRUE(arena.Contains(pFirst));
+
+		// Memory released by the scope is handed out again
+		EXPECT_EQ(arena.Allocate(32), pScoped);
+
+		arena.Reset();
+		EXPECT_FALSE(arena.Contains(pFirst));
+		EXPECT_EQ(arena.Allocate(64), pFirst);
+	}
+
+	UNIT_TEST(Arena, GrowLastAllocationInPlace)
+	{
+		Memory::Arena arena(256);
+		void* pData = arena.Allocate(16);
+		EXPECT_EQ(arena.Reallocate(pData, 16, 64), pData);
+
+		void* pOther = arena.Allocate(16);
+		static_cast<uint8*>(pData)[0] = 42;
+		void* pMoved = arena.Reallocate(pData, 64, 128);
+		EXPECT_NE(pMoved, pData);
+		EXPECT_EQ(static_cast<uint8*>(pMoved)[0], 42);
+
+		// Freeing the most recent allocation makes its memory available again
+		arena.Deallocate(pMoved);
+		EXPECT_EQ(arena.Allocate(128), pMoved);
+		EXPECT_NE(pOther, nullptr);
+	}
+
+	UNIT_TEST(ArenaAllocator, Containers)
+	{
+		Memory::Arena& arena = Memory::Arena::GetThreadArena();
+		Memory::Arena::Scope scope(arena);
+
+		Vector<int, uint32, uint32, Memory::ArenaAllocator<int, uint32>> vector;
+		for (int i = 0; i < 100; ++i)
+		{
+			vector.EmplaceBack(i);
+		}
+		EXPECT_TRUE(arena.Contains(vector.GetData()));
+		for (int i = 0; i < 100; ++i)
+		{
+			EXPECT_EQ(vector[i], i);
+		}
+
+		using ArenaString =
+			TString<char, Memory::ArenaAllocator<char, uint32>, Memory::VectorFlags::AllowReallocate | Memory::VectorFlags::AllowResize>;
+		ArenaString string("Transient");
+		string += " string";
+		EXPECT_TRUE(arena.Contains(string.GetData()));
+		EXPECT_EQ(string.GetView(), ConstStringView("Transient string"));
+	}
 }
@@ -213,4 +213,90 @@ namespace ngine::Tests
 		EXPECT_FALSE(elements.GetDynamicView().Overlaps(ArrayView<const int>{elements.begin() - 1, 1}));
 		EXPECT_FALSE(elements.GetDynamicView().Overlaps(ArrayView<const int>{elements.end(), 2}));
 	}
+
+	template<typename Type>
+	static void TestVectorizedSearch()
+	{
+		// Values repeat irregularly so that ranges have partial matches and overlapping prefixes
+		Array<Type, 67> elements;
+		for (uint32 index = 0; index < elements.GetSize(); ++index)
+		{
+			elements[index] = static_cast<Type>((index * index + index / 7u) % 5u);
+		}
+
+		for (uint32 count = 0; count <= elements.GetSize(); ++count)
+		{
+			const ArrayView<const Type> view = elements.GetSubView(0u, count);
+			for (uint32 value = 0; value < 6; ++value)
+			{
+				uint32 expectedFirstIndex = count;
+				uint32 expectedLastIndex = count;
+				for (uint32 index = 0; index < count; ++index)
+				{
+					if (view[index] == static_cast<Type>(value))
+					{
+						expectedFirstIndex = expectedFirstIndex == count ? index : expectedFirstIndex;
+						expectedLastIndex = index;
+					}
+				}
+
+				const auto firstIt = view.Find(static_cast<Type>(value));
+				EXPECT_EQ(firstIt.IsValid(), expectedFirstIndex != count);
+				EXPECT_EQ(firstIt.IsValid() ? view.GetIteratorIndex(firstIt.Get()) : count, expectedFirstIndex);
+
+				const auto lastIt = view.FindLastOf(static_cast<Type>(value));
+				EXPECT_EQ(lastIt.IsValid(), expectedLastIndex != count);
+				EXPECT_EQ(lastIt.IsValid() ? view.GetIteratorIndex(lastIt.Get()) : count, expectedLastIndex);
+			}
+
+			for (uint32 rangeIndex = 0; rangeIndex + 4u <= elements.GetSize(); rangeIndex += 9u)
+			{
+				for (uint32 rangeCount = 1; rangeCount <= 4u; ++rangeCount)
+				{
+					const ArrayView<const Type> range = elements.GetSubView(rangeIndex, rangeCount);
+					uint32 expectedFirstIndex = count;
+					uint32 expectedLastIndex = count;
+					for (uint32 index = 0; index + rangeCount <= count; ++index)
+					{
+						if (view.GetSubView(index, rangeCount) == range)
+						{
+							expectedFirstIndex = expectedFirstIndex == count ? index : expectedFirstIndex;
+							expectedLastIndex = index;
+						}
+					}
+
+					const ArrayView<const Type> firstRange = view.FindFirstRange(range);
+					EXPECT_EQ(firstRange.HasElements() ? view.GetIteratorIndex(firstRange.GetData()) : count, expectedFirstIndex);
+					const ArrayView<const Type> lastRange = view.FindLastRange(range);
+					EXPECT_EQ(lastRange.HasElements() ? view.GetIteratorIndex(lastRange.GetData()) : count, expectedLastIndex);
+				}
+			}
+		}
+	}
+
+	UNIT_TEST(ArrayView, VectorizedSearch)
+	{
+		TestVectorizedSearch<uint8>();
+		TestVectorizedSearch<uint16>();
+		TestVectorizedSearch<uint32>();
+		TestVectorizedSearch<uint64>();
+		TestVectorizedSearch<int>();
+	}
+
+	UNIT_TEST(ArrayView, FindFirstOfAny)
+	{
+		const ArrayView<const char> view{"assets/textures\\environment/rock.png", 36};
+
+		const auto separatorIt = view.FindFirstOfAny(ArrayView<const char>{"\\/", 2});
+		EXPECT_TRUE(separatorIt.IsValid());
+		EXPECT_EQ(view.GetIteratorIndex(separatorIt.Get()), 6u);
+
+		const auto extensionIt = view.FindFirstOfAny(ArrayView<const char>{".:;,!", 5});
+		EXPECT_TRUE(extensionIt.IsValid());
+		EXPECT_EQ(view.GetIteratorIndex(extensionIt.Get()), 32u);
+
+		EXPECT_FALSE(view.FindFirstOfAny(ArrayView<const char>{"#%", 2}).IsValid());
+		EXPECT_FALSE(view.FindFirstOfAny(ArrayView<const char>{}).IsValid());
+		EXPECT_TRUE(view.ContainsAny(ArrayView<const char>{"xyz", 3}));
+	}
 }
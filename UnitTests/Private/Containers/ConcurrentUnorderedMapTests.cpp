@@ -0,0 +1,135 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Memory/Containers/ConcurrentUnorderedMap.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Threading/Thread.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(ConcurrentUnorderedMap, Basic)
+	{
+		ConcurrentUnorderedMap<int, int> map;
+		EXPECT_TRUE(map.IsEmpty());
+		EXPECT_FALSE(map.Contains(1));
+		EXPECT_FALSE(map.Find(1).IsValid());
+
+		EXPECT_TRUE(map.Emplace(1, 10));
+		EXPECT_TRUE(map.Emplace(2, 20));
+		EXPECT_FALSE(map.Emplace(1, 30));
+		EXPECT_EQ(map.GetSize(), 2u);
+		EXPECT_FALSE(map.IsEmpty());
+		EXPECT_TRUE(map.Contains(1));
+		EXPECT_EQ(*map.Find(1), 10);
+		EXPECT_EQ(*map.Find(2), 20);
+
+		map.EmplaceOrAssign(1, 30);
+		EXPECT_EQ(*map.Find(1), 30);
+
+		EXPECT_TRUE(map.Modify(
+			2,
+			[](int& value)
+			{
+				value++;
+			}
+		));
+		int visitedValue = 0;
+		EXPECT_TRUE(map.Visit(
+			2,
+			[&visitedValue](const int value)
+			{
+				visitedValue = value;
+			}
+		));
+		EXPECT_EQ(visitedValue, 21);
+		EXPECT_FALSE(map.Visit(
+			3,
+			[](const int)
+			{
+			}
+		));
+
+		EXPECT_EQ(
+			map.FindOrEmplace(
+				3,
+				[]()
+				{
+					return 40;
+				}
+			),
+			40
+		);
+		EXPECT_EQ(
+			map.FindOrEmplace(
+				3,
+				[]()
+				{
+					return 50;
+				}
+			),
+			40
+		);
+
+		int sum = 0;
+		map.ForEach(
+			[&sum](const int key, const int value)
+			{
+				sum += key + value;
+			}
+		);
+		EXPECT_EQ(sum, 1 + 30 + 2 + 21 + 3 + 40);
+
+		EXPECT_TRUE(map.Remove(1));
+		EXPECT_FALSE(map.Remove(1));
+		EXPECT_FALSE(map.Contains(1));
+		EXPECT_EQ(map.GetSize(), 2u);
+
+		map.Clear();
+		EXPECT_TRUE(map.IsEmpty());
+	}
+
+	UNIT_TEST(ConcurrentUnorderedMap, ParallelWritersAndReaders)
+	{
+		constexpr int elementsPerThread = 10000;
+		ConcurrentUnorderedMap<int, int> map(Memory::Reserve, elementsPerThread * 4);
+		Threading::Atomic<int> mismatchCount{0};
+
+		auto write = [&map](const int threadIndex)
+		{
+			for (int i = 0; i < elementsPerThread; ++i)
+			{
+				const int key = threadIndex * elementsPerThread + i;
+				map.Emplace(key, key * 2);
+			}
+		};
+		auto read = [&map, &mismatchCount](const int threadIndex)
+		{
+			int mismatches = 0;
+			for (int i = 0; i < elementsPerThread; ++i)
+			{
+				const int key = threadIndex * elementsPerThread + i;
+				const Optional<int> value = map.Find(key);
+				// Readers may run ahead of the writers, but must never observe a partially written value
+				mismatches += value.IsValid() && *value != key * 2;
+			}
+			mismatchCount += mismatches;
+		};
+
+		{
+			// Threads are joined when they go out of scope
+			Threading::Thread writer0(write, 0);
+			Threading::Thread writer1(write, 1);
+			Threading::Thread reader0(read, 0);
+			Threading::Thread reader1(read, 1);
+		}
+
+		EXPECT_EQ(map.GetSize(), uint32(elementsPerThread * 2));
+		EXPECT_EQ(mismatchCount.Load(), 0);
+		for (int key = 0; key < elementsPerThread * 2; ++key)
+		{
+			const Optional<int> value = map.Find(key);
+			EXPECT_TRUE(value.IsValid() && *value == key * 2);
+		}
+	}
+}
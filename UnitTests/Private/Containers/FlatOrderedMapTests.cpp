@@ -0,0 +1,166 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Memory/Containers/FlatOrderedMap.h>
+#include <Common/Memory/Containers/FlatOrderedSet.h>
+#include <Common/Memory/Containers/OrderedMap.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Time/Stopwatch.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(FlatOrderedMap, DefaultConstruct)
+	{
+		FlatOrderedMap<int, int> map;
+		EXPECT_TRUE(map.IsEmpty());
+		EXPECT_FALSE(map.HasElements());
+		EXPECT_EQ(map.GetSize(), 0u);
+		EXPECT_EQ(map.begin(), map.end());
+		EXPECT_EQ(map.Find(0), map.end());
+		EXPECT_FALSE(map.Contains(0));
+	}
+
+	UNIT_TEST(FlatOrderedMap, Emplace)
+	{
+		FlatOrderedMap<int, String> map;
+		map.Emplace(3, String("three"));
+		map.Emplace(1, String("one"));
+		map.Emplace(2, String("two"));
+		EXPECT_EQ(map.Emplace(2, String("other"))->second, "two");
+		EXPECT_EQ(map.GetSize(), 3u);
+
+		// Iteration is ordered by key
+		int expectedKey = 1;
+		for (const auto& pair : map)
+		{
+			EXPECT_EQ(pair.first, expectedKey);
+			expectedKey++;
+		}
+
+		EXPECT_TRUE(map.Contains(1));
+		EXPECT_FALSE(map.Contains(4));
+		EXPECT_EQ(map.Find(3)->second, "three");
+		EXPECT_EQ(map.LowerBound(0)->first, 1);
+		EXPECT_EQ(map.LowerBound(4), map.end());
+
+		map.EmplaceOrAssign(2, String("second"));
+		EXPECT_EQ(map.Find(2)->second, "second");
+		EXPECT_EQ(map.GetSize(), 3u);
+
+		EXPECT_EQ(map.Remove(map.Find(1))->first, 2);
+		EXPECT_TRUE(map.Remove(3));
+		EXPECT_FALSE(map.Remove(3));
+		EXPECT_EQ(map.GetSize(), 1u);
+		EXPECT_EQ(map.begin()->first, 2);
+	}
+
+	UNIT_TEST(FlatOrderedMap, EmplaceRange)
+	{
+		FlatOrderedMap<int, int> map;
+		map.Emplace(5, 50);
+		map.Emplace(1, 10);
+
+		using PairType = FlatOrderedMap<int, int>::PairType;
+		PairType pairs[] = {PairType{4, 40}, PairType{5, 0}, PairType{2, 20}, PairType{3, 30}, PairType{2, 0}, PairType{0, 0}};
+		map.MoveEmplaceRange(pairs);
+
+		// Existing keys and the first occurrence in the range are kept
+		EXPECT_EQ(map.GetSize(), 6u);
+		int expectedKey = 0;
+		for (const auto& pair : map)
+		{
+			EXPECT_EQ(pair.first, expectedKey);
+			EXPECT_EQ(pair.second, expectedKey * 10);
+			expectedKey++;
+		}
+	}
+
+	UNIT_TEST(FlatOrderedSet, Basic)
+	{
+		FlatOrderedSet<int> set;
+		for (int i = 99; i >= 0; --i)
+		{
+			set.Emplace(int(i * 2));
+		}
+		set.Insert(10);
+		EXPECT_EQ(set.GetSize(), 100u);
+
+		int expected = 0;
+		for (const int value : set)
+		{
+			EXPECT_EQ(value, expected);
+			expected += 2;
+		}
+
+		for (int i = 0; i < 200; ++i)
+		{
+			EXPECT_EQ(set.Contains(i), i % 2 == 0);
+			EXPECT_EQ(*set.LowerBound(i), i + (i % 2));
+		}
+		EXPECT_EQ(set.LowerBound(199), set.end());
+
+		const int values[] = {-1, 201, 4};
+		set.CopyEmplaceRange(values);
+		EXPECT_EQ(set.GetSize(), 102u);
+		EXPECT_EQ(*set.begin(), -1);
+		EXPECT_EQ(set.GetView().GetLastElement(), 201);
+	}
+
+	//! Compares lookups in a FlatOrderedMap against OrderedMap with the same contents
+	//! Disabled by default as it is a benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*LookupTiming.
+	//! The timings are recorded as test properties in microseconds, the test itself only validates that both found the same values.
+	UNIT_TEST(FlatOrderedMap, DISABLED_LookupTiming)
+	{
+		constexpr uint32 elementCount = 1u << 16;
+		constexpr uint32 lookupCount = 1u << 20;
+
+		Vector<FlatOrderedMap<uint32, uint32>::PairType> pairs(Memory::Reserve, elementCount);
+		OrderedMap<uint32, uint32> orderedMap;
+		uint32 seed = 12345;
+		for (uint32 i = 0; i < elementCount; ++i)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			pairs.EmplaceBack(FlatOrderedMap<uint32, uint32>::PairType{seed, i});
+			orderedMap.Emplace(uint32(seed), uint32(i));
+		}
+
+		FlatOrderedMap<uint32, uint32> flatMap;
+		Time::Stopwatch bulkInsertStopwatch(Time::Stopwatch::Elapsing);
+		flatMap.MoveEmplaceRange(pairs.GetView());
+		const Time::Stopwatch::DurationType bulkInsertTime = bulkInsertStopwatch.GetElapsedTime();
+		EXPECT_EQ(flatMap.GetSize(), orderedMap.GetSize());
+
+		Vector<uint32> keys(Memory::Reserve, lookupCount);
+		for (uint32 i = 0; i < lookupCount; ++i)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			// Look up existing keys half of the time
+			keys.EmplaceBack((seed & 1) ? flatMap.GetView()[(seed >> 1) % elementCount].first : seed);
+		}
+
+		uint64 orderedSum = 0;
+		Time::Stopwatch orderedStopwatch(Time::Stopwatch::Elapsing);
+		for (const uint32 key : keys)
+		{
+			const OrderedMap<uint32, uint32>::const_iterator it = orderedMap.Find(key);
+			orderedSum += it != orderedMap.end() ? it->second : 0u;
+		}
+		const Time::Stopwatch::DurationType orderedTime = orderedStopwatch.GetElapsedTime();
+
+		uint64 flatSum = 0;
+		Time::Stopwatch flatStopwatch(Time::Stopwatch::Elapsing);
+		for (const uint32 key : keys)
+		{
+			const FlatOrderedMap<uint32, uint32>::const_iterator it = flatMap.Find(key);
+			flatSum += it != flatMap.end() ? it->second : 0u;
+		}
+		const Time::Stopwatch::DurationType flatTime = flatStopwatch.GetElapsedTime();
+
+		EXPECT_EQ(orderedSum, flatSum);
+		RecordProperty("FlatOrderedMapBulkInsertMicroseconds", int64(bulkInsertTime.GetMilliseconds() * 1000.0));
+		RecordProperty("OrderedMapFindMicroseconds", int64(orderedTime.GetMilliseconds() * 1000.0));
+		RecordProperty("FlatOrderedMapFindMicroseconds", int64(flatTime.GetMilliseconds() * 1000.0));
+	}
+}
@@ -6,6 +6,8 @@
 #include <Common/Memory/Containers/UnorderedMap.h>
 #include <Common/Memory/Containers/UnorderedSet.h>
 #include <Common/Memory/Allocators/DynamicAllocator.h>
+#include <Common/Memory/Containers/Vector.h>
+#include <Common/Time/Stopwatch.h>
 
 PUSH_MSVC_WARNINGS_TO_LEVEL(2)
 PUSH_CLANG_WARNINGS
@@ -434,4 +436,109 @@ namespace ngine::Tests
 		EXPECT_EQ(hashTable.Find(1337), hashTable.end());
 		EXPECT_EQ(hashTable.Find(9001), hashTable.end());
 	}
+
+	UNIT_TEST(HashTable, FindMany)
+	{
+		HashTable<int> hashTable;
+		for (int i = 0; i < 1000; i += 2)
+		{
+			hashTable.Emplace(int(i));
+		}
+
+		Vector<int, uint32> keys(Memory::Reserve, 1000);
+		for (int i = 999; i >= 0; --i)
+		{
+			keys.EmplaceBack(i);
+		}
+		Vector<int*, uint32> elements(Memory::ConstructWithSize, Memory::Zeroed, keys.GetSize());
+		hashTable.FindMany(keys.GetView(), elements.GetView());
+		for (uint32 index = 0; index < keys.GetSize(); ++index)
+		{
+			if (keys[index] % 2 == 0)
+			{
+				EXPECT_TRUE(elements[index] != nullptr && *elements[index] == keys[index]);
+				EXPECT_EQ(elements[index], &*hashTable.Find(keys[index]));
+			}
+			else
+			{
+				EXPECT_EQ(elements[index], nullptr);
+			}
+		}
+
+		const HashTable<int> emptyHashTable;
+		Vector<const int*, uint32> constElements(Memory::ConstructWithSize, Memory::Zeroed, keys.GetSize());
+		emptyHashTable.FindMany(keys.GetView(), constElements.GetView());
+		for (const int* pElement : constElements)
+		{
+			EXPECT_EQ(pElement, nullptr);
+		}
+	}
+
+	UNIT_TEST(HashTable, UnorderedMapFindMany)
+	{
+		UnorderedMap<int, int> map;
+		for (int i = 0; i < 100; ++i)
+		{
+			map.Emplace(int(i * 3), int(i));
+		}
+
+		Vector<int, uint32> keys(Memory::Reserve, 300);
+		for (int i = 0; i < 300; ++i)
+		{
+			keys.EmplaceBack(i);
+		}
+		Vector<const int*, uint32> values(Memory::ConstructWithSize, Memory::Zeroed, keys.GetSize());
+		const UnorderedMap<int, int>& constMap = map;
+		constMap.FindMany(keys.GetView(), values.GetView());
+		for (uint32 index = 0; index < keys.GetSize(); ++index)
+		{
+			if (keys[index] % 3 == 0)
+			{
+				EXPECT_TRUE(values[index] != nullptr && *values[index] == keys[index] / 3);
+			}
+			else
+			{
+				EXPECT_EQ(values[index], nullptr);
+			}
+		}
+	}
+
+	//! Compares FindMany against looking up the same keys one at a time in a table that does not fit in cache
+	//! Disabled by default as it is a benchmark, run with --gtest_also_run_disabled_tests --gtest_filter=*FindManyTiming.
+	//! The timings are recorded as test properties in microseconds, the test itself only validates that both found the same elements.
+	UNIT_TEST(HashTable, DISABLED_FindManyTiming)
+	{
+		constexpr uint32 elementCount = 1u << 20;
+		HashTable<uint32> hashTable(Memory::Reserve, elementCount);
+		for (uint32 i = 0; i < elementCount; ++i)
+		{
+			hashTable.Emplace(uint32(i * 7));
+		}
+
+		Vector<uint32, uint32> keys(Memory::Reserve, elementCount);
+		uint32 seed = 12345;
+		for (uint32 i = 0; i < elementCount; ++i)
+		{
+			seed = seed * 1664525u + 1013904223u;
+			keys.EmplaceBack((seed >> 8) % (elementCount * 7));
+		}
+
+		Vector<uint32*, uint32> individualElements(Memory::ConstructWithSize, Memory::Zeroed, elementCount);
+		Time::Stopwatch individualStopwatch(Time::Stopwatch::Elapsing);
+		for (uint32 index = 0; index < elementCount; ++index)
+		{
+			const HashTable<uint32>::iterator it = hashTable.Find(keys[index]);
+			individualElements[index] = it != hashTable.end() ? &*it : nullptr;
+		}
+		const Time::Stopwatch::DurationType individualTime = individualStopwatch.GetElapsedTime();
+
+		Vector<uint32*, uint32> batchedElements(Memory::ConstructWithSize, Memory::Zeroed, elementCount);
+		Time::Stopwatch batchedStopwatch(Time::Stopwatch::Elapsing);
+		hashTable.FindMany(keys.GetView(), batchedElements.GetView());
+		const Time::Stopwatch::DurationType batchedTime = batchedStopwatch.GetElapsedTime();
+
+		EXPECT_TRUE(individualElements.GetView() == batchedElements.GetView());
+		RecordProperty("FindMicroseconds", int64(individualTime.GetMilliseconds() * 1000.0));
+		RecordProperty("FindManyMicroseconds", int64(batchedTime.GetMilliseconds() * 1000.0));
+	}
 }
@@ -0,0 +1,58 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Memory/Containers/OrderedMap.h>
+#include <Common/Memory/Containers/OrderedSet.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(OrderedMap, EmplaceFindAndRemove)
+	{
+		OrderedMap<int, float> map;
+		EXPECT_TRUE(map.IsEmpty());
+		EXPECT_TRUE(map.Find(0) == map.end());
+
+		map.Emplace(30, 3.f);
+		map.Emplace(10, 1.f);
+		map.Emplace(20, 2.f);
+		EXPECT_EQ(map.GetSize(), 3u);
+		EXPECT_TRUE(map.Contains(20));
+		EXPECT_FALSE(map.Contains(15));
+
+		const OrderedMap<int, float>::const_iterator it = map.Find(20);
+		EXPECT_TRUE(it != map.end());
+		EXPECT_EQ(it->second, 2.f);
+
+		// Iterates in key order
+		int previousKey = 0;
+		for (const auto& pair : map)
+		{
+			EXPECT_GT(pair.first, previousKey);
+			previousKey = pair.first;
+		}
+
+		const OrderedMap<int, float>::iterator nextIt = map.Remove(map.Find(10));
+		EXPECT_TRUE(nextIt != map.end());
+		EXPECT_EQ(nextIt->first, 20);
+		EXPECT_FALSE(map.Contains(10));
+		EXPECT_EQ(map.GetSize(), 2u);
+	}
+
+	UNIT_TEST(OrderedSet, EmplaceFindAndRemove)
+	{
+		OrderedSet<int> set;
+		set.Emplace(3);
+		set.Emplace(1);
+		set.Emplace(2);
+		EXPECT_EQ(set.GetSize(), 3u);
+		EXPECT_TRUE(set.Contains(2));
+		EXPECT_FALSE(set.Contains(4));
+		EXPECT_EQ(*set.begin(), 1);
+
+		const OrderedSet<int>::const_iterator nextIt = set.Remove(set.Find(1));
+		EXPECT_TRUE(nextIt != set.end());
+		EXPECT_EQ(*nextIt, 2);
+		EXPECT_FALSE(set.Contains(1));
+	}
+}
@@ -258,6 +258,42 @@ namespace ngine::Tests
 		EXPECT_EQ(utf16, u"standard");
 	}
 
+	UNIT_TEST(String, ConvertNonASCII)
+	{
+		const UTF8String utf8 = u8"Gr\u00FC\u00DFe \u65E5\u672C \U0001F3AE assets/textures/environment/rock";
+		const UTF16String utf16(utf8);
+		const UTF32String utf32(utf8);
+
+		EXPECT_EQ(utf8.GetSize(), 52u);
+		EXPECT_EQ(utf16.GetSize(), 44u);
+		EXPECT_EQ(utf16.GetCapacity(), 44u);
+		EXPECT_EQ(utf32.GetSize(), 43u);
+		EXPECT_EQ(utf32.GetCapacity(), 43u);
+		EXPECT_EQ(utf16, u"Gr\u00FC\u00DFe \u65E5\u672C \U0001F3AE assets/textures/environment/rock");
+		EXPECT_EQ(utf32, U"Gr\u00FC\u00DFe \u65E5\u672C \U0001F3AE assets/textures/environment/rock");
+
+		EXPECT_EQ(UTF8String(utf16), utf8);
+		EXPECT_EQ(UTF8String(utf32), utf8);
+		EXPECT_EQ(UTF16String(utf32), utf16);
+		EXPECT_EQ(UTF32String(utf16), utf32);
+	}
+
+	UNIT_TEST(String, ConvertInvalidUTF8)
+	{
+		// Overlong encoding, truncated sequence and an encoded surrogate are each replaced by U+FFFD
+		const UTF8CharType invalid[] = {'a', UTF8CharType(0xC0), UTF8CharType(0xAF), UTF8CharType(0xE2), UTF8CharType(0x82), 'b',
+		                                UTF8CharType(0xED), UTF8CharType(0xA0), UTF8CharType(0x80)};
+		const TStringView<const UTF8CharType> source{invalid, 9};
+		EXPECT_EQ(Internal::GetUTF16Length(source), 5u);
+
+		char16_t converted[5];
+		EXPECT_FALSE(Internal::UTF8ToUTF16(TStringView<char16_t>{converted, 5}, source));
+		EXPECT_EQ(TStringView<const char16_t>(converted, 5), TStringView<const char16_t>(u"a\uFFFD\uFFFDb\uFFFD", 5));
+
+		const char16_t unpairedSurrogate[] = {u'a', char16_t(0xD800), u'b'};
+		EXPECT_EQ(Internal::GetUTF8Length(TStringView<const char16_t>{unpairedSurrogate, 3}), 5u);
+	}
+
 	UNIT_TEST(String, MoveConstruct)
 	{
 		String string = "test";
@@ -537,4 +573,22 @@ namespace ngine::Tests
 			EXPECT_EQ(&substring[0], &test[0]);
 		}
 	}
+
+	UNIT_TEST(StringView, FindOverlappingRanges)
+	{
+		constexpr ConstStringView shortString = "aaab";
+		EXPECT_EQ(shortString.FindFirstRange("aab").GetData(), &shortString[1]);
+		EXPECT_EQ(shortString.FindLastRange("aa").GetData(), &shortString[1]);
+		EXPECT_TRUE(shortString.FindLastRange("aaaab").IsEmpty());
+
+		constexpr ConstStringView longString = "data/data/data/data/data/data/database.nassetdb";
+		EXPECT_EQ(longString.FindFirstRange("database").GetData(), &longString[30]);
+		EXPECT_EQ(longString.FindLastRange("data/").GetData(), &longString[25]);
+		EXPECT_TRUE(longString.Contains(ConstStringView{".nassetdb"}));
+		EXPECT_FALSE(longString.Contains(ConstStringView{"data/base"}));
+
+		EXPECT_EQ(longString.FindFirstOfAny("./"), 4u);
+		EXPECT_EQ(longString.FindFirstOfAny("./", 30), 38u);
+		EXPECT_EQ(longString.FindFirstOfAny("xyz"), ConstStringView::InvalidPosition);
+	}
 }
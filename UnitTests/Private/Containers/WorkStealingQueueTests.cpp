@@ -0,0 +1,126 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Memory/Containers/WorkStealingQueue.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(WorkStealingQueue, PushPop)
+	{
+		TWorkStealingQueue<int*, 4> queue;
+		EXPECT_TRUE(queue.IsEmpty());
+		EXPECT_EQ(queue.Pop(), nullptr);
+
+		int values[3] = {1, 2, 3};
+		EXPECT_TRUE(queue.Push(&values[0]));
+		EXPECT_TRUE(queue.Push(&values[1]));
+		EXPECT_TRUE(queue.Push(&values[2]));
+		EXPECT_EQ(queue.GetSize(), 3u);
+
+		// Owner pops in LIFO order
+		EXPECT_EQ(queue.Pop(), &values[2]);
+		EXPECT_EQ(queue.Pop(), &values[1]);
+		EXPECT_EQ(queue.Pop(), &values[0]);
+		EXPECT_EQ(queue.Pop(), nullptr);
+		EXPECT_TRUE(queue.IsEmpty());
+	}
+
+	UNIT_TEST(WorkStealingQueue, Steal)
+	{
+		TWorkStealingQueue<int*, 4> queue;
+		EXPECT_EQ(queue.Steal(), nullptr);
+
+		int values[3] = {1, 2, 3};
+		EXPECT_TRUE(queue.Push(&values[0]));
+		EXPECT_TRUE(queue.Push(&values[1]));
+		EXPECT_TRUE(queue.Push(&values[2]));
+
+		// Thieves steal in FIFO order
+		EXPECT_EQ(queue.Steal(), &values[0]);
+		EXPECT_EQ(queue.Pop(), &values[2]);
+		EXPECT_EQ(queue.Steal(), &values[1]);
+		EXPECT_EQ(queue.Steal(), nullptr);
+		EXPECT_EQ(queue.Pop(), nullptr);
+	}
+
+	UNIT_TEST(WorkStealingQueue, StealIf)
+	{
+		TWorkStealingQueue<int*, 4> queue;
+
+		int values[2] = {1, 2};
+		EXPECT_TRUE(queue.Push(&values[0]));
+		EXPECT_TRUE(queue.Push(&values[1]));
+
+		// Rejected elements are left in place
+		EXPECT_EQ(
+			queue.StealIf(
+				[&values](int* pElement)
+				{
+					return pElement != &values[0];
+				},
+				4u
+			),
+			nullptr
+		);
+		EXPECT_EQ(queue.GetSize(), 2u);
+
+		EXPECT_EQ(
+			queue.StealIf(
+				[&values](int* pElement)
+				{
+					return pElement == &values[0];
+				},
+				4u
+			),
+			&values[0]
+		);
+		EXPECT_EQ(queue.Pop(), &values[1]);
+		EXPECT_TRUE(queue.IsEmpty());
+	}
+
+	UNIT_TEST(WorkStealingQueue, StealIfFallsBackAfterRejections)
+	{
+		TWorkStealingQueue<int*, 4> queue;
+
+		int values[2] = {1, 2};
+		EXPECT_TRUE(queue.Push(&values[0]));
+		EXPECT_TRUE(queue.Push(&values[1]));
+
+		constexpr uint32 maximumRejectionCount = 3;
+		auto rejectAll = [](int*)
+		{
+			return false;
+		};
+		for (uint32 attempt = 0; attempt < maximumRejectionCount; ++attempt)
+		{
+			EXPECT_EQ(queue.StealIf(rejectAll, maximumRejectionCount), nullptr);
+		}
+		EXPECT_EQ(queue.GetSize(), 2u);
+
+		// The top element no longer blocks the queue
+		EXPECT_EQ(queue.StealIf(rejectAll, maximumRejectionCount), &values[0]);
+
+		// A successful steal resets the rejection count for the next element
+		EXPECT_EQ(queue.StealIf(rejectAll, maximumRejectionCount), nullptr);
+		EXPECT_EQ(queue.GetSize(), 1u);
+	}
+
+	UNIT_TEST(WorkStealingQueue, Full)
+	{
+		TWorkStealingQueue<int*, 2> queue;
+
+		int values[3] = {1, 2, 3};
+		EXPECT_TRUE(queue.Push(&values[0]));
+		EXPECT_TRUE(queue.Push(&values[1]));
+		EXPECT_FALSE(queue.Push(&values[2]));
+		EXPECT_EQ(queue.GetSize(), 2u);
+
+		// Stealing frees up space, and indices wrap around the ring
+		EXPECT_EQ(queue.Steal(), &values[0]);
+		EXPECT_TRUE(queue.Push(&values[2]));
+		EXPECT_EQ(queue.Pop(), &values[2]);
+		EXPECT_EQ(queue.Pop(), &values[1]);
+		EXPECT_TRUE(queue.IsEmpty());
+	}
+}
@@ -0,0 +1,153 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include "../Threading/ScopedJobManager.h"
+
+#include <Common/IO/AsyncLoadFromDiskJob.h>
+#include <Common/IO/File.h>
+#include <Common/IO/Path.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Tests
+{
+	//! Writes a file whose bytes depend on their offset, so reads at the wrong offset are detected
+	[[nodiscard]] static IO::Path WriteTestFile(const IO::PathView fileName, const size fileSize)
+	{
+		const IO::Path filePath = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), fileName);
+		Vector<ByteType, size> contents(Memory::ConstructWithSize, Memory::Uninitialized, fileSize);
+		for (size offset = 0; offset < fileSize; ++offset)
+		{
+			contents[offset] = ByteType(offset * 7 + offset / 251);
+		}
+
+		IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+		EXPECT_TRUE(file.IsValid());
+		EXPECT_EQ(file.Write(contents.GetView()), fileSize);
+		return filePath;
+	}
+
+	[[nodiscard]] static bool IsExpectedContent(const ConstByteView data, const size fileOffset)
+	{
+		for (size index = 0; index < data.GetDataSize(); ++index)
+		{
+			const size offset = fileOffset + index;
+			if (data[index] != ByteType(offset * 7 + offset / 251))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	// Uses io_uring on Linux kernels that support it, and the platform's async API or blocking reads elsewhere
+	UNIT_TEST(AsyncLoadFromDiskJob, LoadIntoTarget)
+	{
+		ScopedJobManager jobManager;
+
+		constexpr size fileSize = 100000;
+		const IO::Path filePath = WriteTestFile(MAKE_PATH("AsyncLoadFromDiskJobTest.bin"), fileSize);
+
+		// Whole file
+		{
+			Vector<ByteType, size> target(Memory::ConstructWithSize, Memory::Zeroed, fileSize);
+			ConstByteView loadedData;
+			Threading::JobBatch jobBatch(*IO::CreateAsyncLoadFromDiskJob(
+				filePath,
+				Threading::JobPriority::UserInterfaceAction,
+				[&loadedData](const ConstByteView data)
+				{
+					loadedData = data;
+				},
+				target.GetView(),
+				Math::Range<size>::MakeStartToEnd(0ull, Math::NumericLimits<size>::Max - 1)
+			));
+			jobManager.QueueAndWait(jobBatch);
+			EXPECT_EQ(loadedData.GetDataSize(), fileSize);
+			EXPECT_EQ(loadedData.GetData(), target.GetData());
+			EXPECT_TRUE(IsExpectedContent(loadedData, 0));
+		}
+
+		// Range in the middle of the file
+		{
+			constexpr size rangeOffset = 12345;
+			constexpr size rangeSize = 4321;
+			Vector<ByteType, size> target(Memory::ConstructWithSize, Memory::Zeroed, rangeSize);
+			ConstByteView loadedData;
+			Threading::JobBatch jobBatch(*IO::CreateAsyncLoadFromDiskJob(
+				filePath,
+				Threading::JobPriority::UserInterfaceAction,
+				[&loadedData](const ConstByteView data)
+				{
+					loadedData = data;
+				},
+				target.GetView(),
+				Math::Range<size>::Make(rangeOffset, rangeSize)
+			));
+			jobManager.QueueAndWait(jobBatch);
+			EXPECT_EQ(loadedData.GetDataSize(), rangeSize);
+			EXPECT_TRUE(IsExpectedContent(loadedData, rangeOffset));
+		}
+
+		EXPECT_TRUE(filePath.RemoveFile());
+	}
+
+	UNIT_TEST(AsyncLoadFromDiskJob, ManyConcurrentLoads)
+	{
+		ScopedJobManager jobManager;
+
+		constexpr size fileSize = 256 * 1024;
+		const IO::Path filePath = WriteTestFile(MAKE_PATH("AsyncLoadFromDiskJobConcurrentTest.bin"), fileSize);
+
+		// More loads than the maximum number of concurrent requests, so reads are staged while others are in flight
+		constexpr uint32 loadCount = 512;
+		constexpr size chunkSize = fileSize / loadCount;
+		Vector<ByteType, size> target(Memory::ConstructWithSize, Memory::Zeroed, fileSize);
+		Threading::Atomic<uint32> validLoadCount{0};
+		Threading::JobBatch jobBatch;
+		for (uint32 loadIndex = 0; loadIndex < loadCount; ++loadIndex)
+		{
+			const size offset = chunkSize * loadIndex;
+			jobBatch.QueueAfterStartStage(*IO::CreateAsyncLoadFromDiskJob(
+				filePath,
+				Threading::JobPriority::UserInterfaceAction,
+				[&validLoadCount, offset](const ConstByteView data)
+				{
+					validLoadCount += data.GetDataSize() == chunkSize && IsExpectedContent(data, offset);
+				},
+				target.GetView().GetSubView(offset, chunkSize),
+				Math::Range<size>::Make(offset, chunkSize)
+			));
+		}
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_EQ(validLoadCount.Load(), loadCount);
+		EXPECT_TRUE(IsExpectedContent(target.GetView(), 0));
+
+		EXPECT_TRUE(filePath.RemoveFile());
+	}
+
+	UNIT_TEST(AsyncLoadFromDiskJob, MissingFile)
+	{
+		ScopedJobManager jobManager;
+
+		const IO::Path filePath = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), MAKE_PATH("AsyncLoadFromDiskJobMissing.bin"));
+		Vector<ByteType, size> target(Memory::ConstructWithSize, Memory::Zeroed, 16u);
+		bool calledBack = false;
+		ConstByteView loadedData = target.GetView();
+		Threading::JobBatch jobBatch(*IO::CreateAsyncLoadFromDiskJob(
+			filePath,
+			Threading::JobPriority::UserInterfaceAction,
+			[&calledBack, &loadedData](const ConstByteView data)
+			{
+				calledBack = true;
+				loadedData = data;
+			},
+			target.GetView(),
+			Math::Range<size>::MakeStartToEnd(0ull, Math::NumericLimits<size>::Max - 1)
+		));
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_TRUE(calledBack);
+		EXPECT_TRUE(loadedData.IsEmpty());
+	}
+}
@@ -0,0 +1,80 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/IO/CoalescedLoadScheduler.h>
+
+namespace ngine::Tests
+{
+	using PendingLoad = IO::CoalescedLoadScheduler::PendingLoad;
+	using MergedRead = IO::CoalescedLoadScheduler::MergedRead;
+
+	[[nodiscard]] PendingLoad
+	MakePendingLoad(const IO::PathView path, const size offset, const size count, const Threading::JobPriority priority)
+	{
+		return PendingLoad{IO::Path(path), [](ConstByteView) {}, {}, Math::Range<size>::Make(offset, count), priority};
+	}
+
+	UNIT_TEST(CoalescedLoadScheduler, MergeAdjacentAndOverlappingRanges)
+	{
+		Vector<PendingLoad, uint32> loads;
+		loads.EmplaceBack(MakePendingLoad(MAKE_PATH("a.pack"), 200, 100, Threading::JobPriority::LoadShader));
+		loads.EmplaceBack(MakePendingLoad(MAKE_PATH("a.pack"), 0, 100, Threading::JobPriority::LoadMeshData));
+		loads.EmplaceBack(MakePendingLoad(MAKE_PATH("a.pack"), 100, 150, Threading::JobPriority::LoadMeshData));
+		loads.EmplaceBack(MakePendingLoad(MAKE_PATH("b.pack"), 0, 100, Threading::JobPriority::LoadMeshData));
+
+		Vector<MergedRead, uint32> reads;
+		IO::CoalescedLoadScheduler::PlanReads(loads.GetView(), reads);
+
+		EXPECT_EQ(reads.GetSize(), 2u);
+		// The merged read takes the most urgent priority and is issued first
+		EXPECT_EQ(reads[0].m_priority, Threading::JobPriority::LoadShader);
+		EXPECT_EQ(reads[0].m_dataRange.GetMinimum(), 0u);
+		EXPECT_EQ(reads[0].m_dataRange.GetSize(), 300u);
+		EXPECT_EQ(reads[0].m_loadCount, 3u);
+		EXPECT_TRUE(loads[reads[0].m_firstLoadIndex].m_path == MAKE_PATH("a.pack"));
+		EXPECT_EQ(loads[reads[0].m_firstLoadIndex].m_dataRange.GetMinimum(), 0u);
+
+		EXPECT_EQ(reads[1].m_loadCount, 1u);
+		EXPECT_TRUE(loads[reads[1].m_firstLoadIndex].m_path == MAKE_PATH("b.pack"));
+	}
+
+	UNIT_TEST(CoalescedLoadScheduler, SplitDistantAndUnboundedRanges)
+	{
+		const size distantOffset = 100 + IO::CoalescedLoadScheduler::MaximumMergeGap + 1;
+
+		Vector<PendingLoad, uint32> loads;
+		loads.EmplaceBack(MakePendingLoad(MAKE_PATH("a.pack"), 0, 100, Threading::JobPriority::LoadMeshData));
+		loads.EmplaceBack(MakePendingLoad(MAKE_PATH("a.pack"), distantOffset, 100, Threading::JobPriority::LoadMeshData));
+		// Whole file loads can't be merged as their size is unknown
+		loads.EmplaceBack(PendingLoad{
+			IO::Path(MAKE_PATH("a.pack")),
+			[](ConstByteView) {},
+			{},
+			Math::Range<size>::MakeStartToEnd(0ull, Math::NumericLimits<size>::Max - 1),
+			Threading::JobPriority::LoadMeshData
+		});
+		loads.EmplaceBack(MakePendingLoad(
+			MAKE_PATH("a.pack"),
+			distantOffset + 200,
+			IO::CoalescedLoadScheduler::MaximumMergedReadSize,
+			Threading::JobPriority::LoadMeshData
+		));
+
+		Vector<MergedRead, uint32> reads;
+		IO::CoalescedLoadScheduler::PlanReads(loads.GetView(), reads);
+
+		// The oversized merge is split, and reads of equal priority stay in file order
+		EXPECT_EQ(reads.GetSize(), 4u);
+		EXPECT_EQ(reads[0].m_dataRange.GetMinimum(), 0u);
+		EXPECT_EQ(reads[0].m_dataRange.GetSize(), 100u);
+		EXPECT_EQ(reads[1].m_dataRange.GetSize(), Math::NumericLimits<size>::Max);
+		EXPECT_EQ(reads[2].m_dataRange.GetMinimum(), distantOffset);
+		EXPECT_EQ(reads[2].m_dataRange.GetSize(), 100u);
+		EXPECT_EQ(reads[3].m_dataRange.GetMinimum(), distantOffset + 200);
+		for (const MergedRead& read : reads)
+		{
+			EXPECT_EQ(read.m_loadCount, 1u);
+		}
+	}
+}
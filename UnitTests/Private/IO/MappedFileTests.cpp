@@ -0,0 +1,61 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/IO/MappedFile.h>
+#include <Common/IO/File.h>
+#include <Common/IO/Path.h>
+#include <Common/EnumFlags.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(MappedFile, MapContents)
+	{
+		const IO::Path filePath = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), MAKE_PATH("MappedFileTest.bin"));
+		constexpr ConstStringView contents = "Mapped file contents";
+		{
+			IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+			EXPECT_TRUE(file.IsValid());
+			EXPECT_EQ(file.Write(contents), contents.GetSize());
+		}
+
+		{
+			IO::MappedFile mappedFile(filePath, IO::MappedFile::AccessPattern::Sequential);
+			EXPECT_TRUE(mappedFile.IsValid());
+			EXPECT_EQ(mappedFile.GetSize(), (size)contents.GetSize());
+			const ConstByteView view = mappedFile.GetView();
+			EXPECT_EQ(ConstStringView(reinterpret_cast<const char*>(view.GetData()), (uint32)view.GetDataSize()), contents);
+
+			mappedFile.Advise(IO::MappedFile::AccessPattern::Random);
+			mappedFile.Prefetch(view);
+
+			IO::MappedFile movedFile = Move(mappedFile);
+			EXPECT_FALSE(mappedFile.IsValid());
+			EXPECT_TRUE(movedFile.IsValid());
+			EXPECT_EQ(movedFile.GetSize(), (size)contents.GetSize());
+		}
+
+		EXPECT_TRUE(filePath.RemoveFile());
+	}
+
+	UNIT_TEST(MappedFile, EmptyAndMissingFiles)
+	{
+		const IO::Path filePath = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), MAKE_PATH("MappedFileEmptyTest.bin"));
+		{
+			IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+			EXPECT_TRUE(file.IsValid());
+		}
+
+		{
+			const IO::MappedFile mappedFile(filePath);
+			EXPECT_TRUE(mappedFile.IsValid());
+			EXPECT_EQ(mappedFile.GetSize(), 0u);
+			EXPECT_TRUE(mappedFile.GetView().IsEmpty());
+		}
+
+		EXPECT_TRUE(filePath.RemoveFile());
+
+		const IO::MappedFile missingFile(filePath);
+		EXPECT_FALSE(missingFile.IsValid());
+	}
+}
@@ -1,5 +1,9 @@
 #include <Common/Memory/New.h>
 #include <Common/Memory/Allocators/Allocate.h>
+#include <Common/Memory/Allocators/MemoryUsage.h>
+#include <Common/Memory/Allocators/AllocationSampling.h>
+#include <Common/Memory/Containers/String.h>
+#include <Common/Threading/Thread.h>
 
 #include <Common/Tests/UnitTest.h>
 
@@ -98,4 +102,152 @@ namespace ngine::Tests
 			}
 		}
 	}
+
+	UNIT_TEST(Memory, SizeClasses)
+	{
+		EXPECT_EQ(Memory::GetSizeClass(0), 0);
+		EXPECT_EQ(Memory::GetSizeClass(1), 1);
+		EXPECT_EQ(Memory::GetSizeClass(48), 6);
+		EXPECT_EQ(Memory::GetSizeClass(64), 7);
+		EXPECT_EQ(Memory::GetSizeClass(Math::NumericLimits<size>::Max), Memory::SizeClassCount - 1);
+	}
+
+	UNIT_TEST(Memory, UsageStatistics)
+	{
+		const Memory::UsageTag previousTag = Memory::GetCurrentUsageTag();
+		constexpr Memory::UsageTag TestTag = Memory::MaximumUsageTagCount - 1;
+		const Memory::UsageStatistics initialStatistics = Memory::GetUsageStatistics();
+
+		Memory::SetCurrentUsageTag(TestTag);
+		void* pMemory = Memory::Allocate(48);
+		Memory::SetCurrentUsageTag(previousTag);
+		const size allocatedSize = Memory::GetAllocatedMemorySize(pMemory);
+		const uint8 sizeClass = Memory::GetSizeClass(allocatedSize);
+
+		if constexpr (PROFILE_BUILD)
+		{
+			const Memory::UsageStatistics statistics = Memory::GetUsageStatistics();
+			EXPECT_EQ(statistics.m_currentUsage, initialStatistics.m_currentUsage + allocatedSize);
+			EXPECT_GE(statistics.m_peakUsage, statistics.m_currentUsage);
+			EXPECT_EQ(
+				statistics.m_sizeClasses[sizeClass].m_allocationCount,
+				initialStatistics.m_sizeClasses[sizeClass].m_allocationCount + 1
+			);
+			EXPECT_EQ(statistics.m_tags[TestTag].m_allocatedSize, initialStatistics.m_tags[TestTag].m_allocatedSize + allocatedSize);
+			EXPECT_EQ(statistics.m_tags[TestTag].m_allocationCount, initialStatistics.m_tags[TestTag].m_allocationCount + 1);
+		}
+
+		Memory::Deallocate(pMemory);
+		if constexpr (PROFILE_BUILD)
+		{
+			const Memory::UsageStatistics statistics = Memory::GetUsageStatistics();
+			EXPECT_EQ(statistics.m_currentUsage, initialStatistics.m_currentUsage);
+			EXPECT_EQ(
+				statistics.m_sizeClasses[sizeClass].m_deallocationCount,
+				initialStatistics.m_sizeClasses[sizeClass].m_deallocationCount + 1
+			);
+		}
+	}
+
+	UNIT_TEST(Memory, UsageStatisticsAcrossThreads)
+	{
+		constexpr Memory::UsageTag TestTag = Memory::MaximumUsageTagCount - 2;
+		constexpr uint32 allocationsPerThread = 100;
+		const Memory::UsageStatistics initialStatistics = Memory::GetUsageStatistics();
+
+		auto allocate = []()
+		{
+			Memory::SetCurrentUsageTag(TestTag);
+			for (uint32 i = 0; i < allocationsPerThread; ++i)
+			{
+				void* pMemory = Memory::Allocate(32);
+				Memory::Deallocate(pMemory);
+			}
+			Memory::SetCurrentUsageTag(Memory::UntaggedUsage);
+		};
+
+		// More threads than there are exclusive shards, so the later threads concurrently update the shared shard
+		constexpr uint32 batchCount = 20;
+		constexpr uint32 threadsPerBatch = 4;
+		for (uint32 batchIndex = 0; batchIndex < batchCount; ++batchIndex)
+		{
+			Threading::Thread firstThread(allocate);
+			Threading::Thread secondThread(allocate);
+			Threading::Thread thirdThread(allocate);
+			Threading::Thread fourthThread(allocate);
+		}
+
+		if constexpr (PROFILE_BUILD)
+		{
+			const Memory::UsageStatistics statistics = Memory::GetUsageStatistics();
+			EXPECT_EQ(
+				statistics.m_tags[TestTag].m_allocationCount,
+				initialStatistics.m_tags[TestTag].m_allocationCount + batchCount * threadsPerBatch * allocationsPerThread
+			);
+			EXPECT_GE(
+				statistics.m_deallocationCount,
+				initialStatistics.m_deallocationCount + batchCount * threadsPerBatch * allocationsPerThread
+			);
+		}
+	}
+
+	UNIT_TEST(Memory, UsageTagScope)
+	{
+		const Memory::UsageTag outerTag = Memory::RegisterUsageTag("UsageTagScopeOuter");
+		const Memory::UsageTag innerTag = Memory::RegisterUsageTag("UsageTagScopeInner");
+		EXPECT_NE(outerTag, innerTag);
+		EXPECT_EQ(Memory::RegisterUsageTag("UsageTagScopeOuter"), outerTag);
+		EXPECT_TRUE(Memory::GetUsageTagName(innerTag) == "UsageTagScopeInner");
+
+		const Memory::UsageTag previousTag = Memory::GetCurrentUsageTag();
+		{
+			Memory::UsageTagScope outerScope(outerTag);
+			EXPECT_EQ(Memory::GetCurrentUsageTag(), outerTag);
+			{
+				Memory::UsageTagScope innerScope(innerTag);
+				EXPECT_EQ(Memory::GetCurrentUsageTag(), innerTag);
+			}
+			EXPECT_EQ(Memory::GetCurrentUsageTag(), outerTag);
+		}
+		EXPECT_EQ(Memory::GetCurrentUsageTag(), previousTag);
+	}
+
+	UNIT_TEST(Memory, AllocationSampling)
+	{
+		if constexpr (PLATFORM_EMSCRIPTEN)
+		{
+			return;
+		}
+
+		const Memory::UsageTag tag = Memory::RegisterUsageTag("AllocationSamplingTest");
+		Memory::StartAllocationSampling(64);
+		EXPECT_TRUE(Memory::IsSamplingAllocations());
+
+		Array<void*, 8> allocations;
+		{
+			Memory::UsageTagScope tagScope(tag);
+			for (void*& pAllocation : allocations)
+			{
+				pAllocation = Memory::Allocate(1024);
+			}
+		}
+		Memory::StopAllocationSampling();
+		EXPECT_FALSE(Memory::IsSamplingAllocations());
+
+		// Allocations larger than the interval are always sampled once the thread started counting
+		{
+			const String report = Memory::GetAllocationSampleReport();
+			EXPECT_TRUE(report.GetView().Contains(ConstStringView("\tAllocationSamplingTest\t")));
+		}
+
+		// Freed allocations no longer show up
+		for (void* pAllocation : allocations)
+		{
+			Memory::Deallocate(pAllocation);
+		}
+		{
+			const String report = Memory::GetAllocationSampleReport();
+			EXPECT_FALSE(report.GetView().Contains(ConstStringView("\tAllocationSamplingTest\t")));
+		}
+	}
 }
@@ -0,0 +1,117 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Reflection/Registry.h>
+#include <Common/Reflection/FunctionInfo.h>
+#include <Common/Reflection/EventInfo.h>
+
+namespace ngine::Tests
+{
+	[[nodiscard]] Scripting::VM::ReturnValue RegistryTestFunction(
+		Scripting::VM::Register,
+		Scripting::VM::Register,
+		Scripting::VM::Register,
+		Scripting::VM::Register,
+		Scripting::VM::Register,
+		Scripting::VM::Register
+	)
+	{
+		return {};
+	}
+
+	[[nodiscard]] ArrayView<const Reflection::Argument, uint8> GetNoFunctionArguments(const Reflection::FunctionInfo&)
+	{
+		return {};
+	}
+
+	[[nodiscard]] ArrayView<const Reflection::Argument, uint8> GetNoEventArguments(const Reflection::EventInfo&)
+	{
+		return {};
+	}
+
+	UNIT_TEST(Reflection, RegistryFunctionLookup)
+	{
+		static constexpr Guid owningTypeGuid = "{4C8E2B35-7A0B-4C63-9E7B-2E6D47A1B1A3}"_guid;
+		static const Reflection::FunctionInfo functionInfo{
+			"{0B6F2D1E-6C52-4E7A-A0D9-6C1B1F3E5A21}"_guid,
+			MAKE_UNICODE_LITERAL("Test Function"),
+			Reflection::FunctionFlags::IsMemberFunction,
+			Reflection::Argument{},
+			GetNoFunctionArguments
+		};
+		static const Reflection::EventInfo eventInfo{
+			"{9D3A7C44-1F2B-4B8E-8C5D-3A9E6F7B2C10}"_guid,
+			MAKE_UNICODE_LITERAL("Test Event"),
+			GetNoEventArguments
+		};
+
+		Reflection::Registry registry;
+		const Reflection::FunctionIdentifier functionIdentifier =
+			registry.RegisterDynamicFunction(functionInfo, Scripting::VM::DynamicFunction(RegistryTestFunction), owningTypeGuid);
+		const Reflection::FunctionIdentifier eventIdentifier =
+			registry.RegisterDynamicEvent(eventInfo, Scripting::VM::DynamicFunction(RegistryTestFunction), owningTypeGuid);
+
+		EXPECT_TRUE(registry.FindFunctionIdentifier(functionInfo.m_guid) == functionIdentifier);
+		EXPECT_TRUE(registry.FindEventIdentifier(eventInfo.m_guid) == eventIdentifier);
+		EXPECT_TRUE(registry.FindFunction(functionIdentifier).IsValid());
+		EXPECT_TRUE(registry.FindFunction(functionIdentifier).m_owningTypeGuid == owningTypeGuid);
+		EXPECT_TRUE(registry.FindEvent(eventIdentifier).m_flags.IsSet(Reflection::FunctionFlags::IsEvent));
+
+		EXPECT_EQ(registry.FindTypeFunctionDefinition(functionInfo.m_guid).Get(), &functionInfo);
+		EXPECT_EQ(registry.FindFunctionDefinition(functionInfo.m_guid).Get(), &functionInfo);
+		EXPECT_FALSE(registry.FindTypeEventDefinition(functionInfo.m_guid).IsValid());
+		EXPECT_EQ(registry.FindTypeEventDefinition(eventInfo.m_guid).Get(), &eventInfo);
+		EXPECT_EQ(registry.FindEventDefinition(eventInfo.m_guid).Get(), &eventInfo);
+
+		registry.DeregisterDynamicFunction(functionInfo.m_guid);
+		EXPECT_FALSE(registry.FindFunction(functionInfo.m_guid).IsValid());
+		EXPECT_FALSE(registry.FindFunction(functionIdentifier).IsValid());
+		EXPECT_FALSE(registry.FindTypeFunctionDefinition(functionInfo.m_guid).IsValid());
+		EXPECT_FALSE(registry.FindFunctionIdentifier(functionInfo.m_guid).IsValid());
+
+		registry.DeregisterDynamicEvent(eventInfo.m_guid);
+		EXPECT_FALSE(registry.FindEventDefinition(eventInfo.m_guid).IsValid());
+	}
+
+	UNIT_TEST(Reflection, RegistrySnapshotLookups)
+	{
+		static const Reflection::FunctionInfo functionInfo{
+			"{6E1D8A53-2C47-4F0B-B3A8-91C5E2D7F064}"_guid,
+			MAKE_UNICODE_LITERAL("Test Global Function"),
+			EnumFlags<Reflection::FunctionFlags>{},
+			Reflection::Argument{},
+			GetNoFunctionArguments
+		};
+		static const Reflection::FunctionInfo laterFunctionInfo{
+			"{A4F7C2E9-5B3D-4E81-9A06-D2B8E13F7C45}"_guid,
+			MAKE_UNICODE_LITERAL("Test Later Global Function"),
+			EnumFlags<Reflection::FunctionFlags>{},
+			Reflection::Argument{},
+			GetNoFunctionArguments
+		};
+
+		Reflection::Registry registry;
+		const Reflection::FunctionIdentifier functionIdentifier =
+			registry.RegisterDynamicGlobalFunction(functionInfo, Scripting::VM::DynamicFunction(RegistryTestFunction));
+
+		EXPECT_FALSE(registry.IsUsingSnapshotLookups());
+		registry.EnableSnapshotLookups();
+		EXPECT_TRUE(registry.IsUsingSnapshotLookups());
+		EXPECT_TRUE(registry.FindFunctionIdentifier(functionInfo.m_guid) == functionIdentifier);
+		EXPECT_EQ(registry.FindFunctionDefinition(functionInfo.m_guid).Get(), &functionInfo);
+
+		// Changes after enabling are published to readers
+		const Reflection::FunctionIdentifier laterFunctionIdentifier =
+			registry.RegisterDynamicGlobalFunction(laterFunctionInfo, Scripting::VM::DynamicFunction(RegistryTestFunction));
+		EXPECT_TRUE(registry.FindFunctionIdentifier(laterFunctionInfo.m_guid) == laterFunctionIdentifier);
+		EXPECT_TRUE(registry.FindFunction(laterFunctionInfo.m_guid).IsValid());
+
+		registry.DeregisterDynamicGlobalFunction(functionInfo.m_guid);
+		EXPECT_FALSE(registry.FindFunctionIdentifier(functionInfo.m_guid).IsValid());
+		EXPECT_FALSE(registry.FindFunction(functionInfo.m_guid).IsValid());
+		EXPECT_TRUE(registry.FindFunctionIdentifier(laterFunctionInfo.m_guid) == laterFunctionIdentifier);
+
+		registry.DeregisterDynamicGlobalFunction(laterFunctionInfo.m_guid);
+	}
+}
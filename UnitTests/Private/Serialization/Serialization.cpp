@@ -12,6 +12,11 @@
 #include <Common/Math/Vector3.h>
 #include <Common/Math/Angle.h>
 #include <Common/Memory/Containers/Serialization/UnorderedMap.h>
+#include <Common/Serialization/BinaryData.h>
+#include <Common/Serialization/StreamingReader.h>
+#include <Common/Serialization/DocumentArena.h>
+#include <Common/IO/File.h>
+#include <Common/IO/Path.h>
 
 namespace ngine::Tests
 {
@@ -648,4 +653,237 @@ namespace ngine::Tests
 			}
 		}
 	}
+
+	UNIT_TEST(Serialization, WriteBinaryVector)
+	{
+		Optional<String> binaryContents;
+
+		{
+			VectorStructure data;
+			data.m_array = Vector<int>{1, -2, 3};
+			binaryContents = Serialization::SerializeToBuffer(data, Serialization::SavingFlags::Binary);
+			EXPECT_TRUE(binaryContents.IsValid());
+		}
+
+		if (binaryContents.IsValid())
+		{
+			const ConstStringView contents(binaryContents->GetData(), binaryContents->GetSize());
+			EXPECT_TRUE(Serialization::IsBinaryData(ConstByteView(contents.GetData(), contents.GetSize())));
+
+			VectorStructure newData;
+			const bool readSuccess = Serialization::DeserializeFromBuffer(contents, newData);
+			EXPECT_TRUE(readSuccess);
+			EXPECT_EQ(newData.m_array.GetSize(), 3u);
+			if (newData.m_array.GetSize() == 3)
+			{
+				EXPECT_EQ(newData.m_array[0], 1);
+				EXPECT_EQ(newData.m_array[1], -2);
+				EXPECT_EQ(newData.m_array[2], 3);
+			}
+		}
+	}
+
+	UNIT_TEST(Serialization, ConvertBetweenJsonAndBinary)
+	{
+		constexpr ConstStringView jsonContents = R"(
+{
+	"name": "test",
+	"values": [{ "x": 1.5, "y": -7 }, { "x": 18446744073709551615, "y": null }],
+	"enabled": true,
+	"nested": { "name": "", "enabled": false, "values": [] }
+})";
+
+		const Vector<ByteType, size> binaryData = Serialization::ConvertJsonToBinaryData(jsonContents);
+		EXPECT_TRUE(binaryData.HasElements());
+		EXPECT_LT(binaryData.GetSize(), jsonContents.GetSize());
+
+		const String convertedJson = Serialization::ConvertBinaryDataToJson(binaryData.GetView());
+		EXPECT_TRUE(convertedJson.HasElements());
+
+		const Serialization::Data originalData(jsonContents);
+		const Serialization::Data convertedData(convertedJson.GetView());
+		EXPECT_TRUE(convertedData.IsValid());
+		EXPECT_TRUE(originalData.GetDocument() == convertedData.GetDocument());
+
+		// Truncated data must be rejected instead of read out of bounds
+		const Serialization::Data truncatedData(
+			ConstStringView{reinterpret_cast<const char*>(binaryData.GetData()), uint32(binaryData.GetSize() - 1)}
+		);
+		EXPECT_FALSE(truncatedData.IsValid());
+	}
+
+	UNIT_TEST(Serialization, ParseFileInSitu)
+	{
+		const IO::Path filePath = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), MAKE_PATH("SerializationInSituTest.json"));
+		constexpr ConstStringView jsonContents = R"({ "test": 1337, "name": "in\nsitu" })";
+		{
+			IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+			EXPECT_TRUE(file.IsValid());
+			EXPECT_EQ(file.Write(jsonContents), jsonContents.GetSize());
+		}
+
+		{
+			Serialization::Data inSituData(filePath, Serialization::ParseInSitu);
+			EXPECT_TRUE(inSituData.IsValid());
+
+			// Moving keeps the buffer the strings point into alive
+			const Serialization::Data movedData = Move(inSituData);
+			const Serialization::Reader reader(movedData);
+			EXPECT_EQ(reader.ReadWithDefaultValue<int>("test", 0), 1337);
+			const Serialization::Value& name = movedData.GetDocument()["name"];
+			EXPECT_EQ(ConstStringView(name.GetString(), name.GetStringLength()), "in\nsitu");
+
+			const Serialization::Data copiedData(movedData);
+			EXPECT_TRUE(copiedData.GetDocument() == Serialization::Data(jsonContents).GetDocument());
+		}
+
+		EXPECT_TRUE(filePath.RemoveFile());
+	}
+
+	UNIT_TEST(Serialization, StreamObjectMembers)
+	{
+		constexpr ConstStringView jsonContents = R"(
+{
+	"first": { "test": 1, "values": [1, 2, [3]] },
+	"second": { "test": 2, "nested": { "test": 3 } },
+	"third": 3
+})";
+		const ConstByteView data{reinterpret_cast<const ByteType*>(jsonContents.GetData()), jsonContents.GetSize()};
+
+		uint32 memberCount = 0;
+		const bool wasStreamed = Serialization::StreamObjectMembers(
+			data,
+			[&memberCount](const ConstStringView name, const Serialization::Reader reader)
+			{
+				switch (memberCount++)
+				{
+					case 0:
+						EXPECT_EQ(name, "first");
+						EXPECT_EQ(reader.ReadWithDefaultValue<int>("test", 0), 1);
+						EXPECT_EQ(reader.GetValue().GetValue()["values"].Size(), 3u);
+						break;
+					case 1:
+						EXPECT_EQ(name, "second");
+						EXPECT_EQ(reader.ReadWithDefaultValue<int>("test", 0), 2);
+						EXPECT_EQ(reader.GetValue().GetValue()["nested"]["test"].GetInt(), 3);
+						break;
+					case 2:
+						EXPECT_EQ(name, "third");
+						EXPECT_EQ(reader.GetValue().GetValue().GetInt(), 3);
+						break;
+				}
+				return true;
+			}
+		);
+		EXPECT_TRUE(wasStreamed);
+		EXPECT_EQ(memberCount, 3u);
+
+		// Binary data streams the same members
+		const Vector<ByteType, size> binaryData = Serialization::ConvertJsonToBinaryData(jsonContents);
+		uint32 binaryMemberCount = 0;
+		EXPECT_TRUE(Serialization::StreamObjectMembers(
+			binaryData.GetView(),
+			[&binaryMemberCount](const ConstStringView, const Serialization::Reader)
+			{
+				return ++binaryMemberCount < 2;
+			}
+		));
+		EXPECT_EQ(binaryMemberCount, 2u);
+
+		// The top-level value must be an object
+		EXPECT_FALSE(Serialization::StreamObjectMembers(
+			ConstByteView{reinterpret_cast<const ByteType*>("[1]"), 3},
+			[](const ConstStringView, const Serialization::Reader)
+			{
+				return true;
+			}
+		));
+	}
+
+	UNIT_TEST(Serialization, StreamArrayElements)
+	{
+		constexpr ConstStringView jsonContents = R"([{ "test": 1 }, { "test": 2 }, { "test": 3 }])";
+		const ConstByteView data{reinterpret_cast<const ByteType*>(jsonContents.GetData()), jsonContents.GetSize()};
+
+		Vector<int> values;
+		EXPECT_TRUE(Serialization::StreamArrayElements(
+			data,
+			[&values](const Serialization::Reader reader)
+			{
+				SimpleReadWrite element;
+				EXPECT_TRUE(reader.SerializeInPlace(element));
+				values.EmplaceBack(element.m_test);
+				return values.GetSize() < 2;
+			}
+		));
+		EXPECT_EQ(values.GetSize(), 2u);
+		if (values.GetSize() == 2)
+		{
+			EXPECT_EQ(values[0], 1);
+			EXPECT_EQ(values[1], 2);
+		}
+
+		// Invalid JSON must be reported
+		constexpr ConstStringView invalidJsonContents = R"([{ "test": 1 }, { "test": )";
+		EXPECT_FALSE(Serialization::StreamArrayElements(
+			ConstByteView{reinterpret_cast<const ByteType*>(invalidJsonContents.GetData()), invalidJsonContents.GetSize()},
+			[](const Serialization::Reader)
+			{
+				return true;
+			}
+		));
+	}
+
+	UNIT_TEST(Serialization, ReadOnlyArenaDocument)
+	{
+		constexpr ConstStringView jsonContents = R"({ "test": 1337, "name": "a string too long to be stored inline", "values": [1, 2, 3] })";
+
+		Serialization::Data readOnlyData(jsonContents, Serialization::ReadOnly);
+		EXPECT_TRUE(readOnlyData.IsValid());
+		EXPECT_TRUE(readOnlyData.IsReadOnly());
+
+		SimpleReadWrite data;
+		EXPECT_TRUE(Serialization::Deserialize(readOnlyData, data));
+		EXPECT_EQ(data.m_test, 1337);
+
+		// Copies are allocated by their own document and can be modified
+		Serialization::Data copiedData(readOnlyData);
+		EXPECT_FALSE(copiedData.IsReadOnly());
+		EXPECT_TRUE(copiedData.GetDocument() == static_cast<const Serialization::Data&>(readOnlyData).GetDocument());
+
+		Serialization::Data movedData = Move(readOnlyData);
+		EXPECT_TRUE(movedData.IsReadOnly());
+		EXPECT_TRUE(static_cast<const Serialization::Data&>(movedData).GetDocument() == copiedData.GetDocument());
+		movedData = Move(copiedData);
+		EXPECT_FALSE(movedData.IsReadOnly());
+
+		// Failed parsing must not free values allocated from the arena
+		const Serialization::Data invalidData(ConstStringView(R"({ "test": [1, "two", )"), Serialization::ReadOnly);
+		EXPECT_FALSE(invalidData.IsValid());
+
+		const Vector<ByteType, size> binaryData = Serialization::ConvertJsonToBinaryData(jsonContents);
+		const Serialization::Data binaryReadOnlyData(
+			ConstStringView{reinterpret_cast<const char*>(binaryData.GetData()), uint32(binaryData.GetSize())},
+			Serialization::ReadOnly
+		);
+		EXPECT_TRUE(binaryReadOnlyData.IsValid());
+		const Serialization::Data truncatedBinaryData(
+			ConstStringView{reinterpret_cast<const char*>(binaryData.GetData()), uint32(binaryData.GetSize() - 1)},
+			Serialization::ReadOnly
+		);
+		EXPECT_FALSE(truncatedBinaryData.IsValid());
+	}
+
+	UNIT_TEST(Serialization, ReuseDocumentArena)
+	{
+		UniquePtr<Serialization::DocumentArena> pArena = Serialization::DocumentArena::Acquire();
+		const Serialization::DocumentArena* pArenaAddress = pArena.Get();
+		Serialization::DocumentArena::Release(Move(pArena));
+		EXPECT_FALSE(pArena.IsValid());
+
+		// The released arena is cached for the next document on this thread
+		pArena = Serialization::DocumentArena::Acquire();
+		EXPECT_EQ(pArena.Get(), pArenaAddress);
+		Serialization::DocumentArena::Release(Move(pArena));
+	}
 }
@@ -0,0 +1,153 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include "ScopedJobManager.h"
+
+#include <Common/Threading/Jobs/Job.h>
+#include <Common/Threading/Jobs/JobRunnerMask.h>
+#include <Common/Threading/AtomicInteger.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(JobRunnerMask, OperationsAboveFirstBlock)
+	{
+		Threading::JobRunnerMask mask;
+		mask.Set(3);
+		mask.Set(64);
+		mask.Set(130);
+		mask.Set(254);
+		EXPECT_EQ(mask.GetNumberOfSetBits(), 4u);
+		EXPECT_TRUE(mask.IsSet(64));
+		EXPECT_TRUE(mask.IsSet(130));
+		EXPECT_TRUE(mask.IsSet(254));
+		EXPECT_FALSE(mask.IsSet(63));
+		EXPECT_FALSE(mask.IsSet(65));
+
+		const uint16 expectedIndices[] = {3, 64, 130, 254};
+		uint8 visitedCount = 0;
+		for (const uint16 runnerIndex : mask.GetSetBitsIterator())
+		{
+			EXPECT_EQ(runnerIndex, expectedIndices[visitedCount]);
+			visitedCount++;
+		}
+		EXPECT_EQ(visitedCount, 4u);
+
+		mask.Clear(3);
+		EXPECT_EQ((uint16)*mask.GetFirstSetIndex(), 64u);
+
+		Threading::JobRunnerMask otherMask;
+		otherMask.Set(130);
+		otherMask.Set(200);
+		EXPECT_TRUE(mask.AreAnySet(otherMask));
+		const Threading::JobRunnerMask intersection = mask & otherMask;
+		EXPECT_EQ(intersection.GetNumberOfSetBits(), 1u);
+		EXPECT_TRUE(intersection.IsSet(130));
+
+		mask |= otherMask;
+		EXPECT_TRUE(mask.IsSet(200));
+		mask.Clear(otherMask);
+		EXPECT_FALSE(mask.IsSet(130));
+		EXPECT_FALSE(mask.IsSet(200));
+		EXPECT_TRUE(mask.IsSet(64));
+		EXPECT_TRUE(mask.IsSet(254));
+	}
+
+	UNIT_TEST(JobRunnerMask, AtomicOperationsAboveFirstBlock)
+	{
+		Threading::AtomicJobRunnerMask mask;
+		EXPECT_TRUE(mask.Set(70));
+		EXPECT_FALSE(mask.Set(70));
+		EXPECT_TRUE(mask.Set(190));
+		EXPECT_TRUE(mask.IsSet(70));
+		EXPECT_EQ(mask.GetNumberOfSetBits(), 2u);
+
+		const uint8 blockIndex = 70 / Threading::JobRunnerMaskBitsPerBlock;
+		Threading::JobRunnerMaskBlock block = mask.LoadBlock(blockIndex);
+		EXPECT_EQ(block, Threading::JobRunnerMaskBlock(1ull << (70 % Threading::JobRunnerMaskBitsPerBlock)));
+		EXPECT_TRUE(mask.CompareExchangeBlock(blockIndex, block, 0));
+		EXPECT_FALSE(mask.IsSet(70));
+		EXPECT_TRUE(mask.IsSet(190));
+
+		EXPECT_TRUE(mask.Clear(190));
+		EXPECT_FALSE(mask.Clear(190));
+		EXPECT_EQ(mask.GetNumberOfSetBits(), 0u);
+	}
+
+	//! Records the index of the runner it executed on
+	struct RunnerIndexJob final : public Threading::Job
+	{
+		RunnerIndexJob(const Threading::JobRunnerMask& allowedJobRunnerMask, Threading::Atomic<uint16>& executedRunnerIndex)
+			: Job(Priority::UserInterfaceAction, allowedJobRunnerMask)
+			, m_executedRunnerIndex(executedRunnerIndex)
+		{
+		}
+
+		virtual Result OnExecute(Threading::JobRunnerThread& thread) override
+		{
+			m_executedRunnerIndex = thread.GetThreadIndex();
+			return Result::FinishedAndDelete;
+		}
+	protected:
+		Threading::Atomic<uint16>& m_executedRunnerIndex;
+	};
+
+	UNIT_TEST(JobRunnerMask, JobRunnerAffinity)
+	{
+		Threading::Atomic<uint16> executedRunnerIndex{0};
+
+		RunnerIndexJob anyRunnerJob(Threading::JobRunnerMask{Memory::SetAll}, executedRunnerIndex);
+		EXPECT_TRUE(anyRunnerJob.CanRunOnAnyRunner());
+		EXPECT_TRUE(anyRunnerJob.CanRunOnRunner(200));
+		EXPECT_TRUE(anyRunnerJob.GetAllowedJobRunnerMask().AreAllSet());
+
+		Threading::JobRunnerMask exclusiveMask;
+		exclusiveMask.Set(130);
+		RunnerIndexJob exclusiveJob(exclusiveMask, executedRunnerIndex);
+		EXPECT_FALSE(exclusiveJob.CanRunOnAnyRunner());
+		EXPECT_TRUE(exclusiveJob.IsExclusiveToRunner(130));
+		EXPECT_TRUE(exclusiveJob.CanRunOnRunner(130));
+		EXPECT_FALSE(exclusiveJob.CanRunOnRunner(2));
+		EXPECT_TRUE(exclusiveJob.GetAllowedJobRunnerMask() == exclusiveMask);
+
+		Threading::JobRunnerMask customMask;
+		customMask.Set(1);
+		customMask.Set(66);
+		customMask.Set(250);
+		RunnerIndexJob customJob(customMask, executedRunnerIndex);
+		EXPECT_FALSE(customJob.CanRunOnAnyRunner());
+		EXPECT_FALSE(customJob.IsExclusiveToRunner(66));
+		EXPECT_TRUE(customJob.CanRunOnRunner(66));
+		EXPECT_TRUE(customJob.CanRunOnRunner(250));
+		EXPECT_FALSE(customJob.CanRunOnRunner(65));
+		EXPECT_TRUE(customJob.GetAllowedJobRunnerMask() == customMask);
+	}
+
+	UNIT_TEST(JobRunnerMask, RouteToRunnersAboveFirstBlock)
+	{
+		constexpr uint16 runnerCount = 72;
+		ScopedJobManager jobManager(runnerCount);
+		EXPECT_EQ(jobManager.GetJobManager().GetJobThreads().GetSize(), runnerCount);
+
+		// Exclusive to a single runner in the second mask block
+		{
+			Threading::Atomic<uint16> executedRunnerIndex{0};
+			Threading::JobRunnerMask mask;
+			mask.Set(70);
+			Threading::JobBatch jobBatch(*new RunnerIndexJob(mask, executedRunnerIndex));
+			jobManager.QueueAndWait(jobBatch);
+			EXPECT_EQ(executedRunnerIndex.Load(), 70u);
+		}
+
+		// Custom mask only containing runners in the second mask block
+		{
+			Threading::Atomic<uint16> executedRunnerIndex{0};
+			Threading::JobRunnerMask mask;
+			mask.Set(64);
+			mask.Set(71);
+			Threading::JobBatch jobBatch(*new RunnerIndexJob(mask, executedRunnerIndex));
+			jobManager.QueueAndWait(jobBatch);
+			EXPECT_TRUE(executedRunnerIndex.Load() == 64u || executedRunnerIndex.Load() == 71u);
+		}
+	}
+}
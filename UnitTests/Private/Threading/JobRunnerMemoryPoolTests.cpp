@@ -0,0 +1,154 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Memory/Containers/Array.h>
+
+#include <Common/Threading/Jobs/JobRunnerMemoryPool.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(JobRunnerMemoryPool, ReuseLocalBlocks)
+	{
+		Threading::JobRunnerMemoryPool pool;
+
+		void* pFirst = Threading::JobRunnerMemoryPool::Allocate(&pool, 100);
+		EXPECT_NE(pFirst, nullptr);
+		Threading::JobRunnerMemoryPool::Deallocate(&pool, pFirst, 100);
+
+		// Same size class is served from the free list
+		void* pSecond = Threading::JobRunnerMemoryPool::Allocate(&pool, 90);
+		EXPECT_EQ(pSecond, pFirst);
+
+		// Different size class gets a new block
+		void* pThird = Threading::JobRunnerMemoryPool::Allocate(&pool, 1000);
+		EXPECT_NE(pThird, pSecond);
+
+		Threading::JobRunnerMemoryPool::Deallocate(&pool, pSecond, 90);
+		Threading::JobRunnerMemoryPool::Deallocate(&pool, pThird, 1000);
+	}
+
+	UNIT_TEST(JobRunnerMemoryPool, ReclaimRemoteBlocks)
+	{
+		Threading::JobRunnerMemoryPool ownerPool;
+		Threading::JobRunnerMemoryPool otherPool;
+
+		void* pFirst = Threading::JobRunnerMemoryPool::Allocate(&ownerPool, 200);
+		void* pSecond = Threading::JobRunnerMemoryPool::Allocate(&ownerPool, 200);
+		EXPECT_NE(pFirst, pSecond);
+
+		// Freed from another runner and from a thread without a runner
+		Threading::JobRunnerMemoryPool::Deallocate(&otherPool, pFirst, 200);
+		Threading::JobRunnerMemoryPool::Deallocate(nullptr, pSecond, 200);
+
+		void* pThird = Threading::JobRunnerMemoryPool::Allocate(&ownerPool, 200);
+		void* pFourth = Threading::JobRunnerMemoryPool::Allocate(&ownerPool, 200);
+		EXPECT_TRUE((pThird == pFirst && pFourth == pSecond) || (pThird == pSecond && pFourth == pFirst));
+
+		// The other pool must not have picked up the blocks
+		void* pOther = Threading::JobRunnerMemoryPool::Allocate(&otherPool, 200);
+		EXPECT_NE(pOther, pFirst);
+		EXPECT_NE(pOther, pSecond);
+
+		Threading::JobRunnerMemoryPool::Deallocate(&ownerPool, pThird, 200);
+		Threading::JobRunnerMemoryPool::Deallocate(&ownerPool, pFourth, 200);
+		Threading::JobRunnerMemoryPool::Deallocate(&otherPool, pOther, 200);
+	}
+
+	UNIT_TEST(JobRunnerMemoryPool, CapCachedBlocks)
+	{
+		struct TestMemoryPool : public Threading::JobRunnerMemoryPool
+		{
+			[[nodiscard]] uint16 GetCachedBlockCount(const uint8 sizeClass) const
+			{
+				return m_freeBlockCounts[sizeClass];
+			}
+		};
+		TestMemoryPool pool;
+
+		constexpr size BlockSize = Threading::JobRunnerMemoryPool::MaximumBlockSize;
+		constexpr uint8 SizeClass = Threading::JobRunnerMemoryPool::SizeClassCount - 1;
+		constexpr uint32 MaximumCachedBlockCount = Threading::JobRunnerMemoryPool::MaximumCachedSizePerSizeClass / BlockSize;
+		constexpr uint32 BlockCount = MaximumCachedBlockCount * 2;
+
+		Array<void*, BlockCount> blocks;
+		for (void*& pBlock : blocks)
+		{
+			pBlock = Threading::JobRunnerMemoryPool::Allocate(&pool, BlockSize);
+			EXPECT_NE(pBlock, nullptr);
+		}
+
+		// Blocks beyond the cap are returned to the global allocator
+		for (void* pBlock : blocks)
+		{
+			Threading::JobRunnerMemoryPool::Deallocate(&pool, pBlock, BlockSize);
+		}
+		EXPECT_EQ(pool.GetCachedBlockCount(SizeClass), MaximumCachedBlockCount);
+
+		for (void*& pBlock : blocks)
+		{
+			pBlock = Threading::JobRunnerMemoryPool::Allocate(&pool, BlockSize);
+			EXPECT_NE(pBlock, nullptr);
+		}
+		EXPECT_EQ(pool.GetCachedBlockCount(SizeClass), 0u);
+
+		for (void* pBlock : blocks)
+		{
+			Threading::JobRunnerMemoryPool::Deallocate(&pool, pBlock, BlockSize);
+		}
+	}
+
+	UNIT_TEST(JobRunnerMemoryPool, AdoptReleasedPools)
+	{
+		Threading::JobRunnerMemoryPool& pool = Threading::JobRunnerMemoryPool::Acquire();
+		void* pBlock = Threading::JobRunnerMemoryPool::Allocate(&pool, 100);
+		EXPECT_NE(pBlock, nullptr);
+
+		// Blocks can still be freed into a pool after its runner released it
+		Threading::JobRunnerMemoryPool::Release(pool);
+		Threading::JobRunnerMemoryPool::Deallocate(nullptr, pBlock, 100);
+
+		Threading::JobRunnerMemoryPool& adoptedPool = Threading::JobRunnerMemoryPool::Acquire();
+		EXPECT_EQ(&adoptedPool, &pool);
+		Threading::JobRunnerMemoryPool::Release(adoptedPool);
+	}
+
+	UNIT_TEST(JobRunnerMemoryPool, LargeAndUnpooledBlocks)
+	{
+		Threading::JobRunnerMemoryPool pool;
+
+		void* pLarge = Threading::JobRunnerMemoryPool::Allocate(&pool, Threading::JobRunnerMemoryPool::MaximumBlockSize * 2);
+		EXPECT_NE(pLarge, nullptr);
+		Threading::JobRunnerMemoryPool::Deallocate(&pool, pLarge, Threading::JobRunnerMemoryPool::MaximumBlockSize * 2);
+
+		void* pUnpooled = Threading::JobRunnerMemoryPool::Allocate(nullptr, 64);
+		EXPECT_NE(pUnpooled, nullptr);
+		Threading::JobRunnerMemoryPool::Deallocate(&pool, pUnpooled, 64);
+	}
+
+	UNIT_TEST(JobRunnerMemoryPool, PoolAllocatedObjects)
+	{
+		struct PooledObject : public Threading::JobRunnerPoolAllocated
+		{
+			virtual ~PooledObject() = default;
+			uint64 m_values[4];
+		};
+		struct DerivedPooledObject final : public PooledObject
+		{
+			uint64 m_additionalValues[8];
+		};
+
+		Threading::JobRunnerMemoryPool pool;
+		const Optional<Threading::JobRunnerMemoryPool*> pPreviousPool = Threading::JobRunnerMemoryPool::GetCurrent();
+		Threading::JobRunnerMemoryPool::GetCurrent() = &pool;
+
+		PooledObject* pFirst = new DerivedPooledObject();
+		// Deleting through the base releases the block into the derived type's size class
+		delete pFirst;
+		PooledObject* pSecond = new DerivedPooledObject();
+		EXPECT_EQ(pSecond, pFirst);
+		delete pSecond;
+
+		Threading::JobRunnerMemoryPool::GetCurrent() = pPreviousPool;
+	}
+}
@@ -0,0 +1,173 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include "ScopedJobManager.h"
+
+#include <Common/Threading/Jobs/ParallelFor.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Memory/Containers/Vector.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(ParallelFor, CoversEveryElementOnce)
+	{
+		ScopedJobManager jobManager;
+
+		constexpr uint32 elementCount = 100000;
+		constexpr uint32 minimumChunkSize = 64;
+		Vector<uint32, uint32> values(Memory::ConstructWithSize, Memory::Zeroed, elementCount);
+		const ArrayView<uint32, uint32> view = values.GetView();
+		Threading::Atomic<uint32> undersizedChunkCount{0};
+
+		// Passed as an lvalue, the batch must keep its own copy
+		auto callback = [view, &undersizedChunkCount](const ArrayView<uint32, uint32> chunk)
+		{
+			// Only the last chunk of the view can be smaller than the minimum
+			if (chunk.GetSize() < minimumChunkSize && chunk.end() != view.end())
+			{
+				undersizedChunkCount++;
+			}
+			for (uint32& value : chunk)
+			{
+				value++;
+			}
+		};
+		Threading::JobBatch jobBatch = Threading::ParallelFor(view, callback, Threading::JobPriority::UserInterfaceAction, minimumChunkSize);
+		jobManager.QueueAndWait(jobBatch);
+
+		EXPECT_EQ(undersizedChunkCount.Load(), 0u);
+		for (const uint32 value : values)
+		{
+			EXPECT_EQ(value, 1u);
+		}
+	}
+
+	UNIT_TEST(ParallelFor, EmptyView)
+	{
+		ScopedJobManager jobManager;
+
+		Threading::Atomic<uint32> callCount{0};
+		Threading::JobBatch jobBatch = Threading::ParallelFor(
+			ArrayView<uint32, uint32>{},
+			[&callCount](const ArrayView<uint32, uint32>)
+			{
+				callCount++;
+			},
+			Threading::JobPriority::UserInterfaceAction,
+			16u
+		);
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_EQ(callCount.Load(), 0u);
+	}
+
+	UNIT_TEST(ParallelFor, MinimumChunkSizeLargerThanView)
+	{
+		ScopedJobManager jobManager;
+
+		Vector<uint32, uint32> values(Memory::ConstructWithSize, Memory::Zeroed, 10u);
+		Threading::Atomic<uint32> callCount{0};
+		Threading::Atomic<uint32> elementCount{0};
+		Threading::JobBatch jobBatch = Threading::ParallelFor(
+			values.GetView(),
+			[&callCount, &elementCount](const ArrayView<uint32, uint32> chunk)
+			{
+				callCount++;
+				elementCount += chunk.GetSize();
+			},
+			Threading::JobPriority::UserInterfaceAction,
+			100u
+		);
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_EQ(callCount.Load(), 1u);
+		EXPECT_EQ(elementCount.Load(), 10u);
+	}
+
+	UNIT_TEST(ParallelFor, ReduceMatchesSerial)
+	{
+		ScopedJobManager jobManager;
+
+		constexpr uint32 elementCount = 100000;
+		Vector<uint64, uint32> values(Memory::Reserve, elementCount);
+		uint64 serialSum = 0;
+		for (uint32 i = 0; i < elementCount; ++i)
+		{
+			const uint64 value = uint64(i) * 31u % 1000u;
+			values.EmplaceBack(value);
+			serialSum += value;
+		}
+
+		auto reduce = [](const ArrayView<uint64, uint32> chunk)
+		{
+			uint64 sum = 0;
+			for (const uint64 value : chunk)
+			{
+				sum += value;
+			}
+			return sum;
+		};
+		auto combine = [](const uint64 left, const uint64 right)
+		{
+			return left + right;
+		};
+
+		const uint32 minimumChunkSizes[] = {1u, 64u, elementCount * 2};
+		for (const uint32 minimumChunkSize : minimumChunkSizes)
+		{
+			uint64 parallelSum = 0;
+			Threading::JobBatch jobBatch = Threading::ParallelReduce(
+				values.GetView(),
+				uint64(0),
+				reduce,
+				combine,
+				[&parallelSum](const uint64 result)
+				{
+					parallelSum = result;
+				},
+				Threading::JobPriority::UserInterfaceAction,
+				minimumChunkSize
+			);
+			jobManager.QueueAndWait(jobBatch);
+			EXPECT_EQ(parallelSum, serialSum);
+		}
+	}
+
+	UNIT_TEST(ParallelFor, ScanMatchesSerial)
+	{
+		ScopedJobManager jobManager;
+
+		auto combine = [](const uint64 left, const uint64 right)
+		{
+			return left + right;
+		};
+
+		// Covers the empty input, a single partial chunk, and more chunks than the maximum chunk count
+		const uint32 elementCounts[] = {0u, 10u, 1000u, 100003u};
+		for (const uint32 elementCount : elementCounts)
+		{
+			Vector<uint64, uint32> values(Memory::Reserve, elementCount);
+			Vector<uint64, uint32> serialResult(Memory::Reserve, elementCount);
+			uint64 runningTotal = 0;
+			for (uint32 i = 0; i < elementCount; ++i)
+			{
+				const uint64 value = uint64(i) * 7u % 100u;
+				values.EmplaceBack(value);
+				runningTotal += value;
+				serialResult.EmplaceBack(runningTotal);
+			}
+
+			Vector<uint64, uint32> parallelResult(Memory::ConstructWithSize, Memory::Zeroed, elementCount);
+			const Vector<uint64, uint32>& constValues = values;
+			Threading::JobBatch jobBatch = Threading::ParallelScan(
+				constValues.GetView(),
+				parallelResult.GetView(),
+				uint64(0),
+				combine,
+				Threading::JobPriority::UserInterfaceAction,
+				64u
+			);
+			jobManager.QueueAndWait(jobBatch);
+			EXPECT_TRUE(parallelResult.GetView() == serialResult.GetView());
+		}
+	}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <Common/Threading/Jobs/JobManager.h>
+#include <Common/Threading/Jobs/JobRunnerThread.h>
+#include <Common/Threading/Jobs/AsyncJob.h>
+#include <Common/Threading/AtomicBool.h>
+#include <Common/Threading/Sleep.h>
+#include <Common/Memory/UniquePtr.h>
+#include <Common/System/Query.h>
+
+namespace ngine::Tests
+{
+	//! Starts a job manager for the duration of a test and registers it as the job manager system
+	//! The test's thread becomes the main runner, and executes jobs while waiting for batches.
+	struct ScopedJobManager
+	{
+		ScopedJobManager(const uint16 runnerCount = 4)
+			: m_pJobManager(UniquePtr<Threading::JobManager>::Make())
+		{
+			const Math::Range<uint16> allRunners = Math::Range<uint16>::Make(0, runnerCount);
+			m_pJobManager->StartRunners(runnerCount, allRunners, allRunners, allRunners);
+			System::Query::GetInstance().RegisterSystem(*m_pJobManager);
+		}
+		ScopedJobManager(const ScopedJobManager&) = delete;
+		ScopedJobManager& operator=(const ScopedJobManager&) = delete;
+		ScopedJobManager(ScopedJobManager&&) = delete;
+		ScopedJobManager& operator=(ScopedJobManager&&) = delete;
+		~ScopedJobManager()
+		{
+			System::Query::GetInstance().DeregisterSystem<Threading::JobManager>();
+			m_pJobManager.DestroyElement();
+
+			// The test's thread must not keep referring to the destroyed main runner
+			Threading::JobRunnerThread::GetCurrent() = nullptr;
+			Threading::JobRunnerMemoryPool::GetCurrent() = nullptr;
+		}
+
+		[[nodiscard]] Threading::JobManager& GetJobManager()
+		{
+			return *m_pJobManager;
+		}
+		[[nodiscard]] Threading::JobRunnerThread& GetMainRunner()
+		{
+			return m_pJobManager->GetJobThreads()[0];
+		}
+
+		//! Queues the batch and runs jobs on the main runner until its finished stage has executed
+		void QueueAndWait(Threading::JobBatch& jobBatch, const Threading::JobPriority priority = Threading::JobPriority::UserInterfaceAction)
+		{
+			Threading::Atomic<bool> isFinished{false};
+			jobBatch.QueueAsNewFinishedStage(Threading::CreateCallback(
+				[&isFinished](Threading::JobRunnerThread&)
+				{
+					isFinished = true;
+				},
+				priority
+			));
+			m_pJobManager->Queue(jobBatch, priority);
+
+			Threading::JobRunnerThread& mainRunner = GetMainRunner();
+			while (!isFinished)
+			{
+				if (!mainRunner.DoRunNextJob())
+				{
+					Threading::Sleep(0);
+				}
+			}
+		}
+	protected:
+		UniquePtr<Threading::JobManager> m_pJobManager;
+	};
+}
@@ -0,0 +1,44 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Common/Threading/SnapshotPointer.h>
+
+namespace ngine::Tests
+{
+	UNIT_TEST(SnapshotPointer, PublishAndRead)
+	{
+		Threading::TSnapshotPointer<int32> pointer;
+		EXPECT_FALSE(pointer.IsPublished());
+		EXPECT_FALSE(pointer.Read().IsValid());
+
+		Threading::RetiredSnapshot initialSnapshot = pointer.Publish(UniquePtr<int32>::Make(1));
+		EXPECT_FALSE(initialSnapshot.IsValid());
+		EXPECT_TRUE(pointer.IsPublished());
+		EXPECT_EQ(*pointer.Read().Get(), 1);
+
+		Threading::Reclaim(pointer.Publish(UniquePtr<int32>::Make(2)));
+		EXPECT_EQ(*pointer.Read().Get(), 2);
+	}
+
+	UNIT_TEST(SnapshotPointer, DeferReclamationWhileReading)
+	{
+		using SnapshotPointer = Threading::TSnapshotPointer<int32>;
+		SnapshotPointer pointer;
+		Threading::Reclaim(pointer.Publish(UniquePtr<int32>::Make(1)));
+
+		UniquePtr<SnapshotPointer::ReadScope> pReadScope = UniquePtr<SnapshotPointer::ReadScope>::Make(pointer);
+		EXPECT_EQ(*pReadScope->Get(), 1);
+
+		Threading::RetiredSnapshot retiredSnapshot = pointer.Publish(UniquePtr<int32>::Make(2));
+		EXPECT_TRUE(retiredSnapshot.IsValid());
+		// The reader still accesses the replaced snapshot, so it must not be freed yet
+		EXPECT_FALSE(retiredSnapshot.TryReclaim());
+		EXPECT_EQ(*pReadScope->Get(), 1);
+		EXPECT_EQ(*pointer.Read().Get(), 2);
+
+		pReadScope = nullptr;
+		EXPECT_TRUE(retiredSnapshot.TryReclaim());
+		EXPECT_FALSE(retiredSnapshot.IsValid());
+	}
+}
@@ -0,0 +1,168 @@
+#include <Common/Memory/New.h>
+
+#include <Common/Tests/UnitTest.h>
+
+#include <Threading/ScopedJobManager.h>
+
+#include <Common/Threading/Jobs/CoroutineJob.h>
+#include <Common/IO/AwaitLoadFromDisk.h>
+#include <Common/IO/File.h>
+#include <Common/IO/Path.h>
+#include <Common/Threading/AtomicInteger.h>
+#include <Common/Memory/Containers/Vector.h>
+
+static_assert(HAS_COROUTINE_JOBS, "Coroutine unit tests must be compiled as C++20");
+
+namespace ngine::Tests
+{
+	static Threading::CoroutineJob
+	AwaitJobCoroutine(Threading::Atomic<uint32>& counter, uint32& observedCount, const Threading::JobPriority priority)
+	{
+		co_await Threading::Await(
+			Threading::CreateCallback(
+				[&counter](Threading::JobRunnerThread&)
+				{
+					counter++;
+				},
+				priority
+			),
+			priority
+		);
+		observedCount = counter.Load();
+
+		co_await Threading::Await(
+			Threading::CreateCallback(
+				[&counter](Threading::JobRunnerThread&)
+				{
+					counter++;
+				},
+				priority
+			),
+			priority
+		);
+		observedCount += counter.Load();
+	}
+
+	UNIT_TEST(CoroutineJob, AwaitJob)
+	{
+		ScopedJobManager jobManager;
+
+		Threading::Atomic<uint32> counter{0};
+		uint32 observedCount = 0;
+		Threading::CoroutineJob coroutine = AwaitJobCoroutine(counter, observedCount, Threading::JobPriority::UserInterfaceAction);
+		EXPECT_TRUE(coroutine.IsValid());
+
+		Threading::JobBatch jobBatch(coroutine.GetJob());
+		jobManager.QueueAndWait(jobBatch);
+		// Resumed after each awaited job, so it observed both increments in order
+		EXPECT_EQ(counter.Load(), 2u);
+		EXPECT_EQ(observedCount, 3u);
+	}
+
+	static Threading::CoroutineJob AwaitBatchCoroutine(
+		Threading::Atomic<uint32>& counter, uint32& observedCount, const uint32 jobCount, const Threading::JobPriority priority
+	)
+	{
+		Threading::JobBatch jobBatch;
+		for (uint32 i = 0; i < jobCount; ++i)
+		{
+			jobBatch.QueueAfterStartStage(Threading::CreateCallback(
+				[&counter](Threading::JobRunnerThread&)
+				{
+					counter++;
+				},
+				priority
+			));
+		}
+		co_await Threading::Await(jobBatch, priority);
+		observedCount = counter.Load();
+	}
+
+	UNIT_TEST(CoroutineJob, AwaitBatch)
+	{
+		ScopedJobManager jobManager;
+
+		constexpr uint32 jobCount = 64;
+		Threading::Atomic<uint32> counter{0};
+		uint32 observedCount = 0;
+		Threading::CoroutineJob coroutine = AwaitBatchCoroutine(counter, observedCount, jobCount, Threading::JobPriority::UserInterfaceAction);
+
+		Threading::JobBatch jobBatch(coroutine.GetJob());
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_EQ(observedCount, jobCount);
+	}
+
+	static Threading::CoroutineJob SwitchPriorityCoroutine(uint32& resumeCount, const Threading::JobPriority priority)
+	{
+		co_await Threading::SwitchPriority(Threading::JobPriority::LoadProject);
+		resumeCount++;
+		co_await Threading::SwitchPriority(priority);
+		resumeCount++;
+	}
+
+	UNIT_TEST(CoroutineJob, SwitchPriority)
+	{
+		ScopedJobManager jobManager;
+
+		uint32 resumeCount = 0;
+		Threading::CoroutineJob coroutine = SwitchPriorityCoroutine(resumeCount, Threading::JobPriority::UserInterfaceAction);
+
+		Threading::JobBatch jobBatch(coroutine.GetJob());
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_EQ(resumeCount, 2u);
+	}
+
+	UNIT_TEST(CoroutineJob, ManyConcurrentCoroutines)
+	{
+		ScopedJobManager jobManager;
+
+		constexpr uint32 coroutineCount = 256;
+		Threading::Atomic<uint32> counter{0};
+		Vector<uint32, uint32> observedCounts(Memory::ConstructWithSize, Memory::Zeroed, coroutineCount);
+		Threading::JobBatch jobBatch;
+		for (uint32& observedCount : observedCounts)
+		{
+			Threading::CoroutineJob coroutine = AwaitJobCoroutine(counter, observedCount, Threading::JobPriority::UserInterfaceAction);
+			jobBatch.QueueAfterStartStage(coroutine.GetJob());
+		}
+		jobManager.QueueAndWait(jobBatch);
+
+		// Every coroutine ran both of its jobs, and the batch only finished once all coroutines did
+		EXPECT_EQ(counter.Load(), coroutineCount * 2);
+		for (const uint32 observedCount : observedCounts)
+		{
+			EXPECT_GT(observedCount, 0u);
+		}
+	}
+
+	static Threading::CoroutineJob
+	LoadFromDiskCoroutine(const IO::PathView path, const ByteView target, ConstByteView& loadedData, const Threading::JobPriority priority)
+	{
+		loadedData = co_await IO::AwaitLoadFromDisk(path, target, priority);
+	}
+
+	UNIT_TEST(CoroutineJob, AwaitLoadFromDisk)
+	{
+		ScopedJobManager jobManager;
+
+		const IO::Path filePath = IO::Path::Combine(IO::Path::GetTemporaryDirectory(), MAKE_PATH("CoroutineJobLoadTest.bin"));
+		constexpr ConstStringView contents = "Loaded by a coroutine job";
+		{
+			IO::File file(filePath, IO::AccessModeFlags::WriteBinary);
+			EXPECT_TRUE(file.IsValid());
+			EXPECT_EQ(file.Write(contents), contents.GetSize());
+		}
+
+		Vector<ByteType, size> target(Memory::ConstructWithSize, Memory::Zeroed, (size)contents.GetSize());
+		ConstByteView loadedData;
+		Threading::CoroutineJob coroutine =
+			LoadFromDiskCoroutine(filePath, target.GetView(), loadedData, Threading::JobPriority::UserInterfaceAction);
+
+		Threading::JobBatch jobBatch(coroutine.GetJob());
+		jobManager.QueueAndWait(jobBatch);
+		EXPECT_EQ(loadedData.GetDataSize(), (size)contents.GetSize());
+		EXPECT_EQ(ConstStringView(reinterpret_cast<const char*>(loadedData.GetData()), (uint32)loadedData.GetDataSize()), contents);
+
+		EXPECT_TRUE(filePath.RemoveFile());
+	}
+}
@@ -30,6 +30,39 @@ function(MakeUnitTests target target_name)
 	endif()
 endfunction()
 
+# Builds the tests in UnitTestsCpp20 as C++20 against the C++17 library, the way a C++20 consumer of the public headers does
+# Covers features that are only available when compiling as C++20, such as coroutine jobs
+function(MakeCpp20UnitTests target target_name)
+	if(OPTION_BUILD_UNIT_TESTS)
+		set(_${target_name}Cpp20UnitTests_src_root_path "${CMAKE_CURRENT_LIST_DIR}/UnitTestsCpp20")
+			file(
+				GLOB_RECURSE _${target_name}Cpp20UnitTests_source_list
+				LIST_DIRECTORIES false
+				"${_${target_name}Cpp20UnitTests_src_root_path}/*.cpp*"
+				"${_${target_name}Cpp20UnitTests_src_root_path}/*.h*"
+			)
+
+		MakeExecutable(${target_name}Cpp20UnitTests "" "${CMAKE_CURRENT_LIST_DIR}/UnitTestsCpp20")
+		target_sources(${target_name}Cpp20UnitTests PRIVATE "${CMAKE_CURRENT_LIST_DIR}/UnitTests/Private/main.cpp")
+		target_include_directories(${target_name}Cpp20UnitTests PRIVATE "${CMAKE_CURRENT_LIST_DIR}/UnitTests/Private")
+		AddTargetOptions(${target_name}Cpp20UnitTests)
+		LinkStaticLibrary(${target_name}Cpp20UnitTests ${target})
+		target_link_libraries(${target_name}Cpp20UnitTests PRIVATE gtest)
+		set_target_properties(${target_name}Cpp20UnitTests PROPERTIES CXX_STANDARD 20 FOLDER Tests/Unit)
+
+		gtest_add_tests(${target_name}Cpp20UnitTests "" AUTO)
+
+		foreach(_source IN ITEMS ${_${target_name}Cpp20UnitTests_source_list})
+			get_filename_component(_source_path "${_source}" PATH)
+			file(RELATIVE_PATH _source_path_rel "${_${target_name}Cpp20UnitTests_src_root_path}" "${_source_path}")
+			string(REPLACE "/" "\\" _group_path "${_source_path_rel}")
+			source_group("${_group_path}" FILES "${_source}")
+		endforeach()
+
+		AddCoreTargetOptions(gtest)
+	endif()
+endfunction()
+
 function(MakeFeatureTests target target_name)
 	if(OPTION_BUILD_FEATURE_TESTS)
 		set(_${target_name}FeatureTests_src_root_path "${CMAKE_CURRENT_LIST_DIR}/FeatureTests")